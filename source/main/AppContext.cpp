@@ -49,6 +49,8 @@
 #   include <windows.h>
 #endif
 
+#include <OgreDefaultHardwareBufferManager.h>
+
 #include <iomanip>
 #include <sstream>
 #include <string>
@@ -324,6 +326,17 @@ bool AppContext::SetUpRendering()
     return true;
 }
 
+bool AppContext::SetUpHeadless()
+{
+    // OGRE root without a render system or window; the log was already created by `SetUpLogging()`
+    m_ogre_root = new Ogre::Root("", "", "");
+
+    // Meshes and their buffers live in system memory
+    new Ogre::DefaultHardwareBufferManager();
+
+    return true;
+}
+
 Ogre::RenderWindow* AppContext::CreateCustomRenderWindow(std::string const& window_name, int width, int height)
 {
     Ogre::NameValuePairList misc;
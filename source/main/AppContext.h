@@ -48,6 +48,7 @@ public:
     void                 SetUpLogging();
     bool                 SetUpResourcesDir();
     bool                 SetUpRendering();
+    bool                 SetUpHeadless();       //!< Instead of `SetUpRendering()`, for RoR_simbench
     bool                 SetUpConfigSkeleton();
     bool                 SetUpInput();
     void                 SetUpObsoleteConfMarker();
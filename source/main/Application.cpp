@@ -78,6 +78,7 @@ CVar* app_language;
 CVar* app_country;
 CVar* app_skip_main_menu;
 CVar* app_async_physics;
+CVar* app_pipelined_physics;
 CVar* app_num_workers;
 CVar* app_screenshot_format;
 CVar* app_rendersys_override;
@@ -103,6 +104,8 @@ CVar* sim_no_self_collisions;
 CVar* sim_gearbox_mode;
 CVar* sim_soft_reset_mode;
 CVar* sim_quickload_dialog;
+CVar* sim_rng_seed;
+CVar* sim_island_dozing;
 
 // Multiplayer
 CVar* mp_state;
@@ -145,6 +148,7 @@ CVar* diag_hide_wheel_info;
 CVar* diag_hide_wheels;
 CVar* diag_hide_nodes;
 CVar* diag_terrn_log_roads;
+CVar* diag_cache_json;
 
 // System
 CVar* sys_process_dir;
@@ -284,7 +288,21 @@ void CreateMumble()
 void CreateThreadPool()
 {
     ROR_ASSERT(g_thread_pool == nullptr);
-    g_thread_pool = ThreadPool::DetectNumWorkersAndCreate();
+
+    // Create general-purpose thread pool
+    int logical_cores = std::thread::hardware_concurrency();
+
+    int num_threads = App::app_num_workers->GetInt();
+    if (num_threads < 1 || num_threads > logical_cores)
+    {
+        num_threads = Ogre::Math::Clamp(logical_cores - 1, 1, 8);
+        App::app_num_workers->SetVal(num_threads);
+    }
+
+    RoR::LogFormat("[RoR|ThreadPool] Found %d logical CPU cores, creating %d worker threads",
+              logical_cores, num_threads);
+
+    g_thread_pool = new ThreadPool(num_threads);
 }
 
 void CreateCameraManager()
@@ -318,17 +336,35 @@ void DestroyOverlayWrapper()
     g_overlay_wrapper = nullptr;
 }
 
+void DestroyThreadPool()
+{
+    delete g_thread_pool; // Joins the workers
+    g_thread_pool = nullptr;
+}
+
 } // namespace App
 
 // ------------------------------------------------------------------------------------------------
 // Global logging
 // ------------------------------------------------------------------------------------------------
 
+static thread_local std::vector<std::string>* t_log_capture = nullptr;
+
 void Log(const char* msg)
 {
+    if (t_log_capture)
+    {
+        t_log_capture->push_back(msg);
+        return;
+    }
     Ogre::LogManager::getSingleton().logMessage(msg);
 }
 
+void SetLogCapture(std::vector<std::string>* lines)
+{
+    t_log_capture = lines;
+}
+
 void LogFormat(const char* format, ...)
 {
     char buffer[2000] = {};
@@ -37,6 +37,7 @@
 
 #include <assert.h>
 #include <string>
+#include <vector>
 
 #define ROR_ASSERT(_EXPR)  assert(_EXPR)
 
@@ -253,6 +254,7 @@ extern CVar* app_language;
 extern CVar* app_country;
 extern CVar* app_skip_main_menu;
 extern CVar* app_async_physics;
+extern CVar* app_pipelined_physics;
 extern CVar* app_num_workers;
 extern CVar* app_screenshot_format;
 extern CVar* app_rendersys_override;
@@ -277,6 +279,8 @@ extern CVar* sim_no_self_collisions;
 extern CVar* sim_gearbox_mode;
 extern CVar* sim_soft_reset_mode;
 extern CVar* sim_quickload_dialog;
+extern CVar* sim_rng_seed;
+extern CVar* sim_island_dozing;
 
 // Multiplayer
 extern CVar* mp_state;
@@ -320,6 +324,7 @@ extern CVar* diag_hide_wheel_info;
 extern CVar* diag_hide_wheels;
 extern CVar* diag_hide_nodes;
 extern CVar* diag_terrn_log_roads;
+extern CVar* diag_cache_json;
 
 // System
 extern CVar* sys_process_dir;
@@ -446,6 +451,7 @@ void SetCacheSystem          (CacheSystem*       obj);
 
 // Cleanups
 void DestroyOverlayWrapper();
+void DestroyThreadPool();
 
 } // namespace App
 
@@ -455,6 +461,7 @@ void DestroyOverlayWrapper();
 
 void          Log(const char* msg);               //!< The ultimate, application-wide logging function. Adds a line (any length) in 'RoR.log' file.
 void          LogFormat(const char* format, ...); //!< Improved logging utility. Uses fixed 2Kb buffer.
+void          SetLogCapture(std::vector<std::string>* lines); //!< Lines logged by the calling thread go to `lines` until reset with nullptr; for worker tasks whose log is written later in a fixed order.
 
 } // namespace RoR
 
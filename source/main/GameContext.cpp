@@ -271,18 +271,22 @@ void GameContext::ModifyActor(ActorModifyRequest& rq)
     if (rq.amr_type == ActorModifyRequest::Type::SOFT_RESET)
     {
         rq.amr_actor->SoftReset();
+        rq.amr_actor->PublishSimSnapshot(); // Don't show the old position for a frame
     }
     else if (rq.amr_type == ActorModifyRequest::Type::RESET_ON_SPOT)
     {
         rq.amr_actor->SyncReset(/*reset_position:*/false);
+        rq.amr_actor->PublishSimSnapshot();
     }
     else if (rq.amr_type == ActorModifyRequest::Type::RESET_ON_INIT_POS)
     {
         rq.amr_actor->SyncReset(/*reset_position:*/true);
+        rq.amr_actor->PublishSimSnapshot();
     }
     else if (rq.amr_type == ActorModifyRequest::Type::RESTORE_SAVED)
     {
         m_actor_manager.RestoreSavedState(rq.amr_actor, *rq.amr_saved_state.get());
+        rq.amr_actor->PublishSimSnapshot();
     }
     else if (rq.amr_type == ActorModifyRequest::Type::WAKE_UP &&
         rq.amr_actor->ar_sim_state == Actor::SimState::LOCAL_SLEEPING)
@@ -178,9 +178,9 @@ unsigned long Replay::getLastReadTime()
     return curFrameTime;
 }
  
-void Replay::onPhysicsStep()
+void Replay::onPhysicsStep(float dt)
 {
-    m_replay_timer += PHYSICS_DT;
+    m_replay_timer += dt;
     if (m_replay_timer >= ar_replay_precision)
     {
         // store nodes
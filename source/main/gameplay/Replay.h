@@ -46,7 +46,7 @@ public:
     void*               getReadBuffer(int offset, int type, unsigned long& time);
     unsigned long       getLastReadTime();
     void                writeDone();
-    void                onPhysicsStep();
+    void                onPhysicsStep(float dt);
     void                replayStepActor();
     float               getPrecision() const { return ar_replay_precision; }
     float               getReplayPositionSec() const { return ((float)curFrameTime) / 1000000.0f; }
@@ -24,6 +24,7 @@
 
 #include "Application.h"
 #include "TerrainManager.h"
+#include "ThreadPool.h"
 #include "Water.h"
 
 using namespace Ogre;
@@ -291,3 +292,59 @@ void DustPool::update()
     }
     allocated = 0;
 }
+
+
+// ------------------------- DustSpawnQueue -------------------------
+
+
+void DustSpawnQueue::Resize(int num_workers)
+{
+    m_rings.clear();
+    for (int i = 0; i < num_workers + 1; i++)
+    {
+        m_rings.emplace_back(new Ring());
+    }
+}
+
+void DustSpawnQueue::Push(DustPool* pool, SpawnType type, Vector3 pos, Vector3 vel)
+{
+    // Only one thread outside the pool runs physics at a time, so it can own ring 0
+    const size_t ring = static_cast<size_t>(App::GetThreadPool()->GetCurrentWorker() + 1);
+    if (ring < m_rings.size())
+    {
+        Spawn spawn;
+        spawn.pool = pool;
+        spawn.type = type;
+        spawn.pos = pos;
+        spawn.vel = vel;
+        m_rings[ring]->Push(spawn); // Full - drop it
+    }
+}
+
+void DustSpawnQueue::SpawnAll()
+{
+    Spawn spawn;
+    for (auto& ring: m_rings)
+    {
+        while (ring->Pop(spawn))
+        {
+            switch (spawn.type)
+            {
+            case SPAWN_DUST:   spawn.pool->malloc(spawn.pos, spawn.vel);      break;
+            case SPAWN_SPLASH: spawn.pool->allocSplash(spawn.pos, spawn.vel); break;
+            case SPAWN_RIPPLE: spawn.pool->allocRipple(spawn.pos, spawn.vel); break;
+            }
+        }
+    }
+}
+
+void DustSpawnQueue::DiscardAll()
+{
+    Spawn spawn;
+    for (auto& ring: m_rings)
+    {
+        while (ring->Pop(spawn))
+        {
+        }
+    }
+}
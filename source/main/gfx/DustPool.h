@@ -21,8 +21,11 @@
 #pragma once
 
 #include "Application.h"
+#include "SpscRingBuffer.h"
 
+#include <memory>
 #include <mutex>
+#include <vector>
 #include <Ogre.h>
 
 namespace RoR {
@@ -84,4 +87,38 @@ protected:
     bool m_is_discarded;
 };
 
+/// Particles requested by physics, spawned on the main thread by `GfxScene`.
+/// Every thread pool worker (and the thread running the physics loop) gets its own lock-free ring,
+/// so physics never blocks and never touches a `DustPool`. Requests are dropped when a ring is full.
+class DustSpawnQueue
+{
+public:
+
+    enum SpawnType
+    {
+        SPAWN_DUST,   //!< `DustPool::malloc()`
+        SPAWN_SPLASH, //!< `DustPool::allocSplash()`
+        SPAWN_RIPPLE  //!< `DustPool::allocRipple()`
+    };
+
+    void Resize(int num_workers); //!< Main thread, with physics halted
+    void Push(DustPool* pool, SpawnType type, Ogre::Vector3 pos, Ogre::Vector3 vel); //!< Physics threads
+    void SpawnAll();              //!< Main thread
+    void DiscardAll();            //!< Main thread; do this before deleting the pools
+
+private:
+
+    struct Spawn
+    {
+        DustPool*      pool;
+        SpawnType      type;
+        Ogre::Vector3  pos;
+        Ogre::Vector3  vel;
+    };
+
+    typedef SpscRingBuffer<Spawn, 256> Ring;
+
+    std::vector<std::unique_ptr<Ring>> m_rings; //!< [0] = threads outside the pool, [1+N] = worker N
+};
+
 } // namespace RoRs
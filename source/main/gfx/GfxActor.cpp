@@ -24,6 +24,7 @@
 #include "ApproxMath.h"
 #include "AirBrake.h"
 #include "Actor.h"
+#include "ActorManager.h"
 #include "Collisions.h"
 #include "DustPool.h" // General particle gfx
 #include "EngineSim.h"
@@ -34,10 +35,12 @@
 #include "FlexBody.h"
 #include "FlexMeshWheel.h"
 #include "FlexObj.h"
+#include "GameContext.h"
 #include "InputEngine.h" // TODO: Keys shouldn't be queried from here, but buffered in sim. loop ~ only_a_ptr, 06/2018
 #include "MeshObject.h"
 #include "MovableText.h"
 #include "OgreImGui.h"
+#include "Profiler.h"
 #include "Renderdash.h" // classic 'renderdash' material
 #include "ActorSpawner.h"
 #include "SlideNode.h"
@@ -76,10 +79,14 @@ RoR::GfxActor::GfxActor(Actor* actor, ActorSpawner* spawner, std::string ogre_re
     m_particles_sparks = App::GetGfxScene()->GetDustPool("sparks");
     m_particles_clump  = App::GetGfxScene()->GetDustPool("clump");
 
-    m_simbuf.simbuf_nodes.reset(new SimBuffer::NodeSB[actor->ar_num_nodes]);
     m_simbuf.simbuf_aeroengines.resize(actor->ar_num_aeroengines);
     m_simbuf.simbuf_commandkey.resize(MAX_COMMANDS + 10);
     m_simbuf.simbuf_airbrakes.resize(spawner->GetMemoryRequirements().num_airbrakes);
+    SimSnapshot empty_snapshot;
+    empty_snapshot.nodes.resize(actor->ar_num_nodes, SimBuffer::NodeSB());
+    empty_snapshot.state = m_simbuf; // Sizes the arrays, so that publishing doesn't allocate
+    actor->m_sim_snapshot.Reset(empty_snapshot);
+    m_simbuf.simbuf_nodes = actor->m_sim_snapshot.GetFrontBuffer().nodes.data();
 
     // Attributes
     m_attr.xa_speedo_highest_kph = actor->ar_speedo_max_kph; // TODO: Remove the attribute from Actor altogether ~ only_a_ptr, 05/2018
@@ -432,7 +439,7 @@ void RoR::GfxActor::UpdateVideoCameras(float dt_sec)
             vidcam.vcam_render_window->update();
 
         // get the normal of the camera plane now
-        GfxActor::SimBuffer::NodeSB* node_buf = m_simbuf.simbuf_nodes.get();
+        GfxActor::SimBuffer::NodeSB* node_buf = m_simbuf.simbuf_nodes;
         const Ogre::Vector3 abs_pos_center = node_buf[vidcam.vcam_node_center].AbsPosition;
         const Ogre::Vector3 abs_pos_z = node_buf[vidcam.vcam_node_dir_z].AbsPosition;
         const Ogre::Vector3 abs_pos_y = node_buf[vidcam.vcam_node_dir_y].AbsPosition;
@@ -1726,150 +1733,192 @@ void RoR::GfxActor::SetRodsVisible(bool visible)
 
 void RoR::GfxActor::UpdateSimDataBuffer()
 {
-    m_simbuf.simbuf_live_local = (m_actor->ar_sim_state == Actor::SimState::LOCAL_SIMULATED);
-    m_simbuf.simbuf_physics_paused = m_actor->ar_physics_paused;
-    m_simbuf.simbuf_pos = m_actor->GetRotationCenter();
-    m_simbuf.simbuf_rotation = m_actor->getRotation();
-    m_simbuf.simbuf_tyre_pressure = m_actor->GetTyrePressure().GetCurPressure();
-    m_simbuf.simbuf_tyre_pressurizing = m_actor->GetTyrePressure().IsPressurizing();
-    m_simbuf.simbuf_aabb = m_actor->ar_bounding_box;
-    m_simbuf.simbuf_wheel_speed = m_actor->ar_wheel_speed;
-    m_simbuf.simbuf_beaconlight_active = m_actor->m_beacon_light_on;
-    m_simbuf.simbuf_cur_cinecam = m_actor->ar_current_cinecam;
-    m_simbuf.simbuf_parking_brake = m_actor->ar_parking_brake;
-    m_simbuf.simbuf_brake = m_actor->ar_brake;
-    m_simbuf.simbuf_hydro_dir_state = m_actor->ar_hydro_dir_state;
-    m_simbuf.simbuf_hydro_aileron_state = m_actor->ar_hydro_aileron_state;
-    m_simbuf.simbuf_hydro_elevator_state = m_actor->ar_hydro_elevator_state;
-    m_simbuf.simbuf_hydro_aero_rudder_state = m_actor->ar_hydro_rudder_state;
-    m_simbuf.simbuf_aero_flap_state = m_actor->ar_aerial_flap;
-    m_simbuf.simbuf_airbrake_state = m_actor->ar_airbrake_intensity;
-    m_simbuf.simbuf_headlight_on = m_actor->m_headlight_on;
-    m_simbuf.simbuf_direction = m_actor->getDirection();
-    m_simbuf.simbuf_top_speed = m_actor->ar_top_speed;
-    m_simbuf.simbuf_node0_velo = m_actor->ar_nodes[0].Velocity;
-    m_simbuf.simbuf_net_username = m_actor->m_net_username;
-    m_simbuf.simbuf_is_remote = m_actor->ar_sim_state == Actor::SimState::NETWORKED_OK;
-
-    // nodes
-    const int num_nodes = m_actor->ar_num_nodes;
-    for (int i = 0; i < num_nodes; ++i)
-    {
-        auto node = m_actor->ar_nodes[i];
-        m_simbuf.simbuf_nodes.get()[i].AbsPosition = node.AbsPosition;
-        m_simbuf.simbuf_nodes.get()[i].nd_has_contact = node.nd_has_ground_contact || node.nd_has_mesh_contact;
+    ROR_PROFILE_SCOPE(GFX_SIM_DATA);
+
+    // nodes - published by the physics step, we only take the newest snapshot
+    const SimSnapshot& snapshot = m_actor->m_sim_snapshot.Acquire();
+
+    // Actor state - if the physics is running (cvar 'app_pipelined_physics'), the live actor is off limits;
+    // use the state captured at the end of the last completed step instead.
+    if (App::GetGameContext()->GetActorManager()->IsSimThreadRunning())
+    {
+        m_simbuf = snapshot.state; // Same sizes, doesn't allocate
     }
+    else
+    {
+        this->CaptureSimState(m_simbuf);
+    }
+    m_simbuf.simbuf_nodes = const_cast<SimBuffer::NodeSB*>(snapshot.nodes.data()); // We own the front buffer until the next `Acquire()`
 
     for (NodeGfx& nx: m_gfx_nodes)
     {
-        m_simbuf.simbuf_nodes.get()[nx.nx_node_idx].nd_is_wet = (nx.nx_wet_time_sec != -1.f);
+        m_simbuf.simbuf_nodes[nx.nx_node_idx].nd_is_wet = (nx.nx_wet_time_sec != -1.f);
     }
 
-    // beams
-    for (Rod& rod: m_rods)
+    // beams - from the same snapshot as the nodes; empty until the first publish after `AddRod()`
+    if (snapshot.rods.size() == m_rods.size())
     {
-        const beam_t& beam = m_actor->ar_beams[rod.rod_beam_index];
-        rod.rod_node1 = static_cast<uint16_t>(beam.p1->pos);
-        rod.rod_node2 = static_cast<uint16_t>(beam.p2->pos);
-        if (beam.bm_inter_actor)
+        for (size_t i = 0; i < m_rods.size(); i++)
         {
-            rod.rod_target_actor = beam.bm_locked_actor;
+            m_rods[i].rod_node1        = snapshot.rods[i].rod_node1;
+            m_rods[i].rod_node2        = snapshot.rods[i].rod_node2;
+            m_rods[i].rod_target_actor = snapshot.rods[i].rod_target_actor;
+            m_rods[i].rod_is_visible   = snapshot.rods[i].rod_is_visible;
         }
-        rod.rod_is_visible = !beam.bm_disabled && !beam.bm_broken;
     }
 
+    // Linked Actors
+    m_linked_gfx_actors.clear();
+    for (auto actor : m_simbuf.simbuf_linked_actors)
+    {
+        m_linked_gfx_actors.insert(actor->GetGfxActor());
+    }
+}
+
+void RoR::GfxActor::CaptureSimState(SimBuffer& dst) const
+{
+    dst.simbuf_live_local = (m_actor->ar_sim_state == Actor::SimState::LOCAL_SIMULATED);
+    dst.simbuf_physics_paused = m_actor->ar_physics_paused;
+    dst.simbuf_pos = m_actor->GetRotationCenter();
+    dst.simbuf_rotation = m_actor->getRotation();
+    dst.simbuf_tyre_pressure = m_actor->GetTyrePressure().GetCurPressure();
+    dst.simbuf_tyre_pressurizing = m_actor->GetTyrePressure().IsPressurizing();
+    dst.simbuf_aabb = m_actor->ar_bounding_box;
+    dst.simbuf_wheel_speed = m_actor->ar_wheel_speed;
+    dst.simbuf_beaconlight_active = m_actor->m_beacon_light_on;
+    dst.simbuf_cur_cinecam = m_actor->ar_current_cinecam;
+    dst.simbuf_parking_brake = m_actor->ar_parking_brake;
+    dst.simbuf_brake = m_actor->ar_brake;
+    dst.simbuf_hydro_dir_state = m_actor->ar_hydro_dir_state;
+    dst.simbuf_hydro_aileron_state = m_actor->ar_hydro_aileron_state;
+    dst.simbuf_hydro_elevator_state = m_actor->ar_hydro_elevator_state;
+    dst.simbuf_hydro_aero_rudder_state = m_actor->ar_hydro_rudder_state;
+    dst.simbuf_aero_flap_state = m_actor->ar_aerial_flap;
+    dst.simbuf_airbrake_state = m_actor->ar_airbrake_intensity;
+    dst.simbuf_headlight_on = m_actor->m_headlight_on;
+    dst.simbuf_direction = m_actor->getDirection();
+    dst.simbuf_top_speed = m_actor->ar_top_speed;
+    dst.simbuf_node0_velo = m_actor->ar_nodes[0].Velocity;
+    dst.simbuf_net_username = m_actor->m_net_username;
+    dst.simbuf_is_remote = m_actor->ar_sim_state == Actor::SimState::NETWORKED_OK;
+
     // airbrakes
     const size_t num_airbrakes = m_actor->ar_airbrakes.size();
     for (size_t i=0; i< num_airbrakes; ++i)
     {
-        m_simbuf.simbuf_airbrakes[i].simbuf_ab_ratio = m_actor->ar_airbrakes[i]->ratio;
+        dst.simbuf_airbrakes[i].simbuf_ab_ratio = m_actor->ar_airbrakes[i]->ratio;
     }
 
     // Engine (+drivetrain)
     if (m_actor->ar_engine != nullptr)
     {
-        m_simbuf.simbuf_gear            = m_actor->ar_engine->GetGear();
-        m_simbuf.simbuf_autoshift       = m_actor->ar_engine->getAutoShift();
-        m_simbuf.simbuf_engine_rpm      = m_actor->ar_engine->GetEngineRpm();
-        m_simbuf.simbuf_engine_turbo_psi= m_actor->ar_engine->GetTurboPsi();
-        m_simbuf.simbuf_engine_accel    = m_actor->ar_engine->GetAcceleration();
-        m_simbuf.simbuf_engine_torque   = m_actor->ar_engine->GetEngineTorque();
-        m_simbuf.simbuf_inputshaft_rpm  = m_actor->ar_engine->GetInputShaftRpm();
-        m_simbuf.simbuf_drive_ratio     = m_actor->ar_engine->GetDriveRatio();
-        m_simbuf.simbuf_clutch          = m_actor->ar_engine->GetClutch();
+        dst.simbuf_gear            = m_actor->ar_engine->GetGear();
+        dst.simbuf_autoshift       = m_actor->ar_engine->getAutoShift();
+        dst.simbuf_engine_rpm      = m_actor->ar_engine->GetEngineRpm();
+        dst.simbuf_engine_turbo_psi= m_actor->ar_engine->GetTurboPsi();
+        dst.simbuf_engine_accel    = m_actor->ar_engine->GetAcceleration();
+        dst.simbuf_engine_torque   = m_actor->ar_engine->GetEngineTorque();
+        dst.simbuf_inputshaft_rpm  = m_actor->ar_engine->GetInputShaftRpm();
+        dst.simbuf_drive_ratio     = m_actor->ar_engine->GetDriveRatio();
+        dst.simbuf_clutch          = m_actor->ar_engine->GetClutch();
     }
     if (m_actor->m_num_wheel_diffs > 0)
     {
-        m_simbuf.simbuf_diff_type = m_actor->m_wheel_diffs[0]->GetActiveDiffType();
+        dst.simbuf_diff_type = m_actor->m_wheel_diffs[0]->GetActiveDiffType();
     }
 
     // Command keys
     const int num_commandkeys = MAX_COMMANDS + 10;
     for (int i = 0; i < num_commandkeys; ++i)
     {
-        m_simbuf.simbuf_commandkey[i].simbuf_cmd_value = m_actor->ar_command_key[i].commandValue;
+        dst.simbuf_commandkey[i].simbuf_cmd_value = m_actor->ar_command_key[i].commandValue;
     }
 
     // Aeroengines
     for (int i = 0; i < m_actor->ar_num_aeroengines; ++i)
     {
         AeroEngine* src = m_actor->ar_aeroengines[i];
-        SimBuffer::AeroEngineSB& dst = m_simbuf.simbuf_aeroengines[i];
+        SimBuffer::AeroEngineSB& ae = dst.simbuf_aeroengines[i];
 
-        dst.simbuf_ae_throttle   = src->getThrottle();
-        dst.simbuf_ae_rpm        = src->getRPM();
-        dst.simbuf_ae_rpmpc      = src->getRPMpc();
-        dst.simbuf_ae_rpm        = src->getRPM();
-        dst.simbuf_ae_turboprop  = (src->getType() == AeroEngine::AEROENGINE_TYPE_TURBOPROP);
-        dst.simbuf_ae_ignition   = src->getIgnition();
-        dst.simbuf_ae_failed     = src->isFailed();
+        ae.simbuf_ae_throttle   = src->getThrottle();
+        ae.simbuf_ae_rpm        = src->getRPM();
+        ae.simbuf_ae_rpmpc      = src->getRPMpc();
+        ae.simbuf_ae_rpm        = src->getRPM();
+        ae.simbuf_ae_turboprop  = (src->getType() == AeroEngine::AEROENGINE_TYPE_TURBOPROP);
+        ae.simbuf_ae_ignition   = src->getIgnition();
+        ae.simbuf_ae_failed     = src->isFailed();
 
-        if (dst.simbuf_ae_turboprop)
+        if (ae.simbuf_ae_turboprop)
         {
             Turboprop* tp = static_cast<Turboprop*>(src);
-            dst.simbuf_tp_aetorque = (100.0 * tp->indicated_torque / tp->max_torque); // TODO: Code ported as-is from calcAnimators(); what does it do? ~ only_a_ptr, 06/2018
-            dst.simbuf_tp_aepitch = tp->pitch;
+            ae.simbuf_tp_aetorque = (100.0 * tp->indicated_torque / tp->max_torque); // TODO: Code ported as-is from calcAnimators(); what does it do? ~ only_a_ptr, 06/2018
+            ae.simbuf_tp_aepitch = tp->pitch;
         }
         else // turbojet
         {
             Turbojet* tj = static_cast<Turbojet*>(src);
-            dst.simbuf_tj_afterburn = tj->getAfterburner() != 0.f;
-            dst.simbuf_tj_ab_thrust = tj->getAfterburnThrust();
-            dst.simbuf_tj_exhaust_velo = tj->getExhaustVelocity();
+            ae.simbuf_tj_afterburn = tj->getAfterburner() != 0.f;
+            ae.simbuf_tj_ab_thrust = tj->getAfterburnThrust();
+            ae.simbuf_tj_exhaust_velo = tj->getExhaustVelocity();
         }
     }
 
     // Wings
     if (m_actor->ar_num_wings > 4)
     {
-        m_simbuf.simbuf_wing4_aoa = m_actor->ar_wings[4].fa->aoa;
+        dst.simbuf_wing4_aoa = m_actor->ar_wings[4].fa->aoa;
     }
     else
     {
-        m_simbuf.simbuf_wing4_aoa = 0.f;
+        dst.simbuf_wing4_aoa = 0.f;
     }
 
     // Autopilot
     if (m_attr.xa_has_autopilot)
     {
-        m_simbuf.simbuf_ap_heading_mode  = m_actor->ar_autopilot->GetHeadingMode();
-        m_simbuf.simbuf_ap_heading_value = m_actor->ar_autopilot->heading;
-        m_simbuf.simbuf_ap_alt_mode      = m_actor->ar_autopilot->GetAltMode();
-        m_simbuf.simbuf_ap_alt_value     = m_actor->ar_autopilot->GetAltValue();
-        m_simbuf.simbuf_ap_ias_mode      = m_actor->ar_autopilot->GetIasMode();
-        m_simbuf.simbuf_ap_ias_value     = m_actor->ar_autopilot->GetIasValue();
-        m_simbuf.simbuf_ap_gpws_mode     = m_actor->ar_autopilot->GetGpwsMode();
-        m_simbuf.simbuf_ap_ils_available = m_actor->ar_autopilot->IsIlsAvailable();
-        m_simbuf.simbuf_ap_ils_vdev      = m_actor->ar_autopilot->GetVerticalApproachDeviation();
-        m_simbuf.simbuf_ap_ils_hdev      = m_actor->ar_autopilot->GetHorizontalApproachDeviation();
-        m_simbuf.simbuf_ap_vs_value      = m_actor->ar_autopilot->GetVsValue();
+        dst.simbuf_ap_heading_mode  = m_actor->ar_autopilot->GetHeadingMode();
+        dst.simbuf_ap_heading_value = m_actor->ar_autopilot->heading;
+        dst.simbuf_ap_alt_mode      = m_actor->ar_autopilot->GetAltMode();
+        dst.simbuf_ap_alt_value     = m_actor->ar_autopilot->GetAltValue();
+        dst.simbuf_ap_ias_mode      = m_actor->ar_autopilot->GetIasMode();
+        dst.simbuf_ap_ias_value     = m_actor->ar_autopilot->GetIasValue();
+        dst.simbuf_ap_gpws_mode     = m_actor->ar_autopilot->GetGpwsMode();
+        dst.simbuf_ap_ils_available = m_actor->ar_autopilot->IsIlsAvailable();
+        dst.simbuf_ap_ils_vdev      = m_actor->ar_autopilot->GetVerticalApproachDeviation();
+        dst.simbuf_ap_ils_hdev      = m_actor->ar_autopilot->GetHorizontalApproachDeviation();
+        dst.simbuf_ap_vs_value      = m_actor->ar_autopilot->GetVsValue();
     }
 
     // Linked Actors
-    m_linked_gfx_actors.clear();
-    for (auto actor : m_actor->GetAllLinkedActors())
+    dst.simbuf_linked_actors = m_actor->m_linked_actors; // Reuses the capacity
+
+    // Stats; beams are only walked for the player actor, like `SimActorStats::UpdateStats()` used to
+    if (m_actor == App::GetGameContext()->GetActorManager()->GetSimPlayerActor())
     {
-        m_linked_gfx_actors.insert(actor->GetGfxActor());
+        dst.simbuf_num_beams = m_actor->ar_num_beams;
+        dst.simbuf_beams_broken = 0;
+        dst.simbuf_beams_deformed = 0;
+        dst.simbuf_beams_stress = 0.f;
+        dst.simbuf_beams_avg_deform = 0.f;
+        for (int i = 0; i < m_actor->ar_num_beams; i++)
+        {
+            const beam_t& beam = m_actor->ar_beams[i];
+            if (beam.bm_broken != 0)
+            {
+                dst.simbuf_beams_broken++;
+            }
+            dst.simbuf_beams_stress += std::abs(beam.stress);
+            float current_deformation = fabs(beam.L - beam.refL);
+            if (fabs(current_deformation) > 0.0001f && beam.bm_type != BEAM_HYDRO)
+            {
+                dst.simbuf_beams_deformed++;
+            }
+            dst.simbuf_beams_avg_deform += current_deformation;
+        }
+        dst.simbuf_mass = m_actor->getTotalMass();
+        dst.simbuf_gforces_cur = m_actor->GetGForcesCur();
+        dst.simbuf_gforces_max = m_actor->GetGForcesMax();
+        dst.simbuf_last_fuzzy_ground_model = m_actor->ar_last_fuzzy_ground_model;
     }
 }
 
@@ -1996,7 +2045,7 @@ void RoR::GfxActor::RegisterProps(std::vector<Prop> const& props, int driverseat
 void RoR::GfxActor::UpdateAirbrakes()
 {
     const size_t num_airbrakes = m_gfx_airbrakes.size();
-    SimBuffer::NodeSB* nodes = m_simbuf.simbuf_nodes.get();
+    SimBuffer::NodeSB* nodes = m_simbuf.simbuf_nodes;
     for (size_t i=0; i<num_airbrakes; ++i)
     {
         AirbrakeGfx abx = m_gfx_airbrakes[i];
@@ -2026,7 +2075,7 @@ void RoR::GfxActor::UpdateAirbrakes()
 void RoR::GfxActor::UpdateCParticles()
 {
     //update custom particle systems
-    SimBuffer::NodeSB* nodes = m_simbuf.simbuf_nodes.get();
+    SimBuffer::NodeSB* nodes = m_simbuf.simbuf_nodes;
     for (int i = 0; i < m_actor->ar_num_custom_particles; i++)
     {
         Ogre::Vector3 pos = nodes[m_actor->ar_custom_particles[i].emitterNode].AbsPosition;
@@ -3143,6 +3192,7 @@ void RoR::GfxActor::UpdateFlexbodies()
         {
             auto func = std::function<void()>([fb]()
                 {
+                    ROR_PROFILE_SCOPE(GFX_FLEXBODIES);
                     fb->ComputeFlexbody();
                 });
             auto task_handle = App::GetThreadPool()->RunTask(func);
@@ -3173,6 +3223,7 @@ void RoR::GfxActor::SetFlexbodyVisible(bool visible)
 
 void RoR::GfxActor::FinishFlexbodyTasks()
 {
+    ROR_PROFILE_EVENT("FinishFlexbodyTasks");
     for (auto& task: m_flexbody_tasks)
     {
         task->join();
@@ -80,6 +80,14 @@ public:
             bool nd_is_wet:1;
         };
 
+        struct RodSB /// Endpoints of a `Rod`; they change when hooks, ties or ropes lock onto another actor
+        {
+            uint16_t rod_node1;
+            uint16_t rod_node2;
+            Actor*   rod_target_actor;
+            bool     rod_is_visible;
+        };
+
         struct ScrewPropSB
         {
             float simbuf_sp_rudder;
@@ -111,7 +119,8 @@ public:
             float simbuf_ab_ratio;
         };
 
-        std::unique_ptr<NodeSB>     simbuf_nodes;
+        NodeSB*                     simbuf_nodes = nullptr;  //!< Points into `Actor::m_sim_snapshot`, see `UpdateSimDataBuffer()`
+        std::vector<Actor*>         simbuf_linked_actors;
         Ogre::Vector3               simbuf_pos                = Ogre::Vector3::ZERO;
         Ogre::Vector3               simbuf_node0_velo         = Ogre::Vector3::ZERO;
         bool                        simbuf_live_local         = false;
@@ -164,6 +173,25 @@ public:
         float                       simbuf_ap_ils_vdev        = 0;
         float                       simbuf_ap_ils_hdev        = 0;
         int                         simbuf_ap_vs_value        = 0;
+        // Player actor only, see `SimActorStats`
+        float                       simbuf_mass               = 0;
+        int                         simbuf_num_beams          = 0;
+        int                         simbuf_beams_broken       = 0;
+        int                         simbuf_beams_deformed     = 0;
+        float                       simbuf_beams_stress       = 0;
+        float                       simbuf_beams_avg_deform   = 0;
+        Ogre::Vector3               simbuf_gforces_cur        = Ogre::Vector3::ZERO;
+        Ogre::Vector3               simbuf_gforces_max        = Ogre::Vector3::ZERO;
+        ground_model_t*             simbuf_last_fuzzy_ground_model = nullptr;
+    };
+
+    /// Published by `Actor::PublishSimSnapshot()` at the end of each physics step, acquired by `UpdateSimDataBuffer()`.
+    /// Lets the main thread buffer the last completed step while the next one is running (cvar 'app_pipelined_physics').
+    struct SimSnapshot
+    {
+        std::vector<SimBuffer::NodeSB> nodes;
+        std::vector<SimBuffer::RodSB>  rods;  //!< Parallel to `GfxActor::m_rods`
+        SimBuffer                      state; //!< Filled by `CaptureSimState()`; `simbuf_nodes` unused
     };
 
     struct Attributes    //!< Actor visual attributes
@@ -201,7 +229,8 @@ public:
     bool                      IsActorLive        () const; //!< Should the visuals be updated for this actor?
     bool                      IsActorInitialized () const  { return m_initialized; } //!< Temporary TODO: Remove once the spawn routine is fixed
     void                      InitializeActor    ()        { m_initialized = true; } //!< Temporary TODO: Remove once the spawn routine is fixed
-    void                      UpdateSimDataBuffer(); //!< Copies sim. data from `Actor` to `GfxActor` for later update
+    void                      UpdateSimDataBuffer(); //!< Copies sim. data from `Actor` to `GfxActor` for later update; from the last snapshot while physics runs
+    void                      CaptureSimState    (SimBuffer& dst) const; //!< Reads the live `Actor`; physics thread, or main thread while physics is halted
     void                      SetWheelVisuals    (uint16_t index, WheelGfx wheel_gfx);
     void                      CalculateDriverPos (Ogre::Vector3& out_pos, Ogre::Quaternion& out_rot);
     void                      UpdateWheelVisuals ();
@@ -237,7 +266,8 @@ public:
     inline VideoCamState      GetVideoCamState   () const                 { return m_vidcam_state; }
     inline DebugViewType      GetDebugView       () const                 { return m_debug_view; }
     SimBuffer &               GetSimDataBuffer   ()                       { return m_simbuf; }
-    SimBuffer::NodeSB*        GetSimNodeBuffer   ()                       { return m_simbuf.simbuf_nodes.get(); }
+    SimBuffer::NodeSB*        GetSimNodeBuffer   ()                       { return m_simbuf.simbuf_nodes; }
+    const std::vector<Rod>&   GetRods            () const                 { return m_rods; }
     std::set<GfxActor*>       GetLinkedGfxActors ()                       { return m_linked_gfx_actors; }
     Ogre::String              GetResourceGroup   ()                       { return m_custom_resource_group; }
     std::string               FetchActorDesignName() const;
@@ -36,6 +36,8 @@
 #include "TerrainGeometryManager.h"
 #include "TerrainManager.h"
 #include "TerrainObjectManager.h"
+#include "Profiler.h"
+#include "ThreadPool.h"
 
 #include <Ogre.h>
 
@@ -51,11 +53,13 @@ void GfxScene::CreateDustPools()
     m_dustpools["drip"]   = new DustPool(m_scene_manager, "tracks/Drip",   50);
     m_dustpools["splash"] = new DustPool(m_scene_manager, "tracks/Splash", 20);
     m_dustpools["ripple"] = new DustPool(m_scene_manager, "tracks/Ripple", 20);
+    m_dust_spawn_queue.Resize(App::GetThreadPool()->GetNumWorkers());
 }
 
 void GfxScene::ClearScene()
 {
     // Delete dustpools
+    m_dust_spawn_queue.DiscardAll();
     for (auto itor : m_dustpools)
     {
         itor.second->Discard(m_scene_manager);
@@ -85,6 +89,8 @@ void RoR::GfxScene::Init()
 
 void RoR::GfxScene::UpdateScene(float dt_sec)
 {
+    ROR_PROFILE_EVENT("UpdateScene");
+
     // Actors - start threaded tasks
     for (GfxActor* gfx_actor: m_live_gfx_actors)
     {
@@ -110,6 +116,7 @@ void RoR::GfxScene::UpdateScene(float dt_sec)
     }
 
     // Particles
+    m_dust_spawn_queue.SpawnAll(); // Requested by physics
     if (App::gfx_particles_mode->GetInt() == 1)
     {
         for (GfxActor* gfx_actor: m_all_gfx_actors)
@@ -26,6 +26,7 @@
 #pragma once
 
 #include "CameraManager.h"
+#include "DustPool.h"
 #include "ForwardDeclarations.h"
 #include "EnvironmentMap.h" // RoR::GfxEnvmap
 #include "Skidmark.h"
@@ -65,6 +66,7 @@ public:
     void           Init();
     void           CreateDustPools();
     DustPool*      GetDustPool(const char* name);
+    DustSpawnQueue& GetDustSpawnQueue() { return m_dust_spawn_queue; } //!< For physics; see `DustSpawnQueue`
     void           SetParticlesVisible(bool visible);
     void           UpdateScene(float dt_sec);
     void           ClearScene();
@@ -83,6 +85,7 @@ public:
 private:
 
     std::map<std::string, DustPool *> m_dustpools;
+    DustSpawnQueue                    m_dust_spawn_queue;
     Ogre::SceneManager*               m_scene_manager = nullptr;
     std::vector<GfxActor*>            m_all_gfx_actors;
     std::vector<GfxActor*>            m_live_gfx_actors;
@@ -42,6 +42,20 @@ public:
     virtual void           SetWaterBottomHeight(float value) {};
     virtual float          CalcWavesHeight(Ogre::Vector3 pos) = 0;
     virtual Ogre::Vector3  CalcWavesVelocity(Ogre::Vector3 pos) = 0;
+    virtual float          GetMaxWaterHeight() { return this->GetStaticWaterHeight(); } //!< Physics: no wave reaches above this
+
+    /// Physics: wave height (and velocity, unless null) at `count` points at sim time `time_sec`.
+    /// Default evaluates the points one by one and ignores the time.
+    virtual void           CalcWavesBatch(double time_sec, const Ogre::Vector3* pos, size_t count, float* out_height, Ogre::Vector3* out_velocity)
+    {
+        for (size_t i = 0; i < count; i++)
+        {
+            out_height[i] = this->CalcWavesHeight(pos[i]);
+            if (out_velocity)
+                out_velocity[i] = this->CalcWavesVelocity(pos[i]);
+        }
+    }
+
     virtual void           SetWaterVisible(bool value) = 0;
     virtual void           WaterSetSunPosition(Ogre::Vector3) {}
     virtual bool           IsUnderWater(Ogre::Vector3 pos) = 0;
@@ -21,8 +21,10 @@
 
 #include "Water.h"
 
+#include "ActorManager.h"
 #include "AppContext.h"
 #include "CameraManager.h"
+#include "GameContext.h"
 #include "GfxScene.h"
 #include "PlatformUtils.h" // PathCombine
 #include "TerrainManager.h"
@@ -36,7 +38,6 @@ static const int WAVEREZ = 100;
 
 Water::Water(Ogre::Vector3 terrn_size) :
     m_map_size(terrn_size),
-    m_max_ampl(0),
     m_water_visible(true),
     m_waterplane_mesh_scale(1.0f),
     m_refract_rtt_viewport(0),
@@ -73,23 +74,14 @@ Water::Water(Ogre::Vector3 terrn_size) :
             if (res < 4)
                 continue;
 
-            WaveTrain wavetrain;
-            wavetrain.wavelength = wl;
-            wavetrain.amplitude = amp;
-            wavetrain.maxheight = mx;
-            wavetrain.direction = dir / 57.0;
-            wavetrain.dir_sin = sin(wavetrain.direction);
-            wavetrain.dir_cos = cos(wavetrain.direction);
-
-            m_wavetrain_defs.push_back(wavetrain);
+            if (!m_wavefield.AddWaveTrain(wl, amp, mx, dir / 57.0))
+            {
+                LOG(fmt::format("[RoR|Water] Ignoring wave train '{}', either invalid or too many (max {})", line, static_cast<int>(Wavefield::MAX_TRAINS)));
+            }
         }
         fclose(fd);
     }
-    for (size_t i = 0; i < m_wavetrain_defs.size(); i++)
-    {
-        m_wavetrain_defs[i].wavespeed = 1.25 * sqrt(m_wavetrain_defs[i].wavelength);
-        m_max_ampl += m_wavetrain_defs[i].maxheight;
-    }
+    m_wavefield.SetCalmCenter((m_map_size.x * m_waterplane_mesh_scale) * 0.5f, (m_map_size.z * m_waterplane_mesh_scale) * 0.5f);
 
     this->PrepareWater();
 }
@@ -372,11 +364,20 @@ void Water::ShowWave(Vector3 refpos)
     float xScaled = m_map_size.x * m_waterplane_mesh_scale;
     float zScaled = m_map_size.z * m_waterplane_mesh_scale;
 
+    // Heights, one row at a time
+    Vector3 row_pos[WAVEREZ + 1];
+    float row_height[WAVEREZ + 1];
+    const double time_sec = this->GetWavesTime();
     for (int pz = 0; pz < WAVEREZ + 1; pz++)
     {
         for (int px = 0; px < WAVEREZ + 1; px++)
         {
-            m_waterplane_vert_buf_local[(pz * (WAVEREZ + 1) + px) * 8 + 1] = CalcWavesHeight(refpos + Vector3(xScaled * 0.5 - (float)px * xScaled / WAVEREZ, 0, (float)pz * zScaled / WAVEREZ - zScaled * 0.5)) - m_water_height;
+            row_pos[px] = refpos + Vector3(xScaled * 0.5 - (float)px * xScaled / WAVEREZ, 0, (float)pz * zScaled / WAVEREZ - zScaled * 0.5);
+        }
+        this->CalcWavesBatch(time_sec, row_pos, WAVEREZ + 1, row_height, nullptr);
+        for (int px = 0; px < WAVEREZ + 1; px++)
+        {
+            m_waterplane_vert_buf_local[(pz * (WAVEREZ + 1) + px) * 8 + 1] = row_height[px] - m_water_height;
         }
     }
 
@@ -502,6 +503,7 @@ float Water::GetStaticWaterHeight()
 void Water::SetStaticWaterHeight(float value)
 {
     m_water_height = value;
+    m_wavefield.SetSeaLevel(value);
     m_waterplane_force_update_pos = true;
 }
 
@@ -513,33 +515,33 @@ void Water::SetWaterBottomHeight(float value)
 float Water::CalcWavesHeight(Vector3 pos)
 {
     // no waves?
-    if (!RoR::App::gfx_water_waves->GetBool() || RoR::App::mp_state->GetEnum<MpState>() == RoR::MpState::CONNECTED)
+    if (!this->AreWavesEnabled())
     {
         // constant height, sea is flat as pancake
         return m_water_height;
     }
 
-    const float time_sec = (float)(App::GetAppContext()->GetOgreRoot()->getTimer()->getMilliseconds() * 0.001);
+    return m_wavefield.CalcHeight(this->GetWavesTime(), pos.x, pos.y, pos.z);
+}
 
-    // uh, some upper limit?!
-    if (pos.y > m_water_height + m_max_ampl)
-        return m_water_height;
+float Water::GetMaxWaterHeight()
+{
+    return (this->AreWavesEnabled()) ? (m_water_height + m_wavefield.GetMaxAmplitude()) : m_water_height;
+}
 
-    float waveheight = GetWaveHeight(pos);
-    // we will store the result in this variable, init it with the default height
-    float result = m_water_height;
-    // now walk through all the wave trains. One 'train' is one sin/cos set that will generate once wave. All the trains together will sum up, so that they generate a 'rough' sea
-    for (size_t i = 0; i < m_wavetrain_defs.size(); i++)
+void Water::CalcWavesBatch(double time_sec, const Ogre::Vector3* pos, size_t count, float* out_height, Ogre::Vector3* out_velocity)
+{
+    static_assert(sizeof(Ogre::Vector3) == 3 * sizeof(float), "Wavefield needs packed float triplets");
+
+    if (!this->AreWavesEnabled())
     {
-        // calculate the amplitude that this wave will have. wavetrains[i].amplitude is read from the config
-        // upper limit: prevent too big waves by setting an upper limit
-        float amp = std::min(m_wavetrain_defs[i].amplitude * waveheight, m_wavetrain_defs[i].maxheight);
-        // now the main thing:
-        // calculate the sinus with the values of the config file and add it to the result
-        result += amp * sin(Math::TWO_PI * ((time_sec * m_wavetrain_defs[i].wavespeed + m_wavetrain_defs[i].dir_sin * pos.x + m_wavetrain_defs[i].dir_cos * pos.z) / m_wavetrain_defs[i].wavelength));
+        std::fill(out_height, out_height + count, m_water_height);
+        if (out_velocity)
+            std::fill(out_velocity, out_velocity + count, Vector3::ZERO);
+        return;
     }
-    // return the summed up waves
-    return result;
+
+    m_wavefield.CalcBatch(time_sec, &pos[0].x, count, out_height, (out_velocity) ? &out_velocity[0].x : nullptr);
 }
 
 bool Water::IsUnderWater(Vector3 pos)
@@ -550,7 +552,7 @@ bool Water::IsUnderWater(Vector3 pos)
     {
         float waveheight = GetWaveHeight(pos);
 
-        if (pos.y > m_water_height + m_max_ampl * waveheight || pos.y > m_water_height + m_max_ampl)
+        if (pos.y > m_water_height + m_wavefield.GetMaxAmplitude() * waveheight || pos.y > m_water_height + m_wavefield.GetMaxAmplitude())
             return false;
 
         waterheight = CalcWavesHeight(pos);
@@ -561,28 +563,24 @@ bool Water::IsUnderWater(Vector3 pos)
 
 Vector3 Water::CalcWavesVelocity(Vector3 pos)
 {
-    if (!RoR::App::gfx_water_waves->GetBool() || RoR::App::mp_state->GetEnum<MpState>() == RoR::MpState::CONNECTED)
+    if (!this->AreWavesEnabled())
         return Vector3::ZERO;
 
-    float waveheight = GetWaveHeight(pos);
-
-    if (pos.y > m_water_height + m_max_ampl)
-        return Vector3::ZERO;
-
-    Vector3 result(Vector3::ZERO);
-
-    const float time_sec = (float)(App::GetAppContext()->GetOgreRoot()->getTimer()->getMilliseconds() * 0.001);
+    Vector3 result;
+    m_wavefield.CalcVelocity(this->GetWavesTime(), pos.x, pos.y, pos.z, &result.x);
+    return result;
+}
 
-    for (size_t i = 0; i < m_wavetrain_defs.size(); i++)
-    {
-        float amp = std::min(m_wavetrain_defs[i].amplitude * waveheight, m_wavetrain_defs[i].maxheight);
-        float speed = Math::TWO_PI * amp / (m_wavetrain_defs[i].wavelength / m_wavetrain_defs[i].wavespeed);
-        float coeff = Math::TWO_PI * (time_sec * m_wavetrain_defs[i].wavespeed + m_wavetrain_defs[i].dir_sin * pos.x + m_wavetrain_defs[i].dir_cos * pos.z) / m_wavetrain_defs[i].wavelength;
-        result.y += speed * cos(coeff);
-        result += Vector3(m_wavetrain_defs[i].dir_sin, 0, m_wavetrain_defs[i].dir_cos) * speed * sin(coeff);
-    }
+bool Water::AreWavesEnabled()
+{
+    return RoR::App::gfx_water_waves->GetBool() && RoR::App::mp_state->GetEnum<MpState>() != RoR::MpState::CONNECTED;
+}
 
-    return result;
+double Water::GetWavesTime()
+{
+    // Sim time - the waves stop on pause and slow down in slow motion, like the physics which runs on them.
+    // Same clock as buoyancy (`ActorManager::GetPhysicsTime()`), as seen from the main thread.
+    return App::GetGameContext()->GetActorManager()->GetTotalTime();
 }
 
 void Water::UpdateReflectionPlane(float h)
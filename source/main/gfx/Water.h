@@ -23,6 +23,7 @@
 
 #include "IWater.h"
 #include "Application.h"
+#include "Wavefield.h"
 
 #include <OgreHardwareVertexBuffer.h> // Ogre::HardwareVertexBufferSharedPtr
 #include <OgreMesh.h>
@@ -47,6 +48,8 @@ public:
     void           SetWaterBottomHeight(float value) override;
     float          CalcWavesHeight(Ogre::Vector3 pos) override;
     Ogre::Vector3  CalcWavesVelocity(Ogre::Vector3 pos) override;
+    float          GetMaxWaterHeight() override;
+    void           CalcWavesBatch(double time_sec, const Ogre::Vector3* pos, size_t count, float* out_height, Ogre::Vector3* out_velocity) override;
     void           SetWaterVisible(bool value) override;
     bool           IsUnderWater(Ogre::Vector3 pos) override;
     void           SetReflectionPlaneHeight(float centerheight) override;
@@ -59,17 +62,6 @@ public:
 
 private:
 
-    struct WaveTrain
-    {
-        float amplitude;
-        float maxheight;
-        float wavelength;
-        float wavespeed;
-        float direction;
-        float dir_sin;
-        float dir_cos;
-    };
-
     struct ReflectionListener: Ogre::RenderTargetListener
     {
         ReflectionListener(): scene_mgr(nullptr), waterplane_entity(nullptr) {}
@@ -93,6 +85,8 @@ private:
     };
 
     float          GetWaveHeight(Ogre::Vector3 pos);
+    bool           AreWavesEnabled();
+    double         GetWavesTime();               //!< Sim time of the last physics frame, for queries without a time
     void           ShowWave(Ogre::Vector3 refpos);
     bool           IsCameraUnderWater();
     void           PrepareWater();
@@ -100,7 +94,6 @@ private:
     bool                  m_water_visible;
     float                 m_water_height;
     float                 m_bottom_height;
-    float                 m_max_ampl;
     float                 m_waterplane_mesh_scale;
     int                   m_frame_counter;
     Ogre::Vector3         m_map_size;
@@ -125,7 +118,7 @@ private:
     Ogre::Viewport*       m_reflect_rtt_viewport;
     Ogre::SceneNode*      m_bottomplane_node;
     Ogre::Plane           m_bottom_plane;
-    std::vector<WaveTrain>  m_wavetrain_defs;
+    Wavefield             m_wavefield;
 
     // Forced camera transforms, used by UpdateWater()
     bool                  m_cam_forced;
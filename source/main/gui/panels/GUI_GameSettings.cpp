@@ -224,6 +224,7 @@ void GameSettings::DrawGeneralSettings()
 
     DrawGCheckbox(App::app_skip_main_menu, _LC("GameSettings", "Skip main menu"));
     DrawGCheckbox(App::app_async_physics, _LC("GameSettings", "Async physics"));
+    DrawGCheckbox(App::app_pipelined_physics, _LC("GameSettings", "Pipelined physics (experimental)"));
     DrawGCheckbox(App::app_disable_online_api, _LC("GameSettings", "Disable online api"));
 
     if (ImGui::Button(_LC("GameSettings", "Update cache")))
@@ -265,6 +266,7 @@ void GameSettings::DrawGameplaySettings()
 
     DrawGCheckbox(App::sim_no_self_collisions, _LC("GameSettings", "No intra truck collisions"));
     DrawGCheckbox(App::sim_no_collisions, _LC("GameSettings", "No inter truck collisions"));
+    DrawGCheckbox(App::sim_island_dozing, _LC("GameSettings", "Reduced physics rate for resting vehicles"));
 
     DrawGCheckbox(App::io_discord_rpc, _LC("GameSettings", "Discord Rich Presence"));
 
@@ -423,6 +425,7 @@ void GameSettings::DrawDiagSettings()
     DrawGCheckbox(App::diag_log_beam_break,      _LC("GameSettings", "Log beam breaking"));
     DrawGCheckbox(App::diag_log_beam_deform,     _LC("GameSettings", "Log beam deforming"));
     DrawGCheckbox(App::diag_log_beam_trigger,    _LC("GameSettings", "Log beam triggers"));
+    DrawGCheckbox(App::diag_cache_json,          _LC("GameSettings", "Mod cache as JSON (debug)"));
     if (ImGui::Button(_LC("GameSettings", "Rebuild cache")))
     {
         App::GetGuiManager()->SetVisible_GameSettings(false);
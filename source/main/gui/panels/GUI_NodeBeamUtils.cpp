@@ -22,6 +22,7 @@
 
 #include "Application.h"
 #include "Actor.h"
+#include "ActorManager.h"
 #include "GameContext.h"
 #include "GUIManager.h"
 #include "Language.h"
@@ -38,6 +39,9 @@ void NodeBeamUtils::Draw()
         return;
     }
 
+    // Every widget here tweaks the live actor; physics may be running (cvar 'app_pipelined_physics')
+    App::GetGameContext()->GetActorManager()->SyncWithSimThread();
+
     const int flags = ImGuiWindowFlags_NoCollapse;
     ImGui::SetNextWindowSize(ImVec2(600.f, 675.f), ImGuiCond_FirstUseEver);
     bool keep_open = true;
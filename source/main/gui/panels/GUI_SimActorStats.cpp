@@ -223,39 +223,25 @@ void SimActorStats::Draw(RoR::GfxActor* actorx)
     ImGui::End();
 }
 
-void SimActorStats::UpdateStats(float dt, Actor* actor)
+void SimActorStats::UpdateStats(float dt, RoR::GfxActor* actorx)
 {
-    //taken from TruckHUD.cpp (now removed)
-    beam_t* beam = actor->ar_beams;
-    float average_deformation = 0.0f;
-    float beamstress = 0.0f;
-    float mass = actor->getTotalMass();
-    int beambroken = 0;
-    int beamdeformed = 0;
-    Ogre::Vector3 gcur = actor->GetGForcesCur();
-    Ogre::Vector3 gmax = actor->GetGForcesMax();
-
-    for (int i = 0; i < actor->ar_num_beams; i++ , beam++)
+    // Summed up by `GfxActor::CaptureSimState()`, taken from TruckHUD.cpp (now removed)
+    const GfxActor::SimBuffer& simbuf = actorx->GetSimDataBuffer();
+    if (simbuf.simbuf_num_beams == 0)
     {
-        if (beam->bm_broken != 0)
-        {
-            beambroken++;
-        }
-        beamstress += std::abs(beam->stress);
-        float current_deformation = fabs(beam->L - beam->refL);
-        if (fabs(current_deformation) > 0.0001f && beam->bm_type != BEAM_HYDRO)
-        {
-            beamdeformed++;
-        }
-        average_deformation += current_deformation;
+        return; // Not captured yet
     }
+    const int beambroken = simbuf.simbuf_beams_broken;
+    const int beamdeformed = simbuf.simbuf_beams_deformed;
+    const Ogre::Vector3 gcur = simbuf.simbuf_gforces_cur;
+    const Ogre::Vector3 gmax = simbuf.simbuf_gforces_max;
 
-    m_stat_health = ((float)beambroken / (float)actor->ar_num_beams) * 10.0f + ((float)beamdeformed / (float)actor->ar_num_beams);
+    m_stat_health = ((float)beambroken / (float)simbuf.simbuf_num_beams) * 10.0f + ((float)beamdeformed / (float)simbuf.simbuf_num_beams);
     m_stat_broken_beams = beambroken;
     m_stat_deformed_beams = beamdeformed;
-    m_stat_beam_stress = beamstress;
-    m_stat_mass_Kg = mass;
-    m_stat_avg_deform = average_deformation;
+    m_stat_beam_stress = simbuf.simbuf_beams_stress;
+    m_stat_mass_Kg = simbuf.simbuf_mass;
+    m_stat_avg_deform = simbuf.simbuf_beams_avg_deform;
     m_stat_gcur_x = gcur.x;
     m_stat_gcur_y = gcur.y;
     m_stat_gcur_z = gcur.z;
@@ -24,7 +24,9 @@
 #include "AppContext.h"
 #include "GUIManager.h"
 #include "Language.h"
+#include "Profiler.h"
 
+#include <algorithm>
 #include <imgui.h>
 #include <Ogre.h>
 
@@ -50,6 +52,71 @@ void SimPerfStats::Draw()
     ImGui::Text("%s%zu", _LC("SimPerfStats", "Triangle count: "), stats.triangleCount);
     ImGui::Text("%s%zu", _LC("SimPerfStats", "Batch count: "),    stats.batchCount);
 
+#ifdef ROR_PROFILER
+    ImGui::Separator();
+    this->DrawProfilerBreakdown();
+#endif
+
     ImGui::End();
     ImGui::PopStyleColor(1); // WindowBg
 }
+
+void SimPerfStats::DrawProfilerBreakdown()
+{
+    const Profiler::FrameStats avg = Profiler::GetAverage(PROFILER_AVG_FRAMES);
+    const double frame_ms = avg.zone_ms[static_cast<size_t>(ProfilerZone::FRAME)];
+    if (frame_ms <= 0.0)
+    {
+        return;
+    }
+
+    // Flame graph: one row per depth, children laid out left to right inside their parent.
+    // Zones which run on several threads may have more CPU time than their parent has wall time; they're clipped.
+    const float width = 400.f;
+    const float row_height = ImGui::GetTextLineHeightWithSpacing();
+    const ImVec2 origin = ImGui::GetCursorScreenPos();
+    ImDrawList* drawlist = ImGui::GetWindowDrawList();
+    float zone_x[Profiler::NUM_ZONES] = {};
+    float zone_w[Profiler::NUM_ZONES] = {};
+    float next_child_x[Profiler::NUM_ZONES] = {};
+    int max_depth = 0;
+    for (size_t z = 0; z < Profiler::NUM_ZONES; z++)
+    {
+        const ProfilerZone zone = static_cast<ProfilerZone>(z);
+        const int depth = Profiler::GetZoneDepth(zone);
+        if (zone == ProfilerZone::FRAME)
+        {
+            zone_w[z] = width;
+        }
+        else
+        {
+            const size_t parent = static_cast<size_t>(Profiler::GetZoneParent(zone));
+            zone_x[z] = next_child_x[parent];
+            const float space = zone_x[parent] + zone_w[parent] - zone_x[z];
+            zone_w[z] = std::max(0.f, std::min(space, static_cast<float>(avg.zone_ms[z] / frame_ms) * width));
+            next_child_x[parent] += zone_w[z];
+        }
+        next_child_x[z] = zone_x[z];
+        max_depth = std::max(max_depth, depth);
+
+        if (zone_w[z] < 1.f)
+            continue;
+
+        const ImVec2 min(origin.x + zone_x[z], origin.y + depth * row_height);
+        const ImVec2 max(min.x + zone_w[z] - 1.f, min.y + row_height - 1.f);
+        const ImU32 color = ImColor(ImVec4(0.9f, 0.7f - 0.12f * depth, 0.2f, 0.8f));
+        drawlist->AddRectFilled(min, max, color);
+        drawlist->PushClipRect(min, max, true);
+        drawlist->AddText(ImVec2(min.x + 2.f, min.y), ImColor(0.f, 0.f, 0.f, 1.f), Profiler::GetZoneName(zone));
+        drawlist->PopClipRect();
+    }
+    ImGui::Dummy(ImVec2(width, (max_depth + 1) * row_height));
+
+    for (size_t z = 0; z < Profiler::NUM_ZONES; z++)
+    {
+        const ProfilerZone zone = static_cast<ProfilerZone>(z);
+        ImGui::Text("%*s%s", 2 * Profiler::GetZoneDepth(zone), "", Profiler::GetZoneName(zone));
+        ImGui::SameLine(200.f);
+        ImGui::Text("%7.3f ms  %5ux", avg.zone_ms[z], avg.zone_calls[z]);
+    }
+}
@@ -21,6 +21,8 @@
 
 #pragma once
 
+#include <cstddef>
+
 namespace RoR {
 namespace GUI {
 
@@ -33,6 +35,10 @@ public:
     void Draw();
 
 private:
+    void DrawProfilerBreakdown(); //!< Only with CMake option USE_PROFILER
+
+    static const size_t PROFILER_AVG_FRAMES = 30;
+
     bool         m_is_visible = false;
 };
 
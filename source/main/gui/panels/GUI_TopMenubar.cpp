@@ -254,6 +254,7 @@ void TopMenubar::Update()
 
                 if (ImGui::Button(_LC("TopMenubar", "Activate all vehicles")))
                 {
+                    App::GetGameContext()->GetActorManager()->SyncWithSimThread(); // Physics may be running, see cvar 'app_pipelined_physics'
                     App::GetGameContext()->GetActorManager()->WakeUpAllActors();
                 }
 
@@ -265,6 +266,7 @@ void TopMenubar::Update()
 
                 if (ImGui::Button(_LC("TopMenubar", "Send all vehicles to sleep")))
                 {
+                    App::GetGameContext()->GetActorManager()->SyncWithSimThread();
                     App::GetGameContext()->GetActorManager()->SendAllActorsSleeping();
                 }
             }
@@ -346,6 +348,7 @@ void TopMenubar::Update()
         {
             if (ImGui::Button(_LC("TopMenubar", "Quicksave")))
             {
+                App::GetGameContext()->GetActorManager()->SyncWithSimThread();
                 App::GetGameContext()->GetActorManager()->SaveScene(m_quicksave_name);
                 m_open_menu = TopMenu::TOPMENU_NONE;
             }
@@ -356,6 +359,7 @@ void TopMenubar::Update()
             {
                 if (ImGui::Button(_LC("TopMenubar", "Quickload")))
                 {
+                    App::GetGameContext()->GetActorManager()->SyncWithSimThread();
                     App::GetGameContext()->GetActorManager()->LoadScene(m_quicksave_name);
                     m_open_menu = TopMenu::TOPMENU_NONE;
                 }
@@ -377,6 +381,7 @@ void TopMenubar::Update()
                 if (ImGui::Button(caption.c_str()))
                 {
                     Ogre::String filename = Ogre::StringUtil::format("quicksave-%d.sav", i);
+                    App::GetGameContext()->GetActorManager()->SyncWithSimThread();
                     App::GetGameContext()->GetActorManager()->SaveScene(filename);
                     m_open_menu = TopMenu::TOPMENU_NONE;
                 }
@@ -769,7 +774,7 @@ void TopMenubar::DrawActorListSinglePlayer()
             ImGui::SameLine();
 
             std::string text_buf = fmt::format( "[{}] {}", i++, actor->ar_design_name.c_str());
-            auto linked_actors = actor->GetAllLinkedActors();
+            const std::vector<Actor*>& linked_actors = actor->GetGfxActor()->GetSimDataBuffer().simbuf_linked_actors;
             if (actor == player_actor)
             {
                 ImGui::PushStyleColor(ImGuiCol_Text, GREEN_TEXT);
@@ -46,6 +46,7 @@
 #include "OutGauge.h"
 #include "OverlayWrapper.h"
 #include "PlatformUtils.h"
+#include "Profiler.h"
 #include "RoRVersion.h"
 #include "ScriptEngine.h"
 #include "Skidmark.h"
@@ -57,6 +58,7 @@
 #include <iomanip>
 #include <string>
 #include <fstream>
+#include <functional>
 
 #ifdef USE_CURL
 #   include <curl/curl.h>
@@ -280,20 +282,43 @@ int main(int argc, char *argv[])
         // --------------------------------------------------------------
 
         auto start_time = std::chrono::high_resolution_clock::now();
+        ROR_PROFILE_THREAD_NAME("Main");
 
         while (App::app_state->GetEnum<AppState>() != AppState::SHUTDOWN)
         {
+            Profiler::EndFrame(); // Previous iteration; see CMake option USE_PROFILER
+            ROR_PROFILE_SCOPE(FRAME);
+
             OgreBites::WindowEventUtilities::messagePump();
 
             // Halt physics (wait for async tasks to finish)
-            if (App::app_state->GetEnum<AppState>() == AppState::SIMULATION)
+            // Pipelined mode only halts for game events (see below) and networking; other work which reads or modifies actors
+            // is queued and runs once the physics of the previous frame is done - see `sim_work()` below. The GUI and
+            // `BufferSimulationData()` don't wait; they read the snapshots published by the last completed step.
+            const bool pipelined_physics = App::app_async_physics->GetBool() && App::app_pipelined_physics->GetBool() &&
+                App::sim_state->GetEnum<SimState>() == SimState::RUNNING;
+            if (App::app_state->GetEnum<AppState>() == AppState::SIMULATION &&
+                (!pipelined_physics || App::mp_state->GetEnum<MpState>() == MpState::CONNECTED))
             {
                 App::GetGameContext()->GetActorManager()->SyncWithSimThread();
             }
+            auto sim_work = [pipelined_physics](ActorManager::SimCommandFunc func, float dt)
+            {
+                if (pipelined_physics)
+                    App::GetGameContext()->GetActorManager()->QueueSimCommand(func, dt);
+                else
+                    func(dt);
+            };
 
             // Game events
             while (App::GetGameContext()->HasMessages())
             {
+                // Physics posts messages too (e.g. MSG_SIM_MODIFY_ACTOR_REQUESTED), so it may still be running here
+                // in pipelined mode - halt it before handling any message. No-op if it's halted already.
+                if (App::app_state->GetEnum<AppState>() == AppState::SIMULATION)
+                {
+                    App::GetGameContext()->GetActorManager()->SyncWithSimThread();
+                }
                 Message m = App::GetGameContext()->PopMessage();
                 bool failed_m = false;
                 switch (m.type)
@@ -770,75 +795,84 @@ int main(int argc, char *argv[])
 
                 if (App::app_state->GetEnum<AppState>() == AppState::SIMULATION)
                 {
-                    App::GetCameraManager()->UpdateInputEvents(dt);
-                    App::GetOverlayWrapper()->update(dt);
-                    if (App::sim_state->GetEnum<SimState>() == SimState::EDITOR_MODE)
+                    sim_work([](float dt)
                     {
-                        App::GetGameContext()->UpdateSimInputEvents(dt);
-                        App::GetGameContext()->UpdateSkyInputEvents(dt);
-                        App::GetSimTerrain()->GetTerrainEditor()->UpdateInputEvents(dt);
-                    }
-                    else if (App::sim_state->GetEnum<SimState>() == SimState::RUNNING)
-                    {
-                        App::GetGameContext()->GetCharacterFactory()->Update(dt);
-                        if (App::GetCameraManager()->GetCurrentBehavior() != CameraManager::CAMERA_BEHAVIOR_FREE)
+                        App::GetCameraManager()->UpdateInputEvents(dt);
+                        App::GetOverlayWrapper()->update(dt);
+                        if (App::sim_state->GetEnum<SimState>() == SimState::EDITOR_MODE)
                         {
                             App::GetGameContext()->UpdateSimInputEvents(dt);
                             App::GetGameContext()->UpdateSkyInputEvents(dt);
-                            if (App::GetGameContext()->GetPlayerActor() &&
-                                App::GetGameContext()->GetPlayerActor()->ar_sim_state != Actor::SimState::NETWORKED_OK) // we are in a vehicle
+                            App::GetSimTerrain()->GetTerrainEditor()->UpdateInputEvents(dt);
+                        }
+                        else if (App::sim_state->GetEnum<SimState>() == SimState::RUNNING)
+                        {
+                            App::GetGameContext()->GetCharacterFactory()->Update(dt);
+                            if (App::GetCameraManager()->GetCurrentBehavior() != CameraManager::CAMERA_BEHAVIOR_FREE)
                             {
-                                App::GetGameContext()->UpdateCommonInputEvents(dt);
-                                if (App::GetGameContext()->GetPlayerActor()->ar_sim_state != Actor::SimState::LOCAL_REPLAY)
+                                App::GetGameContext()->UpdateSimInputEvents(dt);
+                                App::GetGameContext()->UpdateSkyInputEvents(dt);
+                                if (App::GetGameContext()->GetPlayerActor() &&
+                                    App::GetGameContext()->GetPlayerActor()->ar_sim_state != Actor::SimState::NETWORKED_OK) // we are in a vehicle
                                 {
-                                    if (App::GetGameContext()->GetPlayerActor()->ar_driveable == TRUCK)
-                                    {
-                                        App::GetGameContext()->UpdateTruckInputEvents(dt);
-                                    }
-                                    if (App::GetGameContext()->GetPlayerActor()->ar_driveable == AIRPLANE)
-                                    {
-                                        App::GetGameContext()->UpdateAirplaneInputEvents(dt);
-                                    }
-                                    if (App::GetGameContext()->GetPlayerActor()->ar_driveable == BOAT)
+                                    App::GetGameContext()->UpdateCommonInputEvents(dt);
+                                    if (App::GetGameContext()->GetPlayerActor()->ar_sim_state != Actor::SimState::LOCAL_REPLAY)
                                     {
-                                        App::GetGameContext()->UpdateBoatInputEvents(dt);
+                                        if (App::GetGameContext()->GetPlayerActor()->ar_driveable == TRUCK)
+                                        {
+                                            App::GetGameContext()->UpdateTruckInputEvents(dt);
+                                        }
+                                        if (App::GetGameContext()->GetPlayerActor()->ar_driveable == AIRPLANE)
+                                        {
+                                            App::GetGameContext()->UpdateAirplaneInputEvents(dt);
+                                        }
+                                        if (App::GetGameContext()->GetPlayerActor()->ar_driveable == BOAT)
+                                        {
+                                            App::GetGameContext()->UpdateBoatInputEvents(dt);
+                                        }
                                     }
                                 }
                             }
+                            else // free cam mode
+                            {
+                                App::GetGameContext()->UpdateSkyInputEvents(dt);
+                            }
                         }
-                        else // free cam mode
-                        {
-                            App::GetGameContext()->UpdateSkyInputEvents(dt);
-                        }
-                    }
-                    App::GetGameContext()->GetRecoveryMode().UpdateInputEvents(dt);
-                    App::GetGameContext()->GetActorManager()->UpdateInputEvents(dt);
+                        App::GetGameContext()->GetRecoveryMode().UpdateInputEvents(dt);
+                        App::GetGameContext()->GetActorManager()->UpdateInputEvents(dt);
+                    }, dt);
                 }
             }
 
             // Update OutGauge device
             if (App::io_outgauge_mode->GetInt() > 0)
             {
-                App::GetOutGauge()->Update(dt, App::GetGameContext()->GetPlayerActor());
+                sim_work([](float dt) { App::GetOutGauge()->Update(dt, App::GetGameContext()->GetPlayerActor()); }, dt);
             }
 
-            // Early GUI updates which require halted physics
+            // Early GUI updates
+            // The GUI reads the buffered actor data (see `GfxActor::SimBuffer`), so it doesn't need halted physics;
+            // the few panels which modify actors halt it themselves. Only the debug views read live nodes and beams.
             App::GetGuiManager()->NewImGuiFrame(dt);
             if (App::app_state->GetEnum<AppState>() == AppState::SIMULATION)
             {
                 App::GetGuiManager()->DrawSimulationGui(dt);
-                for (auto actor : App::GetGameContext()->GetActorManager()->GetActors())
-                {
-                    actor->GetGfxActor()->UpdateDebugView();
-                }
                 if (App::GetGameContext()->GetPlayerActor())
                 {
-                    App::GetGuiManager()->GetSimActorStats()->UpdateStats(dt, App::GetGameContext()->GetPlayerActor());
+                    GfxActor* player_gfx_actor = App::GetGameContext()->GetPlayerActor()->GetGfxActor();
+                    App::GetGuiManager()->GetSimActorStats()->UpdateStats(dt, player_gfx_actor);
                     if (App::GetGuiManager()->IsVisible_FrictionSettings())
                     {
-                        App::GetGuiManager()->GetFrictionSettings()->setActiveCol(App::GetGameContext()->GetPlayerActor()->ar_last_fuzzy_ground_model);
+                        App::GetGuiManager()->GetFrictionSettings()->setActiveCol(player_gfx_actor->GetSimDataBuffer().simbuf_last_fuzzy_ground_model);
                     }
                 }
+                sim_work([](float dt)
+                {
+                    for (auto actor : App::GetGameContext()->GetActorManager()->GetActors())
+                    {
+                        actor->GetGfxActor()->UpdateDebugView();
+                    }
+                }, dt);
             }
 
 #ifdef USE_MUMBLE
@@ -855,27 +889,36 @@ int main(int argc, char *argv[])
 #ifdef USE_ANGELSCRIPT
             if (App::app_state->GetEnum<AppState>() == AppState::SIMULATION)
             {
-                App::GetScriptEngine()->framestep(dt);
+                sim_work([](float dt) { App::GetScriptEngine()->framestep(dt); }, dt);
             }
 #endif // USE_ANGELSCRIPT
 
             if (App::io_ffb_enabled->GetBool() &&
                 App::sim_state->GetEnum<SimState>() == SimState::RUNNING)
             {
-                App::GetAppContext()->GetForceFeedback().Update();
+                sim_work([](float) { App::GetAppContext()->GetForceFeedback().Update(); }, dt);
             }
 
             if (App::sim_state->GetEnum<SimState>() == SimState::RUNNING)
             {
-                App::GetGameContext()->GetSceneMouse().UpdateSimulation();
+                sim_work([](float) { App::GetGameContext()->GetSceneMouse().UpdateSimulation(); }, dt);
             }
 
             // Create snapshot of simulation state for Gfx/GUI updates
+            // Pipelined mode: runs alongside the physics, actors are buffered from the snapshots of the last completed step.
             if (App::sim_state->GetEnum<SimState>() == SimState::RUNNING)
             {
                 App::GetGfxScene()->BufferSimulationData();
             }
 
+            // Pipelined mode: physics of the previous frame ran alongside everything above - join it now
+            // and run the queued work, in the order it was queued.
+            if (pipelined_physics)
+            {
+                App::GetGameContext()->GetActorManager()->SyncWithSimThread();
+                App::GetGameContext()->GetActorManager()->RunSimCommands();
+            }
+
             // Advance simulation
             if (App::sim_state->GetEnum<SimState>() == SimState::RUNNING)
             {
@@ -900,7 +943,10 @@ int main(int argc, char *argv[])
             }
             else
             {
-                App::GetAppContext()->GetOgreRoot()->renderOneFrame();
+                {
+                    ROR_PROFILE_SCOPE(RENDERING);
+                    App::GetAppContext()->GetOgreRoot()->renderOneFrame();
+                }
                 if (!render_window->isActive() && render_window->isVisible())
                 {
                     render_window->update(); // update even when in background !
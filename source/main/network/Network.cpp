@@ -31,6 +31,7 @@
 #include "GUIManager.h"
 #include "GUI_TopMenubar.h"
 #include "Language.h"
+#include "Profiler.h"
 #include "RoRVersion.h"
 #include "ScriptEngine.h"
 #include "Utils.h"
@@ -214,6 +215,7 @@ int Network::ReceiveMessage(RoRnet::Header *head, char* content, int bufferlen)
 void Network::SendThread()
 {
     LOG("[RoR|Networking] SendThread started");
+    ROR_PROFILE_THREAD_NAME("NetSend");
     while (!m_shutdown)
     {
         NetSendPacket packet;
@@ -230,6 +232,7 @@ void Network::SendThread()
             packet = m_send_packet_buffer.front();
             m_send_packet_buffer.pop_front();
         }
+        ROR_PROFILE_EVENT("SendMessage");
         SendMessageRaw(packet.buffer, packet.size);
     }
     LOG("[RoR|Networking] SendThread stopped");
@@ -238,6 +241,7 @@ void Network::SendThread()
 void Network::RecvThread()
 {
     LOG_THREAD("[RoR|Networking] RecvThread starting...");
+    ROR_PROFILE_THREAD_NAME("NetRecv");
 
     RoRnet::Header header;
 
@@ -254,6 +258,7 @@ void Network::RecvThread()
             PushNetMessage(MSG_NET_RECV_ERROR, _LC("Network", "Error receiving data from network"));
             continue; // Stop receiving data
         }
+        ROR_PROFILE_EVENT("HandleMessage");
 
         if (header.command == MSG2_STREAM_REGISTER)
         {
@@ -62,6 +62,7 @@
 #include "SlideNode.h"
 #include "SoundScriptManager.h"
 #include "TerrainManager.h"
+#include "ThreadPool.h"
 #include "TurboJet.h"
 #include "TurboProp.h"
 #include "Utils.h"
@@ -319,7 +320,9 @@ void Actor::ScaleActor(float value)
         ar_nodes[i].Forces *= value;
         ar_nodes[i].mass *= value;
     }
+    this->UpdateNodeInverseMasses();
     updateSlideNodePositions();
+    m_sim_snapshot_stale = true;
 
     m_gfx_actor->ScaleActor(relpos, value);
 
@@ -729,6 +732,48 @@ void Actor::RecalculateNodeMasses(Real total)
         m_total_mass += ar_nodes[i].mass;
     }
     LOG("TOTAL VEHICLE MASS: " + TOSTRING((int)m_total_mass) +" kg");
+
+    this->UpdateNodeInverseMasses();
+}
+
+void Actor::UpdateNodeInverseMasses()
+{
+    for (int i = 0; i < ar_num_nodes; i++)
+    {
+        ar_nodes[i].inv_mass = 1.f / ar_nodes[i].mass;
+    }
+    this->UpdateDozeStability();
+}
+
+void Actor::UpdateDozeStability()
+{
+    // Explicit Euler on a damped spring stays stable while `w^2 * dt^2 + 2 * c * dt <= 4`,
+    // where `w^2 = k / m` and `c = d / m` with `m` the reduced mass of the beam's nodes.
+    // Nodes with several beams are stiffer than any single one of them, hence the margin.
+    // Shocks are counted at their bump stop stiffness, which they reach when compressed.
+    const float dt = ISLAND_DOZE_SUBSTEP_STRIDE * PHYSICS_DT;
+    const float limit = 4.f * ISLAND_DOZE_STABILITY_MARGIN;
+    m_doze_stable = true;
+    for (int i = 0; i < ar_num_beams; i++)
+    {
+        const beam_t& beam = ar_beams[i];
+        if (beam.bm_inter_actor)
+            continue;
+
+        float k = beam.k;
+        float d = beam.d;
+        if (beam.bounded == SHOCK1 || beam.bounded == SHOCK2 || beam.bounded == SHOCK3)
+        {
+            k = std::max(k, DEFAULT_SPRING);
+            d = std::max(d, DEFAULT_DAMP);
+        }
+        const float inv_mass = beam.p1->inv_mass + beam.p2->inv_mass;
+        if (k * inv_mass * dt * dt + 2.f * d * inv_mass * dt > limit)
+        {
+            m_doze_stable = false;
+            return;
+        }
+    }
 }
 
 float Actor::getTotalMass(bool withLocked)
@@ -757,6 +802,7 @@ void Actor::DetermineLinkedActors() //TODO: Refactor this - logic iterating over
     lookup_table.insert(std::pair<Actor*, bool>(this, false));
     
     auto inter_actor_links = App::GetGameContext()->GetActorManager()->inter_actor_links; // TODO: Shouldn't this have been a reference?? Also, ugly, see the TODO note above ~ only_a_ptr, 01/2018
+    App::GetGameContext()->GetActorManager()->InvalidatePhysicsTaskGraph(); // Inter-actor groups follow the links
 
     while (found)
     {
@@ -811,6 +857,60 @@ void Actor::calcNodeConnectivityGraph()
     }
 }
 
+void Actor::SetupPhysicsSplit()
+{
+    m_split_physics = ar_num_nodes >= PHYSICS_SPLIT_MIN_NODES && App::GetThreadPool()->GetNumWorkers() > 0;
+    if (!m_split_physics)
+        return;
+
+    // Hook and tie beams get their `p2` swapped at runtime, so they can't be assigned to a node range.
+    std::vector<bool> relinkable(ar_num_beams, false);
+    for (hook_t& hook: ar_hooks)
+    {
+        relinkable[hook.hk_beam - ar_beams] = true;
+    }
+    for (tie_t& tie: ar_ties)
+    {
+        relinkable[tie.ti_beam - ar_beams] = true;
+    }
+
+    m_split_beams.clear();
+    m_serial_beams.clear();
+    for (int i = 0; i < ar_num_beams; i++)
+    {
+        if (relinkable[i])
+            m_serial_beams.push_back(i);
+        else
+            m_split_beams.push_back(i);
+    }
+
+    // Ordered by the lower node, a contiguous slice of beams touches a narrow node range
+    std::stable_sort(m_split_beams.begin(), m_split_beams.end(), [this](int a, int b)
+        {
+            return std::min(ar_beams[a].p1->pos, ar_beams[a].p2->pos) < std::min(ar_beams[b].p1->pos, ar_beams[b].p2->pos);
+        });
+
+    const int num_beams = static_cast<int>(m_split_beams.size());
+    const int num_chunks = std::max(1, std::min(App::GetThreadPool()->GetNumWorkers() + 1, num_beams));
+    m_beam_chunks.assign(num_chunks, BeamChunk());
+    for (int c = 0; c < num_chunks; c++)
+    {
+        BeamChunk& chunk = m_beam_chunks[c];
+        chunk.begin = num_beams * c / num_chunks;
+        chunk.end = num_beams * (c + 1) / num_chunks;
+        chunk.node_min = ar_num_nodes;
+        chunk.node_max = -1;
+        for (int pos = chunk.begin; pos < chunk.end; pos++)
+        {
+            const beam_t& beam = ar_beams[m_split_beams[pos]];
+            chunk.node_min = std::min(chunk.node_min, static_cast<int>(std::min(beam.p1->pos, beam.p2->pos)));
+            chunk.node_max = std::max(chunk.node_max, static_cast<int>(std::max(beam.p1->pos, beam.p2->pos)));
+        }
+        const int span = (chunk.node_max >= chunk.node_min) ? (chunk.node_max - chunk.node_min + 1) : 0;
+        chunk.forces.assign(span, Ogre::Vector3::ZERO);
+    }
+}
+
 bool Actor::Intersects(Actor* actor, Vector3 offset)
 {
     Vector3 bb_min = ar_bounding_box.getMinimum() + offset;
@@ -1138,6 +1238,35 @@ void Actor::UpdatePhysicsOrigin()
     }
 }
 
+void Actor::PublishSimSnapshot()
+{
+    GfxActor::SimSnapshot& snapshot = m_sim_snapshot.GetBackBuffer();
+    for (int i = 0; i < ar_num_nodes; i++)
+    {
+        const node_t& node = ar_nodes[i];
+        snapshot.nodes[i].AbsPosition = node.AbsPosition;
+        snapshot.nodes[i].nd_has_contact = node.nd_has_ground_contact || node.nd_has_mesh_contact;
+        snapshot.nodes[i].nd_is_wet = false; // Filled in by `GfxActor::UpdateSimDataBuffer()`
+    }
+
+    // The rods themselves are only set up on spawn; allocates on the first publishes only
+    const std::vector<Rod>& rods = m_gfx_actor->GetRods();
+    snapshot.rods.resize(rods.size());
+    for (size_t i = 0; i < rods.size(); i++)
+    {
+        const beam_t& beam = ar_beams[rods[i].rod_beam_index];
+        snapshot.rods[i].rod_node1 = static_cast<uint16_t>(beam.p1->pos);
+        snapshot.rods[i].rod_node2 = static_cast<uint16_t>(beam.p2->pos);
+        snapshot.rods[i].rod_target_actor = (beam.bm_inter_actor) ? beam.bm_locked_actor : this;
+        snapshot.rods[i].rod_is_visible = !beam.bm_disabled && !beam.bm_broken;
+    }
+
+    m_gfx_actor->CaptureSimState(snapshot.state);
+
+    m_sim_snapshot.Publish();
+    m_sim_snapshot_stale = false;
+}
+
 void Actor::ResetAngle(float rot)
 {
     // Set origin of rotation to camera node
@@ -1158,6 +1287,7 @@ void Actor::ResetAngle(float rot)
 
     this->UpdateBoundingBoxes();
     calculateAveragePosition();
+    m_sim_snapshot_stale = true;
 }
 
 void Actor::UpdateInitPosition()
@@ -1249,6 +1379,7 @@ void Actor::ResetPosition(Vector3 translation, bool setInitPosition)
 
     this->UpdateBoundingBoxes();
     calculateAveragePosition();
+    m_sim_snapshot_stale = true;
 }
 
 void Actor::HandleMouseMove(int node, Vector3 pos, float force)
@@ -1532,6 +1663,7 @@ void Actor::SyncReset(bool reset_position)
         ar_nodes[i].Velocity = Vector3::ZERO;
         ar_nodes[i].Forces = Vector3::ZERO;
     }
+    m_sim_snapshot_stale = true;
 
     for (int i = 0; i < ar_num_beams; i++)
     {
@@ -1677,6 +1809,7 @@ void Actor::ApplyNodeBeamScales()
     {
         ar_nodes[i].mass = ar_initial_node_masses[i] * ar_nb_mass_scale;
     }
+    this->UpdateNodeInverseMasses();
 
     m_total_mass = ar_initial_total_mass * ar_nb_mass_scale;
 
@@ -1845,6 +1978,7 @@ void Actor::HandleInputEvents(float dt)
         m_rotation_request = 0.0f;
         this->UpdateBoundingBoxes();
         calculateAveragePosition();
+        m_sim_snapshot_stale = true;
     }
 
     if (m_translation_request != Vector3::ZERO)
@@ -1858,6 +1992,7 @@ void Actor::HandleInputEvents(float dt)
         m_translation_request = Vector3::ZERO;
         UpdateBoundingBoxes();
         calculateAveragePosition();
+        m_sim_snapshot_stale = true;
     }
 }
 
@@ -2471,7 +2606,7 @@ void Actor::CalcCabCollisions()
     if (m_intra_point_col_detector != nullptr)
     {
         m_intra_point_col_detector->UpdateIntraPoint();
-        ResolveIntraActorCollisions(PHYSICS_DT,
+        ResolveIntraActorCollisions(m_physics_dt,
             *m_intra_point_col_detector,
             ar_num_collcabs,
             ar_collcabs,
@@ -2630,7 +2765,7 @@ void Actor::CalcTriggers(int i, Real difftoBeamL, bool trigger_hooks)
 {
     if ((ar_beams[i].shock->flags & SHOCK_FLAG_ISTRIGGER) && ar_beams[i].shock->trigger_enabled) // this is a trigger and its enabled
     {
-        const float dt = PHYSICS_DT;
+        const float dt = m_physics_dt;
 
         if (difftoBeamL > ar_beams[i].longbound * ar_beams[i].L || difftoBeamL < -ar_beams[i].shortbound * ar_beams[i].L) // that has hit boundary
         {
@@ -4413,6 +4548,8 @@ Actor::Actor(
     , ar_right_mirror_angle(-0.52)
     , ar_rudder(0)
     , ar_update_physics(false)
+    , ar_physics_dozing(false)
+    , m_physics_dt(PHYSICS_DT)
     , ar_sleep_counter(0.0f)
     , m_stabilizer_shock_request(0)
     , m_stabilizer_shock_ratio(0.0)
@@ -4464,6 +4601,7 @@ Actor::Actor(
     , ar_last_fuzzy_ground_model(nullptr)
     , m_transfer_case(nullptr)
 {
+    m_turbulence_rng.SetKey(static_cast<uint32_t>(App::sim_rng_seed->GetInt()), static_cast<uint32_t>(actor_id));
 }
 
 float Actor::getSteeringAngle()
@@ -24,10 +24,13 @@
 #include "Application.h"
 #include "SimData.h"
 #include "CmdKeyInertia.h"
+#include "Collisions.h"
+#include "CounterRng.h"
 #include "GfxActor.h"
 #include "MovableText.h"
 #include "PerVehicleCameraContext.h"
 #include "RigDef_Prerequisites.h"
+#include "TripleBuffer.h"
 #include "TyrePressure.h"
 
 #include <Ogre.h>
@@ -152,6 +155,7 @@ public:
     void              UpdateBoundingBoxes();
     void              calculateAveragePosition();
     void              UpdatePhysicsOrigin();
+    void              PublishSimSnapshot();                //!< Hands node positions, rod endpoints and `GfxActor::SimBuffer` state to `GfxActor`; physics thread, or main thread while physics is synced
     void              updateSlideNodePositions();          //!< incrementally update the position of all SlideNodes
     void              SoftReset();
     void              SyncReset(bool reset_position);      //!< this one should be called only synchronously (without physics running in background)
@@ -363,6 +367,7 @@ public:
     bool ar_gui_use_engine_max_rpm:1;  //!< Gfx attr
     bool ar_hydro_speed_coupling:1;
     bool ar_collision_relevant:1;      //!< Physics state;
+    bool ar_physics_dozing:1;          //!< Physics state; island at rest, steps `ISLAND_DOZE_SUBSTEP_STRIDE` substeps at once (cvar 'sim_island_dozing')
     bool ar_is_police:1;        //!< Gfx/sfx attr
     bool ar_rescuer_flag:1;     //!< Gameplay attr; defined in truckfile. TODO: Does anybody use this anymore?
     bool ar_forward_commands:1; //!< Sim state
@@ -373,11 +378,33 @@ public:
 
 private:
 
+    /// Per-actor side effects of `CalcNodesRange()`, merged in node order by `CalcNodes()`
+    struct CalcNodesResult
+    {
+        bool              water_contact = false;
+        bool              ground_contact = false;       //!< Some node touched ground or mesh; `last_fuzzy_ground_model` is valid
+        bool              exploded = false;             //!< Some node went over mach 20
+        ground_model_t*   last_fuzzy_ground_model = nullptr;
+    };
+
+    /// Slice of `m_split_beams` which `CalcBeamsSplit()` runs on one thread
+    struct BeamChunk
+    {
+        int               begin = 0;                    //!< First entry of `m_split_beams`
+        int               end = 0;                      //!< One past last entry
+        int               node_min = 0;                 //!< Lowest node touched by the slice
+        int               node_max = -1;                //!< Highest node touched by the slice
+        std::vector<Ogre::Vector3> forces;              //!< Scratch force accumulator, indexed by `node - node_min`
+        std::vector<int>  deferred;                     //!< Beams with side effects (shocks, triggers, deformation...), left for the serial pass
+    };
+
     bool              CalcForcesEulerPrepare(bool doUpdate); 
     void              CalcAircraftForces(bool doUpdate);   
     void              CalcForcesEulerCompute(bool doUpdate, int num_steps); 
     void              CalcAnimators(const int flag_state, float &cstate, int &div, float timer, const float lower_limit, const float upper_limit, const float option3); 
     void              CalcBeams(bool trigger_hooks);       
+    void              CalcBeamsSplit(bool trigger_hooks);  //!< CalcBeams() variant for `m_split_physics`
+    float             CalcBeamStress(int i, Ogre::Real dislen, Ogre::Real v, bool trigger_hooks); //!< Shocks/deformation/breaking of one beam; returns stress
     void              CalcBeamsInterActor();               
     void              CalcBuoyance(bool doUpdate);         
     void              CalcCommands(bool doUpdate);         
@@ -389,6 +416,7 @@ private:
     void              CalcHydros();                        
     void              CalcMouse();                         
     void              CalcNodes();                         
+    void              CalcNodesRange(int begin, int end, CalcNodesResult& result, GroundQueryBatch& ground); //!< Integrates nodes [begin, end); may run on any thread
     void              CalcReplay();                        
     void              CalcRopes();                         
     void              CalcShocks(bool doUpdate, int num_steps); 
@@ -401,7 +429,10 @@ private:
 
     void              DetermineLinkedActors();
     void              RecalculateNodeMasses(Ogre::Real total); //!< Previously 'calc_masses2()'
+    void              UpdateNodeInverseMasses();           //!< Refreshes `node_t::inv_mass`; call whenever node masses change.
+    void              UpdateDozeStability();               //!< Decides `m_doze_stable`; called by `UpdateNodeInverseMasses()`.
     void              calcNodeConnectivityGraph();
+    void              SetupPhysicsSplit();                 //!< Decides `m_split_physics` and slices the beams for it; call after spawn.
     void              AddInterActorBeam(beam_t* beam, Actor* a, Actor* b);
     void              RemoveInterActorBeam(beam_t* beam);
     void              DisjoinInterActorBeams();            //!< Destroys all inter-actor beams which are connected with this actor
@@ -459,6 +490,9 @@ private:
     int               m_anglesnap_request;        //!< Accumulator
     Ogre::Vector3     m_translation_request;      //!< Accumulator
     Ogre::Vector3     m_camera_gforces_accu;      //!< Accumulator for 'camera' G-forces
+    int               m_num_substeps_run = 0;     //!< Physics; substeps simulated this frame, fewer than the frame's total while dozing
+    float             m_physics_dt;               //!< Physics; length of the running substep, `PHYSICS_DT` or a multiple of it while dozing
+    bool              m_doze_stable = false;      //!< Physics; stays stable at `ISLAND_DOZE_SUBSTEP_STRIDE * PHYSICS_DT`, so the actor may doze
     Ogre::Vector3     m_camera_gforces;           //!< Physics state (global)
     Ogre::Vector3     m_camera_local_gforces_cur; //!< Physics state (camera local)
     Ogre::Vector3     m_camera_local_gforces_max; //!< Physics state (camera local)
@@ -487,6 +521,21 @@ private:
     int               m_masscount;             //!< Physics attr; Number of nodes loaded with l option
     float             m_dry_mass;              //!< Physics attr;
     std::unique_ptr<Buoyance> m_buoyance;      //!< Physics
+    bool              m_split_physics = false; //!< Physics; CalcNodes()/CalcBeams()/CalcBuoyance() run in chunks on the thread pool; needs `PHYSICS_SPLIT_MIN_NODES` and worker threads
+    std::vector<int>  m_split_beams;           //!< Physics; beams of a split actor except hooks and ties, ordered by lower node
+    std::vector<int>  m_serial_beams;          //!< Physics; hook and tie beams of a split actor, their `p2` changes at runtime
+    std::vector<BeamChunk> m_beam_chunks;      //!< Physics; one per thread, see `CalcBeamsSplit()`
+    std::vector<int>  m_deferred_beams;        //!< Physics; serial pass of `CalcBeamsSplit()`, in beam order
+    std::vector<CalcNodesResult> m_calc_nodes_results; //!< Physics; one per `PHYSICS_SPLIT_NODE_GRAIN` nodes
+    std::vector<GroundQueryBatch> m_ground_queries;    //!< Physics; parallel to `m_calc_nodes_results`, reused between substeps
+    CounterRng        m_turbulence_rng;                //!< Physics; keyed by cvar 'sim_rng_seed' + `ar_instance_id`, one step per `CalcNodes()`
+    std::vector<float> m_turbulence;                   //!< Physics; 3 random numbers per node, refilled by `CalcNodesRange()`
+    std::vector<Ogre::Vector3> m_water_query_pos;      //!< Physics; node positions for the wave batch of `CalcNodesRange()`
+    std::vector<float> m_water_heights;                //!< Physics; wave surface height at each node, refilled by `CalcNodesRange()`
+    std::vector<Ogre::Vector3> m_water_velocities;     //!< Physics; wave surface velocity at each node, only with buoycabs
+    std::vector<Ogre::Vector3> m_buoycab_forces;       //!< Physics; 3 per buoycab, filled in parallel by `CalcBuoyance()`
+    TripleBuffer<GfxActor::SimSnapshot> m_sim_snapshot; //!< Graphics; written by `PublishSimSnapshot()`, read by `GfxActor::UpdateSimDataBuffer()`
+    bool              m_sim_snapshot_stale = false; //!< Graphics; nodes were moved outside of the physics step (reset, teleport, script); published even while sleeping
     CacheEntry*       m_used_skin_entry;       //!< Graphics
     Skidmark*         m_skid_trails[MAX_WHEELS*2];
     bool              m_antilockbrake;         //!< GUI state
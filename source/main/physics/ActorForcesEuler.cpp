@@ -32,17 +32,23 @@
 #include "EngineSim.h"
 #include "FlexAirfoil.h"
 #include "GameContext.h"
+#include "Profiler.h"
 #include "Replay.h"
 #include "ScrewProp.h"
 #include "SoundScriptManager.h"
 #include "TerrainManager.h"
+#include "ThreadPool.h"
 #include "Water.h"
 
+#include <limits>
+
 using namespace Ogre;
 using namespace RoR;
 
 void Actor::CalcForcesEulerCompute(bool doUpdate, int num_steps)
 {
+    ROR_PROFILE_SCOPE(PHYSICS_COMPUTE);
+
     this->CalcNodes(); // must be done directly after the inter truck collisions are handled
     this->CalcReplay();
     this->CalcAircraftForces(doUpdate);
@@ -58,7 +64,7 @@ void Actor::CalcForcesEulerCompute(bool doUpdate, int num_steps)
     this->CalcMouse();
     this->CalcBeams(doUpdate);
     this->CalcCabCollisions();
-    this->UpdateSlideNodeForces(PHYSICS_DT); // must be done after the contacters are updated
+    this->UpdateSlideNodeForces(m_physics_dt); // must be done after the contacters are updated
     this->CalcForceFeedback(doUpdate);
 }
 
@@ -105,12 +111,12 @@ void Actor::CalcAircraftForces(bool doUpdate)
     //turboprop forces
     for (int i = 0; i < ar_num_aeroengines; i++)
         if (ar_aeroengines[i])
-            ar_aeroengines[i]->updateForces(PHYSICS_DT, doUpdate);
+            ar_aeroengines[i]->updateForces(m_physics_dt, doUpdate);
 
     //screwprop forces
     for (int i = 0; i < ar_num_screwprops; i++)
         if (ar_screwprops[i])
-            ar_screwprops[i]->updateForces(doUpdate);
+            ar_screwprops[i]->updateForces(doUpdate, m_water_heights.data());
 
     //wing forces
     for (int i = 0; i < ar_num_wings; i++)
@@ -148,10 +154,38 @@ void Actor::CalcBuoyance(bool doUpdate)
 {
     if (ar_num_buoycabs && App::GetSimTerrain()->getWater())
     {
+        m_buoycab_forces.resize(3 * ar_num_buoycabs);
+        auto calc_range = [this, doUpdate](int begin, int end)
+            {
+                for (int i = begin; i < end; i++)
+                {
+                    int tmpv = ar_buoycabs[i] * 3;
+                    m_buoyance->computeNodeForce(&ar_nodes[ar_cabs[tmpv]], &ar_nodes[ar_cabs[tmpv + 1]], &ar_nodes[ar_cabs[tmpv + 2]], doUpdate == 1, ar_buoycab_types[i],
+                        m_water_heights.data(), m_water_velocities.data(), &m_buoycab_forces[3 * i]);
+                }
+            };
+
+        if (m_split_physics && ar_num_buoycabs >= PHYSICS_SPLIT_MIN_BUOYCABS)
+        {
+            const int num_chunks = (ar_num_buoycabs + PHYSICS_SPLIT_BUOYCAB_GRAIN - 1) / PHYSICS_SPLIT_BUOYCAB_GRAIN;
+            App::GetThreadPool()->ParallelFor(0, num_chunks, 1, [this, &calc_range](int c)
+                {
+                    const int begin = c * PHYSICS_SPLIT_BUOYCAB_GRAIN;
+                    calc_range(begin, std::min(ar_num_buoycabs, begin + PHYSICS_SPLIT_BUOYCAB_GRAIN));
+                });
+        }
+        else
+        {
+            calc_range(0, ar_num_buoycabs);
+        }
+
+        // Buoycabs share nodes - sum up in buoycab order, so the result doesn't depend on scheduling.
         for (int i = 0; i < ar_num_buoycabs; i++)
         {
             int tmpv = ar_buoycabs[i] * 3;
-            m_buoyance->computeNodeForce(&ar_nodes[ar_cabs[tmpv]], &ar_nodes[ar_cabs[tmpv + 1]], &ar_nodes[ar_cabs[tmpv + 2]], doUpdate == 1, ar_buoycab_types[i]);
+            ar_nodes[ar_cabs[tmpv]].Forces += m_buoycab_forces[3 * i];
+            ar_nodes[ar_cabs[tmpv + 1]].Forces += m_buoycab_forces[3 * i + 1];
+            ar_nodes[ar_cabs[tmpv + 2]].Forces += m_buoycab_forces[3 * i + 2];
         }
     }
 }
@@ -217,7 +251,7 @@ void Actor::CalcDifferentials()
             {axle_torques[0], axle_torques[1]},
             ar_wheels[m_wheel_diffs[a_1]->di_idx_1].wh_torque + ar_wheels[m_wheel_diffs[a_1]->di_idx_2].wh_torque +
             ar_wheels[m_wheel_diffs[a_2]->di_idx_1].wh_torque + ar_wheels[m_wheel_diffs[a_2]->di_idx_2].wh_torque,
-            PHYSICS_DT
+            m_physics_dt
         };
 
         m_axle_diffs[i]->CalcAxleTorque(diff_data);
@@ -243,7 +277,7 @@ void Actor::CalcDifferentials()
             m_wheel_diffs[i]->di_delta_rotation,
             {axle_torques[0], axle_torques[1]},
             axle_wheels[0]->wh_torque + axle_wheels[1]->wh_torque,
-            PHYSICS_DT
+            m_physics_dt
         };
 
         m_wheel_diffs[i]->CalcAxleTorque(diff_data);
@@ -257,9 +291,11 @@ void Actor::CalcDifferentials()
 
 void Actor::CalcWheels(bool doUpdate, int num_steps)
 {
+    ROR_PROFILE_SCOPE(CALC_WHEELS);
+
     // driving aids traction control & anti-lock brake pulse
-    tc_timer += PHYSICS_DT;
-    alb_timer += PHYSICS_DT;
+    tc_timer += m_physics_dt;
+    alb_timer += m_physics_dt;
 
     if (alb_timer >= alb_pulse_time)
     {
@@ -351,7 +387,7 @@ void Actor::CalcWheels(bool doUpdate, int num_steps)
                     m_antilockbrake = true;
                 }
 
-                float force = -ar_wheels[i].wh_avg_speed * ar_wheels[i].wh_radius * ar_wheels[i].wh_mass / PHYSICS_DT;
+                float force = -ar_wheels[i].wh_avg_speed * ar_wheels[i].wh_radius * ar_wheels[i].wh_mass / m_physics_dt;
                 force -= ar_wheels[i].wh_last_retorque;
 
                 if (ar_wheels[i].wh_speed > 0)
@@ -416,7 +452,7 @@ void Actor::CalcWheels(bool doUpdate, int num_steps)
         }
 
         ar_wheels[i].wh_speed /= (Real)ar_wheels[i].wh_num_nodes;
-        ar_wheels[i].wh_net_rp += (ar_wheels[i].wh_speed / ar_wheels[i].wh_radius) * PHYSICS_DT;
+        ar_wheels[i].wh_net_rp += (ar_wheels[i].wh_speed / ar_wheels[i].wh_radius) * m_physics_dt;
         // We overestimate the average speed on purpose in order to improve the quality of the braking force estimate
         ar_wheels[i].wh_avg_speed = ar_wheels[i].wh_avg_speed * 0.99 + ar_wheels[i].wh_speed * 0.1;
         ar_wheels[i].debug_rpm += RAD_PER_SEC_TO_RPM * ar_wheels[i].wh_speed / ar_wheels[i].wh_radius / (float)num_steps;
@@ -427,8 +463,8 @@ void Actor::CalcWheels(bool doUpdate, int num_steps)
             ar_wheel_spin  += speedacc / ar_wheels[i].wh_radius; // Accumulate the average wheel spin  (radians)
         }
 
-        expected_wheel_speed += ((ar_wheels[i].wh_last_torque / ar_wheels[i].wh_radius) / ar_wheels[i].wh_mass) * PHYSICS_DT;
-        ar_wheels[i].wh_last_retorque = ar_wheels[i].wh_mass * (ar_wheels[i].wh_speed - expected_wheel_speed) / PHYSICS_DT;
+        expected_wheel_speed += ((ar_wheels[i].wh_last_torque / ar_wheels[i].wh_radius) / ar_wheels[i].wh_mass) * m_physics_dt;
+        ar_wheels[i].wh_last_retorque = ar_wheels[i].wh_mass * (ar_wheels[i].wh_speed - expected_wheel_speed) / m_physics_dt;
 
         // reaction torque
         Vector3 rradius = ar_wheels[i].wh_arm_node->RelPosition - ar_wheels[i].wh_near_attach_node->RelPosition;
@@ -479,7 +515,7 @@ void Actor::CalcWheels(bool doUpdate, int num_steps)
     }
 
     // calculate driven distance
-    float distance_driven = fabs(ar_wheel_speed * PHYSICS_DT);
+    float distance_driven = fabs(ar_wheel_speed * m_physics_dt);
     m_odometer_total += distance_driven;
     m_odometer_user += distance_driven;
 }
@@ -490,7 +526,7 @@ void Actor::CalcShocks(bool doUpdate, int num_steps)
     if (this->ar_has_active_shocks && m_stabilizer_shock_request)
     {
         if ((m_stabilizer_shock_request == 1 && m_stabilizer_shock_ratio < 0.1) || (m_stabilizer_shock_request == -1 && m_stabilizer_shock_ratio > -0.1))
-            m_stabilizer_shock_ratio = m_stabilizer_shock_ratio + (float)m_stabilizer_shock_request * PHYSICS_DT * STAB_RATE;
+            m_stabilizer_shock_ratio = m_stabilizer_shock_ratio + (float)m_stabilizer_shock_request * m_physics_dt * STAB_RATE;
         for (int i = 0; i < ar_num_shocks; i++)
         {
             // active shocks now
@@ -503,7 +539,7 @@ void Actor::CalcShocks(bool doUpdate, int num_steps)
     //auto shock adjust
     if (this->ar_has_active_shocks && doUpdate)
     {
-        m_stabilizer_shock_sleep -= PHYSICS_DT * num_steps;
+        m_stabilizer_shock_sleep -= m_physics_dt * num_steps;
 
         float roll = asin(GetCameraRoll().dotProduct(Vector3::UNIT_Y));
         //mWindow->setDebugText("Roll:"+ TOSTRING(roll));
@@ -541,6 +577,8 @@ void Actor::CalcShocks(bool doUpdate, int num_steps)
 
 void Actor::CalcHydros()
 {
+    ROR_PROFILE_SCOPE(CALC_HYDROS);
+
     //direction
     if (ar_hydro_dir_state != 0 || ar_hydro_dir_command != 0)
     {
@@ -551,7 +589,7 @@ void Actor::CalcHydros()
             float sensitivity = Math::Clamp(App::io_analog_sensitivity->GetFloat(), 0.5f, 2.0f);
             float diff = ar_hydro_dir_command - ar_hydro_dir_state;
             float rate = std::exp(-std::min(std::abs(diff), 1.0f) / sensitivity) * diff;
-            ar_hydro_dir_state += (10.0f / smoothing) * PHYSICS_DT * rate;
+            ar_hydro_dir_state += (10.0f / smoothing) * m_physics_dt * rate;
         }
         else
         {
@@ -561,21 +599,21 @@ void Actor::CalcHydros()
                 {
                     float rate = std::max(1.2f, 30.0f / (10.0f));
                     if (ar_hydro_dir_state > ar_hydro_dir_command)
-                        ar_hydro_dir_state -= PHYSICS_DT * rate;
+                        ar_hydro_dir_state -= m_physics_dt * rate;
                     else
-                        ar_hydro_dir_state += PHYSICS_DT * rate;
+                        ar_hydro_dir_state += m_physics_dt * rate;
                 }
                 else
                 {
                     // minimum rate: 20% --> enables to steer high velocity vehicles
                     float rate = std::max(1.2f, 30.0f / (10.0f + std::abs(ar_wheel_speed / 2.0f)));
                     if (ar_hydro_dir_state > ar_hydro_dir_command)
-                        ar_hydro_dir_state -= PHYSICS_DT * rate;
+                        ar_hydro_dir_state -= m_physics_dt * rate;
                     else
-                        ar_hydro_dir_state += PHYSICS_DT * rate;
+                        ar_hydro_dir_state += m_physics_dt * rate;
                 }
             }
-            float dirdelta = PHYSICS_DT;
+            float dirdelta = m_physics_dt;
             if (ar_hydro_dir_state > dirdelta)
                 ar_hydro_dir_state -= dirdelta;
             else if (ar_hydro_dir_state < -dirdelta)
@@ -590,11 +628,11 @@ void Actor::CalcHydros()
         if (ar_hydro_aileron_command != 0)
         {
             if (ar_hydro_aileron_state > ar_hydro_aileron_command)
-                ar_hydro_aileron_state -= PHYSICS_DT * 4.0;
+                ar_hydro_aileron_state -= m_physics_dt * 4.0;
             else
-                ar_hydro_aileron_state += PHYSICS_DT * 4.0;
+                ar_hydro_aileron_state += m_physics_dt * 4.0;
         }
-        float delta = PHYSICS_DT;
+        float delta = m_physics_dt;
         if (ar_hydro_aileron_state > delta)
             ar_hydro_aileron_state -= delta;
         else if (ar_hydro_aileron_state < -delta)
@@ -608,12 +646,12 @@ void Actor::CalcHydros()
         if (ar_hydro_rudder_command != 0)
         {
             if (ar_hydro_rudder_state > ar_hydro_rudder_command)
-                ar_hydro_rudder_state -= PHYSICS_DT * 4.0;
+                ar_hydro_rudder_state -= m_physics_dt * 4.0;
             else
-                ar_hydro_rudder_state += PHYSICS_DT * 4.0;
+                ar_hydro_rudder_state += m_physics_dt * 4.0;
         }
 
-        float delta = PHYSICS_DT;
+        float delta = m_physics_dt;
         if (ar_hydro_rudder_state > delta)
             ar_hydro_rudder_state -= delta;
         else if (ar_hydro_rudder_state < -delta)
@@ -627,11 +665,11 @@ void Actor::CalcHydros()
         if (ar_hydro_elevator_command != 0)
         {
             if (ar_hydro_elevator_state > ar_hydro_elevator_command)
-                ar_hydro_elevator_state -= PHYSICS_DT * 4.0;
+                ar_hydro_elevator_state -= m_physics_dt * 4.0;
             else
-                ar_hydro_elevator_state += PHYSICS_DT * 4.0;
+                ar_hydro_elevator_state += m_physics_dt * 4.0;
         }
-        float delta = PHYSICS_DT;
+        float delta = m_physics_dt;
         if (ar_hydro_elevator_state > delta)
             ar_hydro_elevator_state -= delta;
         else if (ar_hydro_elevator_state < -delta)
@@ -701,14 +739,14 @@ void Actor::CalcHydros()
         int flagstate = hydrobeam.hb_anim_flags;
         if (flagstate)
         {
-            this->CalcAnimators(flagstate, cstate, div, PHYSICS_DT, 0.0f, 0.0f, hydrobeam.hb_anim_param);
+            this->CalcAnimators(flagstate, cstate, div, m_physics_dt, 0.0f, 0.0f, hydrobeam.hb_anim_param);
         }
 
         if (div)
         {
             cstate /= (float)div;
 
-            cstate = hydrobeam.hb_inertia.CalcCmdKeyDelay(cstate, PHYSICS_DT);
+            cstate = hydrobeam.hb_inertia.CalcCmdKeyDelay(cstate, m_physics_dt);
 
             if (!(hydrobeam.hb_flags & HYDRO_FLAG_SPEED) && !flagstate)
                 ar_hydro_dir_wheel_display = cstate;
@@ -731,6 +769,8 @@ void Actor::CalcHydros()
 
 void Actor::CalcCommands(bool doUpdate)
 {
+    ROR_PROFILE_SCOPE(CALC_COMMANDS);
+
     if (m_has_command_beams)
     {
         int active = 0;
@@ -886,7 +926,7 @@ void Actor::CalcCommands(bool doUpdate)
                             }
                         }
 
-                        v = ar_command_key[i].command_inertia.CalcCmdKeyDelay(v, PHYSICS_DT);
+                        v = ar_command_key[i].command_inertia.CalcCmdKeyDelay(v, m_physics_dt);
 
                         if (bbeam_dir * cmd_beam.cmb_state->auto_moving_mode > 0)
                             v = 1;
@@ -927,9 +967,9 @@ void Actor::CalcCommands(bool doUpdate)
                             cf = crankfactor;
 
                         if (bbeam_dir > 0)
-                            ar_beams[bbeam].L *= (1.0 + cmd_beam.cmb_speed * v * cf * PHYSICS_DT / ar_beams[bbeam].L);
+                            ar_beams[bbeam].L *= (1.0 + cmd_beam.cmb_speed * v * cf * m_physics_dt / ar_beams[bbeam].L);
                         else
-                            ar_beams[bbeam].L *= (1.0 - cmd_beam.cmb_speed * v * cf * PHYSICS_DT / ar_beams[bbeam].L);
+                            ar_beams[bbeam].L *= (1.0 - cmd_beam.cmb_speed * v * cf * m_physics_dt / ar_beams[bbeam].L);
 
                         dl = fabs(dl - ar_beams[bbeam].L);
                         if (requestpower)
@@ -954,7 +994,7 @@ void Actor::CalcCommands(bool doUpdate)
                 if (ar_rotators[rota].needs_engine && ((ar_engine && !ar_engine->IsRunning()) || !ar_engine_hydraulics_ready))
                     continue;
 
-                v = ar_command_key[i].rotator_inertia.CalcCmdKeyDelay(ar_command_key[i].commandValue, PHYSICS_DT);
+                v = ar_command_key[i].rotator_inertia.CalcCmdKeyDelay(ar_command_key[i].commandValue, m_physics_dt);
 
                 if (v > 0.0f && ar_rotators[rota].engine_coupling > 0.0f)
                     requestpower = true;
@@ -965,9 +1005,9 @@ void Actor::CalcCommands(bool doUpdate)
                     cf = crankfactor;
 
                 if (ar_command_key[i].rotators[j] > 0)
-                    ar_rotators[rota].angle += ar_rotators[rota].rate * v * cf * PHYSICS_DT;
+                    ar_rotators[rota].angle += ar_rotators[rota].rate * v * cf * m_physics_dt;
                 else
-                    ar_rotators[rota].angle -= ar_rotators[rota].rate * v * cf * PHYSICS_DT;
+                    ar_rotators[rota].angle -= ar_rotators[rota].rate * v * cf * m_physics_dt;
 
                 if (doUpdate || v != 0.0f)
                 {
@@ -1060,7 +1100,7 @@ void Actor::CalcTies()
         float clen = it->ti_beam->L / it->ti_beam->refL;
         if (clen > it->ti_min_length)
         {
-            it->ti_beam->L *= (1.0 - it->ti_contract_speed * PHYSICS_DT / it->ti_beam->L);
+            it->ti_beam->L *= (1.0 - it->ti_contract_speed * m_physics_dt / it->ti_beam->L);
         }
         else
         {
@@ -1079,7 +1119,7 @@ void Actor::CalcTruckEngine(bool doUpdate)
 {
     if (ar_engine)
     {
-        ar_engine->UpdateEngineSim(PHYSICS_DT, doUpdate);
+        ar_engine->UpdateEngineSim(m_physics_dt, doUpdate);
     }
 }
 
@@ -1087,12 +1127,14 @@ void Actor::CalcReplay()
 {
     if (m_replay_handler && m_replay_handler->isValid())
     {
-        m_replay_handler->onPhysicsStep();
+        m_replay_handler->onPhysicsStep(m_physics_dt);
     }
 }
 
 bool Actor::CalcForcesEulerPrepare(bool doUpdate)
 {
+    ROR_PROFILE_SCOPE(PHYSICS_PREPARE);
+
     if (m_ongoing_reset)
         return false;
     if (ar_physics_paused)
@@ -1125,249 +1167,348 @@ void LogBeamNodes(RoR::Str<L>& msg, beam_t& beam) // Internal helper
     msg << ".";
 }
 
-void Actor::CalcBeams(bool trigger_hooks)
+float Actor::CalcBeamStress(int i, Real dislen, Real v, bool trigger_hooks)
 {
-    for (int i = 0; i < ar_num_beams; i++)
-    {
-        if (!ar_beams[i].bm_disabled && !ar_beams[i].bm_inter_actor)
-        {
-            // Calculate beam length
-            Vector3 dis = ar_beams[i].p1->RelPosition - ar_beams[i].p2->RelPosition;
+    // Calculate beam's deviation from normal
+    Real difftoBeamL = dislen - ar_beams[i].L;
 
-            Real dislen = dis.squaredLength();
-            Real inverted_dislen = fast_invSqrt(dislen);
+    Real k = ar_beams[i].k;
+    Real d = ar_beams[i].d;
 
-            dislen *= inverted_dislen;
-
-            // Calculate beam's deviation from normal
-            Real difftoBeamL = dislen - ar_beams[i].L;
+    if (ar_beams[i].bounded == SHOCK1)
+    {
+        float interp_ratio = 0.0f;
 
-            Real k = ar_beams[i].k;
-            Real d = ar_beams[i].d;
+        // Following code interpolates between defined beam parameters and default beam parameters
+        if (difftoBeamL > ar_beams[i].longbound * ar_beams[i].L)
+            interp_ratio = difftoBeamL - ar_beams[i].longbound * ar_beams[i].L;
+        else if (difftoBeamL < -ar_beams[i].shortbound * ar_beams[i].L)
+            interp_ratio = -difftoBeamL - ar_beams[i].shortbound * ar_beams[i].L;
 
-            // Calculate beam's rate of change
-            float v = (ar_beams[i].p1->Velocity - ar_beams[i].p2->Velocity).dotProduct(dis) * inverted_dislen;
+        if (interp_ratio != 0.0f)
+        {
+            // Hard (normal) shock bump
+            float tspring = DEFAULT_SPRING;
+            float tdamp = DEFAULT_DAMP;
 
-            if (ar_beams[i].bounded == SHOCK1)
+            // Skip camera, wheels or any other shocks which are not generated in a shocks or shocks2 section
+            if (ar_beams[i].bm_type == BEAM_HYDRO)
             {
-                float interp_ratio = 0.0f;
+                tspring = ar_beams[i].shock->sbd_spring;
+                tdamp = ar_beams[i].shock->sbd_damp;
+            }
 
-                // Following code interpolates between defined beam parameters and default beam parameters
-                if (difftoBeamL > ar_beams[i].longbound * ar_beams[i].L)
-                    interp_ratio = difftoBeamL - ar_beams[i].longbound * ar_beams[i].L;
-                else if (difftoBeamL < -ar_beams[i].shortbound * ar_beams[i].L)
-                    interp_ratio = -difftoBeamL - ar_beams[i].shortbound * ar_beams[i].L;
+            k += (tspring - k) * interp_ratio;
+            d += (tdamp - d) * interp_ratio;
+        }
+    }
+    else if (ar_beams[i].bounded == TRIGGER)
+    {
+        this->CalcTriggers(i, difftoBeamL, trigger_hooks);
+    }
+    else if (ar_beams[i].bounded == SHOCK2)
+    {
+        this->CalcShocks2(i, difftoBeamL, k, d, v);
+    }
+    else if (ar_beams[i].bounded == SHOCK3)
+    {
+        this->CalcShocks3(i, difftoBeamL, k, d, v);
+    }
+    else if (ar_beams[i].bounded == SUPPORTBEAM)
+    {
+        if (difftoBeamL > 0.0f)
+        {
+            k = 0.0f;
+            d *= 0.1f;
+            float break_limit = SUPPORT_BEAM_LIMIT_DEFAULT;
+            if (ar_beams[i].longbound > 0.0f)
+            {
+                // This is a supportbeam with a user set break limit, get the user set limit
+                break_limit = ar_beams[i].longbound;
+            }
 
-                if (interp_ratio != 0.0f)
+            // If support beam is extended the originallength * break_limit, break and disable it
+            if (difftoBeamL > ar_beams[i].L * break_limit)
+            {
+                ar_beams[i].bm_broken = true;
+                ar_beams[i].bm_disabled = true;
+                if (m_beam_break_debug_enabled)
                 {
-                    // Hard (normal) shock bump
-                    float tspring = DEFAULT_SPRING;
-                    float tdamp = DEFAULT_DAMP;
-
-                    // Skip camera, wheels or any other shocks which are not generated in a shocks or shocks2 section
-                    if (ar_beams[i].bm_type == BEAM_HYDRO)
-                    {
-                        tspring = ar_beams[i].shock->sbd_spring;
-                        tdamp = ar_beams[i].shock->sbd_damp;
-                    }
-
-                    k += (tspring - k) * interp_ratio;
-                    d += (tdamp - d) * interp_ratio;
+                    RoR::Str<300> msg;
+                    msg << "[RoR|Diag] XXX Support-Beam " << i << " limit extended and broke. "
+                        << "Length: " << difftoBeamL << " / max. Length: " << (ar_beams[i].L*break_limit) << ". ";
+                    LogBeamNodes(msg, ar_beams[i]);
+                    RoR::Log(msg.ToCStr());
                 }
             }
-            else if (ar_beams[i].bounded == TRIGGER)
-            {
-                this->CalcTriggers(i, difftoBeamL, trigger_hooks);
-            }
-            else if (ar_beams[i].bounded == SHOCK2)
+        }
+    }
+    else if (ar_beams[i].bounded == ROPE)
+    {
+        if (difftoBeamL < 0.0f)
+        {
+            k = 0.0f;
+            d *= 0.1f;
+        }
+    }
+
+    if (trigger_hooks && ar_beams[i].bounded && ar_beams[i].bm_type == BEAM_HYDRO)
+    {
+        ar_beams[i].debug_k = k * std::abs(difftoBeamL);
+        ar_beams[i].debug_d = d * std::abs(v);
+        ar_beams[i].debug_v = std::abs(v);
+    }
+
+    float slen = -k * difftoBeamL - d * v;
+    ar_beams[i].stress = slen;
+
+    // Fast test for deformation
+    float len = std::abs(slen);
+    if (len > ar_beams[i].minmaxposnegstress)
+    {
+        if (ar_beams[i].bm_type == BEAM_NORMAL && ar_beams[i].bounded != SHOCK1 && k != 0.0f)
+        {
+            // Actual deformation tests
+            if (slen > ar_beams[i].maxposstress && difftoBeamL < 0.0f) // compression
             {
-                this->CalcShocks2(i, difftoBeamL, k, d, v);
+                Real yield_length = ar_beams[i].maxposstress / k;
+                Real deform = difftoBeamL + yield_length * (1.0f - ar_beams[i].plastic_coef);
+                Real Lold = ar_beams[i].L;
+                ar_beams[i].L += deform;
+                ar_beams[i].L = std::max(MIN_BEAM_LENGTH, ar_beams[i].L);
+                slen = slen - (slen - ar_beams[i].maxposstress) * 0.5f;
+                len = slen;
+                if (ar_beams[i].L > 0.0f && Lold > ar_beams[i].L)
+                {
+                    ar_beams[i].maxposstress *= Lold / ar_beams[i].L;
+                    ar_beams[i].minmaxposnegstress = std::min(ar_beams[i].maxposstress, -ar_beams[i].maxnegstress);
+                    ar_beams[i].minmaxposnegstress = std::min(ar_beams[i].minmaxposnegstress, ar_beams[i].strength);
+                }
+                // For the compression case we do not remove any of the beam's
+                // strength for structure stability reasons
+                //ar_beams[i].strength += deform * k * 0.5f;
+                if (m_beam_deform_debug_enabled)
+                {
+                    RoR::Str<300> msg;
+                    msg << "[RoR|Diag] YYY Beam " << i << " just deformed with extension force "
+                        << len << " / " << ar_beams[i].strength << ". ";
+                    LogBeamNodes(msg, ar_beams[i]);
+                    RoR::Log(msg.ToCStr());
+                }
             }
-            else if (ar_beams[i].bounded == SHOCK3)
+            else if (slen < ar_beams[i].maxnegstress && difftoBeamL > 0.0f) // expansion
             {
-                this->CalcShocks3(i, difftoBeamL, k, d, v);
+                Real yield_length = ar_beams[i].maxnegstress / k;
+                Real deform = difftoBeamL + yield_length * (1.0f - ar_beams[i].plastic_coef);
+                Real Lold = ar_beams[i].L;
+                ar_beams[i].L += deform;
+                slen = slen - (slen - ar_beams[i].maxnegstress) * 0.5f;
+                len = -slen;
+                if (Lold > 0.0f && ar_beams[i].L > Lold)
+                {
+                    ar_beams[i].maxnegstress *= ar_beams[i].L / Lold;
+                    ar_beams[i].minmaxposnegstress = std::min(ar_beams[i].maxposstress, -ar_beams[i].maxnegstress);
+                    ar_beams[i].minmaxposnegstress = std::min(ar_beams[i].minmaxposnegstress, ar_beams[i].strength);
+                }
+                ar_beams[i].strength -= deform * k;
+                if (m_beam_deform_debug_enabled)
+                {
+                    RoR::Str<300> msg;
+                    msg << "[RoR|Diag] YYY Beam " << i << " just deformed with extension force "
+                        << len << " / " << ar_beams[i].strength << ". ";
+                    LogBeamNodes(msg, ar_beams[i]);
+                    RoR::Log(msg.ToCStr());
+                }
             }
-            else if (ar_beams[i].bounded == SUPPORTBEAM)
+        }
+
+        // Test if the beam should break
+        if (len > ar_beams[i].strength)
+        {
+            // Sound effect.
+            // Sound volume depends on springs stored energy
+            SOUND_MODULATE(ar_instance_id, SS_MOD_BREAK, 0.5 * k * difftoBeamL * difftoBeamL);
+            SOUND_PLAY_ONCE(ar_instance_id, SS_TRIG_BREAK);
+
+            //Break the beam only when it is not connected to a node
+            //which is a part of a collision triangle and has 2 "live" beams or less
+            //connected to it.
+            if (!((ar_beams[i].p1->nd_cab_node && GetNumActiveConnectedBeams(ar_beams[i].p1->pos) < 3) || (ar_beams[i].p2->nd_cab_node && GetNumActiveConnectedBeams(ar_beams[i].p2->pos) < 3)))
             {
-                if (difftoBeamL > 0.0f)
+                slen = 0.0f;
+                ar_beams[i].bm_broken = true;
+                ar_beams[i].bm_disabled = true;
+
+                if (m_beam_break_debug_enabled)
                 {
-                    k = 0.0f;
-                    d *= 0.1f;
-                    float break_limit = SUPPORT_BEAM_LIMIT_DEFAULT;
-                    if (ar_beams[i].longbound > 0.0f)
+                    RoR::Str<200> msg;
+                    msg << "[RoR|Diag] XXX Beam " << i << " just broke with force " << len << " / " << ar_beams[i].strength << ". ";
+                    LogBeamNodes(msg, ar_beams[i]);
+                    RoR::Log(msg.ToCStr());
+                }
+
+                // detachergroup check: beam[i] is already broken, check detacher group# == 0/default skip the check ( performance bypass for beams with default setting )
+                // only perform this check if this is a master detacher beams (positive detacher group id > 0)
+                if (ar_beams[i].detacher_group > 0)
+                {
+                    // cycle once through the other beams
+                    for (int j = 0; j < ar_num_beams; j++)
                     {
-                        // This is a supportbeam with a user set break limit, get the user set limit
-                        break_limit = ar_beams[i].longbound;
+                        // beam[i] detacher group# == checked beams detacher group# -> delete & disable checked beam
+                        // do this with all master(positive id) and minor(negative id) beams of this detacher group
+                        if (abs(ar_beams[j].detacher_group) == ar_beams[i].detacher_group)
+                        {
+                            ar_beams[j].bm_broken = true;
+                            ar_beams[j].bm_disabled = true;
+                            if (m_beam_break_debug_enabled)
+                            {
+                                LOG("Deleting Detacher BeamID: " + TOSTRING(j) + ", Detacher Group: " + TOSTRING(ar_beams[i].detacher_group)+ ", actor ID: " + TOSTRING(ar_instance_id));
+                            }
+                        }
                     }
-
-                    // If support beam is extended the originallength * break_limit, break and disable it
-                    if (difftoBeamL > ar_beams[i].L * break_limit)
+                    // cycle once through all wheels
+                    for (int j = 0; j < ar_num_wheels; j++)
                     {
-                        ar_beams[i].bm_broken = true;
-                        ar_beams[i].bm_disabled = true;
-                        if (m_beam_break_debug_enabled)
+                        if (ar_wheels[j].wh_detacher_group == ar_beams[i].detacher_group)
                         {
-                            RoR::Str<300> msg;
-                            msg << "[RoR|Diag] XXX Support-Beam " << i << " limit extended and broke. "
-                                << "Length: " << difftoBeamL << " / max. Length: " << (ar_beams[i].L*break_limit) << ". ";
-                            LogBeamNodes(msg, ar_beams[i]);
-                            RoR::Log(msg.ToCStr());
+                            ar_wheels[j].wh_is_detached = true;
                         }
                     }
                 }
             }
-            else if (ar_beams[i].bounded == ROPE)
+            else
             {
-                if (difftoBeamL < 0.0f)
-                {
-                    k = 0.0f;
-                    d *= 0.1f;
-                }
+                ar_beams[i].strength = 2.0f * ar_beams[i].minmaxposnegstress;
             }
 
-            if (trigger_hooks && ar_beams[i].bounded && ar_beams[i].bm_type == BEAM_HYDRO)
+            // something broke, check buoyant hull
+            for (int mk = 0; mk < ar_num_buoycabs; mk++)
             {
-                ar_beams[i].debug_k = k * std::abs(difftoBeamL);
-                ar_beams[i].debug_d = d * std::abs(v);
-                ar_beams[i].debug_v = std::abs(v);
+                int tmpv = ar_buoycabs[mk] * 3;
+                if (ar_buoycab_types[mk] == Buoyance::BUOY_DRAGONLY)
+                    continue;
+                if ((ar_beams[i].p1 == &ar_nodes[ar_cabs[tmpv]] || ar_beams[i].p1 == &ar_nodes[ar_cabs[tmpv + 1]] || ar_beams[i].p1 == &ar_nodes[ar_cabs[tmpv + 2]]) &&
+                    (ar_beams[i].p2 == &ar_nodes[ar_cabs[tmpv]] || ar_beams[i].p2 == &ar_nodes[ar_cabs[tmpv + 1]] || ar_beams[i].p2 == &ar_nodes[ar_cabs[tmpv + 2]]))
+                {
+                    m_buoyance->sink = true;
+                }
             }
+        }
+    }
 
-            float slen = -k * difftoBeamL - d * v;
-            ar_beams[i].stress = slen;
+    return slen;
+}
 
-            // Fast test for deformation
-            float len = std::abs(slen);
-            if (len > ar_beams[i].minmaxposnegstress)
+void Actor::CalcBeams(bool trigger_hooks)
+{
+    ROR_PROFILE_SCOPE(CALC_BEAMS);
+
+    if (m_split_physics)
+    {
+        this->CalcBeamsSplit(trigger_hooks);
+        return;
+    }
+
+    for (int i = 0; i < ar_num_beams; i++)
+    {
+        if (!ar_beams[i].bm_disabled && !ar_beams[i].bm_inter_actor)
+        {
+            // Calculate beam length
+            Vector3 dis = ar_beams[i].p1->RelPosition - ar_beams[i].p2->RelPosition;
+
+            Real dislen = dis.squaredLength();
+            Real inverted_dislen = fast_invSqrt(dislen);
+
+            dislen *= inverted_dislen;
+
+            // Calculate beam's rate of change
+            float v = (ar_beams[i].p1->Velocity - ar_beams[i].p2->Velocity).dotProduct(dis) * inverted_dislen;
+
+            float slen = this->CalcBeamStress(i, dislen, v, trigger_hooks);
+
+            // At last update the beam forces
+            Vector3 f = dis;
+            f *= (slen * inverted_dislen);
+            ar_beams[i].p1->Forces += f;
+            ar_beams[i].p2->Forces -= f;
+        }
+    }
+}
+
+void Actor::CalcBeamsSplit(bool trigger_hooks)
+{
+    // Plain beams below their deformation limit have no side effects; they run in parallel slices
+    // and every slice sums its forces into a private buffer. All other beams are left for a serial pass
+    // in beam order, so shocks, triggers, deformation and breaking happen in the same order as in the serial loop.
+    // Note: a beam switched on or off by a trigger in the serial pass only gets (or loses) its force on the next substep.
+    App::GetThreadPool()->ParallelFor(0, static_cast<int>(m_beam_chunks.size()), 1, [this](int c)
+        {
+            BeamChunk& chunk = m_beam_chunks[c];
+            std::fill(chunk.forces.begin(), chunk.forces.end(), Vector3::ZERO);
+            chunk.deferred.clear();
+            for (int pos = chunk.begin; pos < chunk.end; pos++)
             {
-                if (ar_beams[i].bm_type == BEAM_NORMAL && ar_beams[i].bounded != SHOCK1 && k != 0.0f)
+                const int i = m_split_beams[pos];
+                beam_t& beam = ar_beams[i];
+                if (beam.bm_disabled || beam.bm_inter_actor)
+                    continue;
+                if (beam.bm_type != BEAM_NORMAL || beam.bounded != NOSHOCK)
                 {
-                    // Actual deformation tests
-                    if (slen > ar_beams[i].maxposstress && difftoBeamL < 0.0f) // compression
-                    {
-                        Real yield_length = ar_beams[i].maxposstress / k;
-                        Real deform = difftoBeamL + yield_length * (1.0f - ar_beams[i].plastic_coef);
-                        Real Lold = ar_beams[i].L;
-                        ar_beams[i].L += deform;
-                        ar_beams[i].L = std::max(MIN_BEAM_LENGTH, ar_beams[i].L);
-                        slen = slen - (slen - ar_beams[i].maxposstress) * 0.5f;
-                        len = slen;
-                        if (ar_beams[i].L > 0.0f && Lold > ar_beams[i].L)
-                        {
-                            ar_beams[i].maxposstress *= Lold / ar_beams[i].L;
-                            ar_beams[i].minmaxposnegstress = std::min(ar_beams[i].maxposstress, -ar_beams[i].maxnegstress);
-                            ar_beams[i].minmaxposnegstress = std::min(ar_beams[i].minmaxposnegstress, ar_beams[i].strength);
-                        }
-                        // For the compression case we do not remove any of the beam's
-                        // strength for structure stability reasons
-                        //ar_beams[i].strength += deform * k * 0.5f;
-                        if (m_beam_deform_debug_enabled)
-                        {
-                            RoR::Str<300> msg;
-                            msg << "[RoR|Diag] YYY Beam " << i << " just deformed with extension force "
-                                << len << " / " << ar_beams[i].strength << ". ";
-                            LogBeamNodes(msg, ar_beams[i]);
-                            RoR::Log(msg.ToCStr());
-                        }
-                    }
-                    else if (slen < ar_beams[i].maxnegstress && difftoBeamL > 0.0f) // expansion
-                    {
-                        Real yield_length = ar_beams[i].maxnegstress / k;
-                        Real deform = difftoBeamL + yield_length * (1.0f - ar_beams[i].plastic_coef);
-                        Real Lold = ar_beams[i].L;
-                        ar_beams[i].L += deform;
-                        slen = slen - (slen - ar_beams[i].maxnegstress) * 0.5f;
-                        len = -slen;
-                        if (Lold > 0.0f && ar_beams[i].L > Lold)
-                        {
-                            ar_beams[i].maxnegstress *= ar_beams[i].L / Lold;
-                            ar_beams[i].minmaxposnegstress = std::min(ar_beams[i].maxposstress, -ar_beams[i].maxnegstress);
-                            ar_beams[i].minmaxposnegstress = std::min(ar_beams[i].minmaxposnegstress, ar_beams[i].strength);
-                        }
-                        ar_beams[i].strength -= deform * k;
-                        if (m_beam_deform_debug_enabled)
-                        {
-                            RoR::Str<300> msg;
-                            msg << "[RoR|Diag] YYY Beam " << i << " just deformed with extension force "
-                                << len << " / " << ar_beams[i].strength << ". ";
-                            LogBeamNodes(msg, ar_beams[i]);
-                            RoR::Log(msg.ToCStr());
-                        }
-                    }
+                    chunk.deferred.push_back(i);
+                    continue;
                 }
 
-                // Test if the beam should break
-                if (len > ar_beams[i].strength)
-                {
-                    // Sound effect.
-                    // Sound volume depends on springs stored energy
-                    SOUND_MODULATE(ar_instance_id, SS_MOD_BREAK, 0.5 * k * difftoBeamL * difftoBeamL);
-                    SOUND_PLAY_ONCE(ar_instance_id, SS_TRIG_BREAK);
+                // Calculate beam length
+                Vector3 dis = beam.p1->RelPosition - beam.p2->RelPosition;
 
-                    //Break the beam only when it is not connected to a node
-                    //which is a part of a collision triangle and has 2 "live" beams or less
-                    //connected to it.
-                    if (!((ar_beams[i].p1->nd_cab_node && GetNumActiveConnectedBeams(ar_beams[i].p1->pos) < 3) || (ar_beams[i].p2->nd_cab_node && GetNumActiveConnectedBeams(ar_beams[i].p2->pos) < 3)))
-                    {
-                        slen = 0.0f;
-                        ar_beams[i].bm_broken = true;
-                        ar_beams[i].bm_disabled = true;
+                Real dislen = dis.squaredLength();
+                Real inverted_dislen = fast_invSqrt(dislen);
 
-                        if (m_beam_break_debug_enabled)
-                        {
-                            RoR::Str<200> msg;
-                            msg << "[RoR|Diag] XXX Beam " << i << " just broke with force " << len << " / " << ar_beams[i].strength << ". ";
-                            LogBeamNodes(msg, ar_beams[i]);
-                            RoR::Log(msg.ToCStr());
-                        }
+                dislen *= inverted_dislen;
 
-                        // detachergroup check: beam[i] is already broken, check detacher group# == 0/default skip the check ( performance bypass for beams with default setting )
-                        // only perform this check if this is a master detacher beams (positive detacher group id > 0)
-                        if (ar_beams[i].detacher_group > 0)
-                        {
-                            // cycle once through the other beams
-                            for (int j = 0; j < ar_num_beams; j++)
-                            {
-                                // beam[i] detacher group# == checked beams detacher group# -> delete & disable checked beam
-                                // do this with all master(positive id) and minor(negative id) beams of this detacher group
-                                if (abs(ar_beams[j].detacher_group) == ar_beams[i].detacher_group)
-                                {
-                                    ar_beams[j].bm_broken = true;
-                                    ar_beams[j].bm_disabled = true;
-                                    if (m_beam_break_debug_enabled)
-                                    {
-                                        LOG("Deleting Detacher BeamID: " + TOSTRING(j) + ", Detacher Group: " + TOSTRING(ar_beams[i].detacher_group)+ ", actor ID: " + TOSTRING(ar_instance_id));
-                                    }
-                                }
-                            }
-                            // cycle once through all wheels
-                            for (int j = 0; j < ar_num_wheels; j++)
-                            {
-                                if (ar_wheels[j].wh_detacher_group == ar_beams[i].detacher_group)
-                                {
-                                    ar_wheels[j].wh_is_detached = true;
-                                }
-                            }
-                        }
-                    }
-                    else
-                    {
-                        ar_beams[i].strength = 2.0f * ar_beams[i].minmaxposnegstress;
-                    }
+                // Calculate beam's rate of change
+                float v = (beam.p1->Velocity - beam.p2->Velocity).dotProduct(dis) * inverted_dislen;
 
-                    // something broke, check buoyant hull
-                    for (int mk = 0; mk < ar_num_buoycabs; mk++)
-                    {
-                        int tmpv = ar_buoycabs[mk] * 3;
-                        if (ar_buoycab_types[mk] == Buoyance::BUOY_DRAGONLY)
-                            continue;
-                        if ((ar_beams[i].p1 == &ar_nodes[ar_cabs[tmpv]] || ar_beams[i].p1 == &ar_nodes[ar_cabs[tmpv + 1]] || ar_beams[i].p1 == &ar_nodes[ar_cabs[tmpv + 2]]) &&
-                            (ar_beams[i].p2 == &ar_nodes[ar_cabs[tmpv]] || ar_beams[i].p2 == &ar_nodes[ar_cabs[tmpv + 1]] || ar_beams[i].p2 == &ar_nodes[ar_cabs[tmpv + 2]]))
-                        {
-                            m_buoyance->sink = true;
-                        }
-                    }
+                // What CalcBeamStress() does for a plain beam, minus the deformation
+                float slen = -beam.k * (dislen - beam.L) - beam.d * v;
+                if (std::abs(slen) > beam.minmaxposnegstress)
+                {
+                    chunk.deferred.push_back(i);
+                    continue;
                 }
+                beam.stress = slen;
+
+                // At last update the beam forces
+                Vector3 f = dis;
+                f *= (slen * inverted_dislen);
+                chunk.forces[beam.p1->pos - chunk.node_min] += f;
+                chunk.forces[beam.p2->pos - chunk.node_min] -= f;
             }
+        });
+
+    m_deferred_beams.assign(m_serial_beams.begin(), m_serial_beams.end());
+    for (const BeamChunk& chunk: m_beam_chunks)
+    {
+        m_deferred_beams.insert(m_deferred_beams.end(), chunk.deferred.begin(), chunk.deferred.end());
+    }
+    std::sort(m_deferred_beams.begin(), m_deferred_beams.end());
+
+    for (int i: m_deferred_beams)
+    {
+        if (!ar_beams[i].bm_disabled && !ar_beams[i].bm_inter_actor)
+        {
+            // Calculate beam length
+            Vector3 dis = ar_beams[i].p1->RelPosition - ar_beams[i].p2->RelPosition;
+
+            Real dislen = dis.squaredLength();
+            Real inverted_dislen = fast_invSqrt(dislen);
+
+            dislen *= inverted_dislen;
+
+            // Calculate beam's rate of change
+            float v = (ar_beams[i].p1->Velocity - ar_beams[i].p2->Velocity).dotProduct(dis) * inverted_dislen;
+
+            float slen = this->CalcBeamStress(i, dislen, v, trigger_hooks);
 
             // At last update the beam forces
             Vector3 f = dis;
@@ -1376,6 +1517,18 @@ void Actor::CalcBeams(bool trigger_hooks)
             ar_beams[i].p2->Forces -= f;
         }
     }
+
+    // The slice buffers are added in fixed order, so the result doesn't depend on scheduling
+    App::GetThreadPool()->ParallelFor(0, ar_num_nodes, PHYSICS_SPLIT_NODE_GRAIN, [this](int node)
+        {
+            for (const BeamChunk& chunk: m_beam_chunks)
+            {
+                if (node >= chunk.node_min && node <= chunk.node_max)
+                {
+                    ar_nodes[node].Forces += chunk.forces[node - chunk.node_min];
+                }
+            }
+        });
 }
 
 void Actor::CalcBeamsInterActor()
@@ -1513,88 +1666,192 @@ void Actor::CalcBeamsInterActor()
 
 void Actor::CalcNodes()
 {
-    const auto water = App::GetSimTerrain()->getWater();
-    const float gravity = App::GetSimTerrain()->getGravity();
-    m_water_contact = false;
+    ROR_PROFILE_SCOPE(CALC_NODES);
+
+    // Split actors are integrated in chunks on the thread pool. Actor-wide side effects
+    // are collected per chunk and applied here, in node order, like the serial loop would.
+    const int num_chunks = (m_split_physics)
+        ? (ar_num_nodes + PHYSICS_SPLIT_NODE_GRAIN - 1) / PHYSICS_SPLIT_NODE_GRAIN
+        : 1;
+    m_calc_nodes_results.assign(num_chunks, CalcNodesResult());
+    m_ground_queries.resize(num_chunks);
+    m_turbulence_rng.NextStep();
+    m_turbulence.resize(3 * ar_num_nodes);
+    if (App::GetSimTerrain()->getWater())
+    {
+        m_water_query_pos.resize(ar_num_nodes);
+        m_water_heights.resize(ar_num_nodes);
+        m_water_velocities.resize((ar_num_buoycabs > 0) ? ar_num_nodes : 0);
+    }
 
-    for (int i = 0; i < ar_num_nodes; i++)
+    if (num_chunks == 1)
     {
-        // COLLISION
-        if (!ar_nodes[i].nd_no_ground_contact)
-        {
-            Vector3 oripos = ar_nodes[i].AbsPosition;
-            bool contacted = App::GetSimTerrain()->GetCollisions()->groundCollision(&ar_nodes[i], PHYSICS_DT);
-            contacted = contacted | App::GetSimTerrain()->GetCollisions()->nodeCollision(&ar_nodes[i], PHYSICS_DT, false);
-            ar_nodes[i].nd_has_ground_contact = contacted;
-            if (ar_nodes[i].nd_has_ground_contact || ar_nodes[i].nd_has_mesh_contact)
+        this->CalcNodesRange(0, ar_num_nodes, m_calc_nodes_results[0], m_ground_queries[0]);
+    }
+    else
+    {
+        App::GetThreadPool()->ParallelFor(0, num_chunks, 1, [this](int c)
             {
-                ar_last_fuzzy_ground_model = ar_nodes[i].nd_last_collision_gm;
-                // Reverts: commit/d11a88142f737528638bd357c38d717c85cebba6#diff-4003254e55aec2c60d21228f375f2a2dL1153
-                // Fixes: Gavril Omega Six sliding on ground on the simple2 spawn
-                // ar_nodes[i].AbsPosition - oripos is always zero ... dark floating point magic
-                ar_nodes[i].RelPosition += ar_nodes[i].AbsPosition - oripos;
-            }
-        }
+                const int begin = c * PHYSICS_SPLIT_NODE_GRAIN;
+                const int end = std::min(ar_num_nodes, begin + PHYSICS_SPLIT_NODE_GRAIN);
+                this->CalcNodesRange(begin, end, m_calc_nodes_results[c], m_ground_queries[c]);
+            });
+    }
 
-        if (i == ar_main_camera_node_pos)
-        {
-            // record g forces on cameras
-            m_camera_gforces_accu += ar_nodes[i].Forces / ar_nodes[i].mass;
-            // trigger script callbacks
-            App::GetSimTerrain()->GetCollisions()->nodeCollision(&ar_nodes[i], PHYSICS_DT, true);
-        }
+    m_water_contact = false;
+    bool exploded = false;
+    for (const CalcNodesResult& result: m_calc_nodes_results)
+    {
+        if (result.ground_contact)
+            ar_last_fuzzy_ground_model = result.last_fuzzy_ground_model;
+        if (result.water_contact)
+            m_water_contact = true;
+        exploded = exploded || result.exploded;
+    }
+
+    // anti-explsion guard (mach 20)
+    if (exploded && !m_ongoing_reset)
+    {
+        ActorModifyRequest* rq = new ActorModifyRequest; // actor exploded, schedule reset
+        rq->amr_actor = this;
+        rq->amr_type = ActorModifyRequest::Type::RESET_ON_SPOT;
+        App::GetGameContext()->PushMessage(Message(MSG_SIM_MODIFY_ACTOR_REQUESTED, (void*)rq));
+        m_ongoing_reset = true;
+    }
+
+    this->UpdateBoundingBoxes();
+}
+
+void Actor::CalcNodesRange(int begin, int end, CalcNodesResult& result, GroundQueryBatch& ground)
+{
+    const auto water = App::GetSimTerrain()->getWater();
+    const float gravity = App::GetSimTerrain()->getGravity();
+    Collisions* collisions = App::GetSimTerrain()->GetCollisions();
 
-        // integration
-        if (!ar_nodes[i].nd_immovable)
+    // Terrain contacts of the whole range in one pass; static mesh collisions follow node by node
+    collisions->groundCollisionBatch(ar_nodes, begin, end, m_physics_dt, ground);
+
+    // Turbulence of this range, a pure function of (seed, actor, step, node) - independent of chunking and threads
+    const bool turbulent_drag = !m_fusealge_airfoil && !ar_disable_aerodyn_turbulent_drag;
+    if (turbulent_drag)
+    {
+        m_turbulence_rng.Fill11(&m_turbulence[3 * begin], 3 * begin, 3 * (end - begin));
+    }
+
+    // Collision pass, only over the nodes which may touch the ground (listed by the batch above)
+    for (int i : ground.nodes)
+    {
+        Vector3 oripos = ar_nodes[i].AbsPosition;
+        bool contacted = ground.ground_contact[i - begin] != 0;
+        contacted = contacted | collisions->nodeCollision(&ar_nodes[i], m_physics_dt, false, &ground.cells[i - begin]);
+        ar_nodes[i].nd_has_ground_contact = contacted;
+        if (ar_nodes[i].nd_has_ground_contact || ar_nodes[i].nd_has_mesh_contact)
         {
-            ar_nodes[i].Velocity += ar_nodes[i].Forces / ar_nodes[i].mass * PHYSICS_DT;
-            ar_nodes[i].RelPosition += ar_nodes[i].Velocity * PHYSICS_DT;
-            ar_nodes[i].AbsPosition = ar_origin;
-            ar_nodes[i].AbsPosition += ar_nodes[i].RelPosition;
+            result.ground_contact = true;
+            result.last_fuzzy_ground_model = ar_nodes[i].nd_last_collision_gm;
+            // Reverts: commit/d11a88142f737528638bd357c38d717c85cebba6#diff-4003254e55aec2c60d21228f375f2a2dL1153
+            // Fixes: Gavril Omega Six sliding on ground on the simple2 spawn
+            // ar_nodes[i].AbsPosition - oripos is always zero ... dark floating point magic
+            ar_nodes[i].RelPosition += ar_nodes[i].AbsPosition - oripos;
         }
+    }
 
-        // prepare next loop (optimisation)
-        // we start forces from zero
-        // start with gravity
-        ar_nodes[i].Forces = Vector3(0, ar_nodes[i].mass * gravity, 0);
-
-        Real approx_speed = approx_sqrt(ar_nodes[i].Velocity.squaredLength());
+    if (ar_main_camera_node_pos >= begin && ar_main_camera_node_pos < end)
+    {
+        const int i = ar_main_camera_node_pos;
+        // record g forces on cameras
+        m_camera_gforces_accu += ar_nodes[i].Forces * ar_nodes[i].inv_mass;
+        // trigger script callbacks
+        collisions->nodeCollision(&ar_nodes[i], m_physics_dt, true, &ground.cells[i - begin]);
+    }
 
-        // anti-explsion guard (mach 20)
-        if (approx_speed > 6860 && !m_ongoing_reset)
+    // Integration pass; forces of the next substep start with gravity
+    float min_y = std::numeric_limits<float>::max();
+    for (int i = begin; i < end; i++)
+    {
+        node_t& n = ar_nodes[i];
+        if (!n.nd_immovable)
         {
-            ActorModifyRequest* rq = new ActorModifyRequest; // actor exploded, schedule reset
-            rq->amr_actor = this;
-            rq->amr_type = ActorModifyRequest::Type::RESET_ON_SPOT;
-            App::GetGameContext()->PushMessage(Message(MSG_SIM_MODIFY_ACTOR_REQUESTED, (void*)rq));
-            m_ongoing_reset = true;
+            n.Velocity += n.Forces * (n.inv_mass * m_physics_dt);
+            n.RelPosition += n.Velocity * m_physics_dt;
+            n.AbsPosition = ar_origin + n.RelPosition;
         }
+        n.Forces = Vector3(0, n.mass * gravity, 0);
+        min_y = std::min(min_y, n.AbsPosition.y);
+    }
 
-        if (m_fusealge_airfoil)
+    // Drag pass, one loop per aerodynamics model; also the anti-explosion guard (mach 20), see CalcNodes()
+    bool exploded = false;
+    if (m_fusealge_airfoil)
+    {
+        // aerodynamics on steroids!
+        for (int i = begin; i < end; i++)
         {
-            // aerodynamics on steroids!
+            exploded |= approx_sqrt(ar_nodes[i].Velocity.squaredLength()) > 6860;
             ar_nodes[i].Forces += ar_fusedrag;
         }
-        else if (!ar_disable_aerodyn_turbulent_drag)
+    }
+    else if (!ar_disable_aerodyn_turbulent_drag)
+    {
+        for (int i = begin; i < end; i++)
         {
+            const Real approx_speed = approx_sqrt(ar_nodes[i].Velocity.squaredLength());
+            exploded |= approx_speed > 6860;
             // add viscous drag (turbulent model)
             Real defdragxspeed = DEFAULT_DRAG * approx_speed;
             Vector3 drag = -defdragxspeed * ar_nodes[i].Velocity;
             // plus: turbulences
             Real maxtur = defdragxspeed * approx_speed * 0.005f;
-            drag += maxtur * Vector3(frand_11(), frand_11(), frand_11());
+            drag += maxtur * Vector3(m_turbulence[3 * i], m_turbulence[3 * i + 1], m_turbulence[3 * i + 2]);
             ar_nodes[i].Forces += drag;
         }
+    }
+    else
+    {
+        for (int i = begin; i < end; i++)
+        {
+            exploded |= approx_sqrt(ar_nodes[i].Velocity.squaredLength()) > 6860;
+        }
+    }
+    result.exploded = exploded;
 
-        if (water)
+    // Water pass, only if the range reaches below the highest possible wave
+    const float max_water_height = (water) ? water->GetMaxWaterHeight() : 0.f;
+    if (water && min_y > max_water_height)
+    {
+        // Buoyancy and screwprops only compare positions against these heights, so all nodes stay dry
+        std::fill(m_water_heights.begin() + begin, m_water_heights.begin() + end, max_water_height);
+        if (ar_num_buoycabs > 0)
+        {
+            std::fill(m_water_velocities.begin() + begin, m_water_velocities.begin() + end, Vector3::ZERO);
+        }
+        for (int i = begin; i < end; i++)
         {
-            const bool is_under_water = water->IsUnderWater(ar_nodes[i].AbsPosition);
+            ar_nodes[i].nd_under_water = false;
+        }
+    }
+    else if (water)
+    {
+        // Wave surface at all nodes of the range in one batch, at the sim time of this substep.
+        // `CalcBuoyance()` and the screwprops reuse it, so each node is evaluated once per substep.
+        for (int i = begin; i < end; i++)
+        {
+            m_water_query_pos[i] = ar_nodes[i].AbsPosition;
+        }
+        water->CalcWavesBatch(App::GetGameContext()->GetActorManager()->GetPhysicsTime(),
+            &m_water_query_pos[begin], end - begin, &m_water_heights[begin],
+            (ar_num_buoycabs > 0) ? &m_water_velocities[begin] : nullptr);
+
+        for (int i = begin; i < end; i++)
+        {
+            const bool is_under_water = ar_nodes[i].AbsPosition.y < m_water_heights[i];
             if (is_under_water)
             {
-                m_water_contact = true;
+                result.water_contact = true;
                 if (ar_num_buoycabs == 0)
                 {
                     // water drag (turbulent)
+                    Real approx_speed = approx_sqrt(ar_nodes[i].Velocity.squaredLength());
                     ar_nodes[i].Forces -= (DEFAULT_WATERDRAG * approx_speed) * ar_nodes[i].Velocity;
                     // basic buoyance
                     ar_nodes[i].Forces += ar_nodes[i].buoyancy * Vector3::UNIT_Y;
@@ -1608,8 +1865,6 @@ void Actor::CalcNodes()
             ar_nodes[i].nd_under_water = is_under_water;
         }
     }
-
-    this->UpdateBoundingBoxes();
 }
 
 void Actor::CalcHooks()
@@ -1618,7 +1873,7 @@ void Actor::CalcHooks()
     for (std::vector<hook_t>::iterator it = ar_hooks.begin(); it != ar_hooks.end(); it++)
     {
         //we need to do this here to avoid countdown speedup by triggers
-        it->hk_timer = std::max(0.0f, it->hk_timer - PHYSICS_DT);
+        it->hk_timer = std::max(0.0f, it->hk_timer - m_physics_dt);
 
         if (it->hk_lock_node && it->hk_locked == PRELOCK)
         {
@@ -44,6 +44,7 @@
 #include "MovableText.h"
 #include "Network.h"
 #include "PointColDetector.h"
+#include "Profiler.h"
 #include "Replay.h"
 #include "RigDef_Validator.h"
 #include "ActorSpawner.h"
@@ -54,6 +55,8 @@
 #include "Utils.h"
 #include "VehicleAI.h"
 
+#include <chrono>
+
 using namespace Ogre;
 using namespace RoR;
 
@@ -66,7 +69,7 @@ ActorManager::ActorManager()
     , m_simulation_speed(1.0f)
 {
     // Create worker thread (used for physics calculations)
-    m_sim_thread_pool = std::unique_ptr<ThreadPool>(new ThreadPool(1));
+    m_sim_thread_pool = std::unique_ptr<ThreadPool>(new ThreadPool(1, "Sim"));
 }
 
 ActorManager::~ActorManager()
@@ -193,6 +196,9 @@ void ActorManager::SetupActor(Actor* actor, ActorSpawnRequest rq, std::shared_pt
     //compute node connectivity graph
     actor->calcNodeConnectivityGraph();
 
+    // spread big actors across the thread pool
+    actor->SetupPhysicsSplit();
+
     actor->UpdateBoundingBoxes();
     actor->calculateAveragePosition();
 
@@ -255,6 +261,7 @@ void ActorManager::SetupActor(Actor* actor, ActorSpawnRequest rq, std::shared_pt
     }
 
     // Initialize visuals
+    actor->PublishSimSnapshot();
     actor->updateVisual();
     actor->ToggleLights();
     actor->GetGfxActor()->SetDebugView((GfxActor::DebugViewType)rq.asr_debugview);
@@ -350,6 +357,8 @@ Actor* ActorManager::CreateActorInstance(ActorSpawnRequest rq, std::shared_ptr<R
     this->SetupActor(actor, rq, def);
 
     m_actors.push_back(actor);
+    m_physics_graph_dirty = true;
+    m_broadphase.Clear();
 
     return actor;
 }
@@ -644,11 +653,15 @@ void ActorManager::RecursiveActivation(int j, std::vector<bool>& visited)
 
     visited[j] = true;
 
-    for (unsigned int t = 0; t < m_actors.size(); t++)
+    // Only actors whose boxes come close can pass the tests below
+    for (Actor* candidate: m_broadphase.GetCandidates(m_actors[j]))
     {
-        if (t == j || visited[t])
+        const int t = candidate->ar_vector_index;
+        if (visited[t])
             continue;
-        if (m_actors[t]->ar_sim_state == Actor::SimState::LOCAL_SIMULATED && CheckActorCollAabbIntersect(t, j))
+        // Dozing actors skip substeps - wake them up before contact, not after
+        if (m_actors[t]->ar_sim_state == Actor::SimState::LOCAL_SIMULATED &&
+            (CheckActorCollAabbIntersect(t, j) || (m_actors[t]->ar_physics_dozing && PredictActorCollAabbIntersect(t, j))))
         {
             m_actors[t]->ar_sleep_counter = 0.0f;
             this->RecursiveActivation(t, visited);
@@ -724,6 +737,20 @@ void ActorManager::ForwardCommands(Actor* source_actor)
     }
 }
 
+float ActorManager::GetIslandRestTime(Actor* actor)
+{
+    // `Actor::m_linked_actors` is the transitive closure of hooks, ties, ropes and other inter-actor beams
+    float rest_time = actor->ar_sleep_counter;
+    for (auto linked_actor : actor->m_linked_actors)
+    {
+        if (linked_actor->ar_sim_state == Actor::SimState::LOCAL_SIMULATED)
+        {
+            rest_time = std::min(rest_time, linked_actor->ar_sleep_counter);
+        }
+    }
+    return rest_time;
+}
+
 void ActorManager::UpdateSleepingState(Actor* player_actor, float dt)
 {
     if (!m_forced_awake)
@@ -739,8 +766,13 @@ void ActorManager::UpdateSleepingState(Actor* player_actor, float dt)
             }
 
             actor->ar_sleep_counter += dt;
+        }
 
-            if (actor->ar_sleep_counter >= 10.0f)
+        // Linked actors fall asleep together, when all of them have been resting long enough
+        for (auto actor : m_actors)
+        {
+            if (actor->ar_sim_state == Actor::SimState::LOCAL_SIMULATED &&
+                this->GetIslandRestTime(actor) >= ISLAND_SLEEP_REST_TIME)
             {
                 actor->ar_sim_state = Actor::SimState::LOCAL_SLEEPING;
             }
@@ -752,6 +784,8 @@ void ActorManager::UpdateSleepingState(Actor* player_actor, float dt)
         player_actor->ar_sim_state = Actor::SimState::LOCAL_SIMULATED;
     }
 
+    m_broadphase.Update(m_actors);
+
     std::vector<bool> visited(m_actors.size());
     // Recursivly activate all actors which can be reached from current actor
     if (player_actor && player_actor->ar_sim_state == Actor::SimState::LOCAL_SIMULATED)
@@ -765,6 +799,36 @@ void ActorManager::UpdateSleepingState(Actor* player_actor, float dt)
         if (m_actors[t]->ar_sim_state == Actor::SimState::LOCAL_SIMULATED && m_actors[t]->ar_sleep_counter == 0.0f)
             this->RecursiveActivation(t, visited);
     }
+
+    // Linked actors wake up together - a sleeping trailer must not hang on a moving truck
+    for (auto actor : m_actors)
+    {
+        if (actor->ar_sim_state != Actor::SimState::LOCAL_SLEEPING)
+            continue;
+        for (auto linked_actor : actor->m_linked_actors)
+        {
+            if (linked_actor->ar_sim_state == Actor::SimState::LOCAL_SIMULATED)
+            {
+                actor->ar_sim_state = Actor::SimState::LOCAL_SIMULATED;
+                actor->ar_sleep_counter = 0.0f;
+                break;
+            }
+        }
+    }
+
+    // Resting islands which stay awake (recently stopped, or forced awake) may run at a coarser rate.
+    // Inter-actor beams couple the whole island, so it dozes as one - never with the player in it,
+    // and only if every member stays stable at the longer step (see `Actor::UpdateDozeStability()`).
+    const bool dozing_enabled = App::sim_island_dozing->GetBool() && !m_forced_awake;
+    for (auto actor : m_actors)
+    {
+        actor->ar_physics_dozing = dozing_enabled && actor != player_actor &&
+            actor->ar_sim_state == Actor::SimState::LOCAL_SIMULATED &&
+            actor->m_doze_stable &&
+            std::all_of(actor->m_linked_actors.begin(), actor->m_linked_actors.end(), [](Actor* a) { return a->m_doze_stable; }) &&
+            this->GetIslandRestTime(actor) >= ISLAND_DOZE_REST_TIME &&
+            std::find(actor->m_linked_actors.begin(), actor->m_linked_actors.end(), player_actor) == actor->m_linked_actors.end();
+    }
 }
 
 void ActorManager::WakeUpAllActors()
@@ -864,7 +928,8 @@ void ActorManager::CleanUpSimulation() // Called after simulation finishes
     }
     m_actors.clear();
 
-    m_total_sim_time = 0.f;
+    m_total_sim_time = 0.0;
+    m_physics_time = 0.0;
     m_last_simulation_speed = 0.1f;
     m_simulation_paused = false;
     m_simulation_speed = 1.f;
@@ -894,6 +959,8 @@ void ActorManager::DeleteActorInternal(Actor* actor)
 #endif // USE_SOCKETW
 
     m_actors.erase(std::remove(m_actors.begin(), m_actors.end(), actor), m_actors.end());
+    m_physics_graph_dirty = true;
+    m_broadphase.Clear();
     delete actor;
 
     // Upate actor indices
@@ -1069,16 +1136,24 @@ void ActorManager::UpdateActors(Actor* player_actor)
         }
     }
 
+    // Physics is stopped; pack static collision elements added meanwhile. From here until `SyncWithSimThread()`,
+    // elements added on the main thread stay staged, main thread queries only see the packed grid.
+    App::GetSimTerrain()->GetCollisions()->UpdateGrid();
+
     auto func = std::function<void()>([this]()
         {
             this->UpdatePhysicsSimulation();
         });
-    m_sim_task = m_sim_thread_pool->RunTask(func);
+    // Read the sim clock while we still can; it's where the physics will be once this frame is done.
+    m_total_sim_time = m_physics_time + m_physics_steps * static_cast<double>(PHYSICS_DT);
 
-    m_total_sim_time += dt;
+    m_sim_player_actor = player_actor;
+    App::GetSimTerrain()->GetCollisions()->SetGridInUse(true);
+    m_sim_task = m_sim_thread_pool->RunTask(func);
+    m_sim_task_running = true;
 
     if (!App::app_async_physics->GetBool())
-        m_sim_task->join();
+        this->SyncWithSimThread();
 }
 
 Actor* ActorManager::GetActorById(int actor_id)
@@ -1093,71 +1168,169 @@ Actor* ActorManager::GetActorById(int actor_id)
     return 0;
 }
 
+void ActorManager::BuildPhysicsTaskGraph()
+{
+    const size_t num_actors = m_actors.size();
+    m_compute_tasks.reserve(num_actors);
+    m_collision_tasks.reserve(num_actors);
+    if (m_collision_buffers.size() < num_actors)
+    {
+        m_collision_buffers.resize(num_actors);
+    }
+    m_inter_group_actors.reserve(num_actors);
+    m_inter_group_offsets.reserve(num_actors + 1);
+    m_inter_group_visited.assign(num_actors, false);
+    this->UpdateInterActorGroups();
+    m_physics_graph_dirty = false;
+}
+
+void ActorManager::UpdateInterActorGroups()
+{
+    // `Actor::m_linked_actors` already holds the transitive closure of inter-actor links,
+    // so every actor together with its linked actors forms one group which must be processed serially.
+    m_inter_group_actors.clear();
+    m_inter_group_offsets.clear();
+    std::fill(m_inter_group_visited.begin(), m_inter_group_visited.end(), false);
+
+    for (auto actor : m_actors)
+    {
+        if (m_inter_group_visited[actor->ar_vector_index] || actor->m_linked_actors.empty())
+            continue;
+
+        m_inter_group_offsets.push_back(static_cast<int>(m_inter_group_actors.size()));
+        m_inter_group_visited[actor->ar_vector_index] = true;
+        m_inter_group_actors.push_back(actor);
+        for (auto linked_actor : actor->m_linked_actors)
+        {
+            if (!m_inter_group_visited[linked_actor->ar_vector_index])
+            {
+                m_inter_group_visited[linked_actor->ar_vector_index] = true;
+                m_inter_group_actors.push_back(linked_actor);
+            }
+        }
+    }
+    m_inter_group_offsets.push_back(static_cast<int>(m_inter_group_actors.size()));
+}
+
 void ActorManager::UpdatePhysicsSimulation()
 {
+    ROR_PROFILE_SCOPE(PHYSICS);
+
+    if (m_physics_graph_dirty)
+    {
+        this->BuildPhysicsTaskGraph();
+    }
+
     for (auto actor : m_actors)
     {
         actor->UpdatePhysicsOrigin();
+        actor->m_num_substeps_run = 0;
     }
+    // Dozing islands run the first substep (per-frame updates) and every `ISLAND_DOZE_SUBSTEP_STRIDE`-th after it,
+    // each advancing by the substeps up to the next one - the island covers the whole frame in fewer, longer steps.
+    const int doze_steps = (m_physics_steps + ISLAND_DOZE_SUBSTEP_STRIDE - 1) / ISLAND_DOZE_SUBSTEP_STRIDE;
+    typedef std::chrono::steady_clock Clock;
     for (int i = 0; i < m_physics_steps; i++)
     {
+        // Prepare (serial: hooks and ropes may link actors together)
+        const Clock::time_point t_prepare = Clock::now();
+        const bool doze_step = (i % ISLAND_DOZE_SUBSTEP_STRIDE == 0);
+        m_compute_tasks.clear();
+        for (auto actor : m_actors)
         {
-            std::vector<std::function<void()>> tasks;
-            for (auto actor : m_actors)
+            if (actor->ar_physics_dozing && !doze_step)
             {
-                if (actor->ar_update_physics = actor->CalcForcesEulerPrepare(i == 0))
-                {
-                    auto func = std::function<void()>([this, i, actor]()
-                        {
-                            actor->CalcForcesEulerCompute(i == 0, m_physics_steps);
-                        });
-                    tasks.push_back(func);
-                }
+                actor->ar_update_physics = false; // Integrated by the last doze step
+                continue;
             }
-            App::GetThreadPool()->Parallelize(tasks);
-            for (auto actor : m_actors)
+            actor->m_physics_dt = (actor->ar_physics_dozing)
+                ? PHYSICS_DT * std::min(ISLAND_DOZE_SUBSTEP_STRIDE, m_physics_steps - i)
+                : PHYSICS_DT;
+            if (actor->ar_update_physics = actor->CalcForcesEulerPrepare(i == 0))
             {
-                if (actor->ar_update_physics)
-                {
-                    actor->CalcBeamsInterActor();
-                }
+                m_compute_tasks.push_back(actor);
+                actor->m_num_substeps_run++;
             }
         }
+
+        // Per-actor compute
+        const Clock::time_point t_compute = Clock::now();
+        const bool do_update = (i == 0);
+        App::GetThreadPool()->ParallelFor(0, static_cast<int>(m_compute_tasks.size()), 1, [this, do_update, doze_steps](int t)
+            {
+                Actor* actor = m_compute_tasks[t];
+                actor->CalcForcesEulerCompute(do_update, actor->ar_physics_dozing ? doze_steps : m_physics_steps);
+            });
+
+        // Inter-actor beams; groups of linked actors are independent of each other
+        const Clock::time_point t_inter_beams = Clock::now();
+        if (m_physics_graph_dirty) // Links changed in the prepare phase (hooks, ropes)
         {
-            std::vector<std::function<void()>> tasks;
-            for (auto actor : m_actors)
+            this->BuildPhysicsTaskGraph();
+        }
+        App::GetThreadPool()->ParallelFor(0, static_cast<int>(m_inter_group_offsets.size()) - 1, 1, [this](int g)
             {
-                if (actor->m_inter_point_col_detector != nullptr && (actor->ar_update_physics ||
-                        (App::mp_pseudo_collisions->GetBool() && actor->ar_sim_state == Actor::SimState::NETWORKED_OK)))
+                for (int a = m_inter_group_offsets[g]; a < m_inter_group_offsets[g + 1]; a++)
                 {
-                    auto func = std::function<void()>([this, actor]()
-                        {
-                            actor->m_inter_point_col_detector->UpdateInterPoint();
-                            if (actor->ar_collision_relevant)
-                            {
-                                ResolveInterActorCollisions(PHYSICS_DT,
-                                    *actor->m_inter_point_col_detector,
-                                    actor->ar_num_collcabs,
-                                    actor->ar_collcabs,
-                                    actor->ar_cabs,
-                                    actor->ar_inter_collcabrate,
-                                    actor->ar_nodes,
-                                    actor->ar_collision_range,
-                                    *actor->ar_submesh_ground_model);
-                            }
-                        });
-                    tasks.push_back(func);
+                    if (m_inter_group_actors[a]->ar_update_physics)
+                    {
+                        m_inter_group_actors[a]->CalcBeamsInterActor();
+                    }
                 }
+            });
+
+        // Inter-actor collisions
+        const Clock::time_point t_collisions = Clock::now();
+        m_broadphase.Update(m_actors);
+        m_collision_tasks.clear();
+        for (auto actor : m_actors)
+        {
+            if (actor->m_inter_point_col_detector != nullptr && (actor->ar_update_physics ||
+                    (App::mp_pseudo_collisions->GetBool() && actor->ar_sim_state == Actor::SimState::NETWORKED_OK)))
+            {
+                m_collision_tasks.push_back(actor);
             }
-            App::GetThreadPool()->Parallelize(tasks);
         }
+        App::GetThreadPool()->ParallelFor(0, static_cast<int>(m_collision_tasks.size()), 1, [this](int t)
+            {
+                ROR_PROFILE_SCOPE(INTER_COLLISIONS);
+                Actor* actor = m_collision_tasks[t];
+                m_collision_buffers[t].contacts.clear();
+                actor->m_inter_point_col_detector->UpdateInterPoint();
+                if (actor->ar_collision_relevant)
+                {
+                    ResolveInterActorCollisions(actor->m_physics_dt,
+                        *actor->m_inter_point_col_detector,
+                        actor->ar_num_collcabs,
+                        actor->ar_collcabs,
+                        actor->ar_cabs,
+                        actor->ar_inter_collcabrate,
+                        actor->ar_nodes,
+                        actor->ar_collision_range,
+                        *actor->ar_submesh_ground_model,
+                        m_collision_buffers[t]);
+                }
+            });
+        for (size_t t = 0; t < m_collision_tasks.size(); t++)
+        {
+            ApplyInterActorContacts(m_collision_buffers[t].contacts);
+        }
+
+        const Clock::time_point t_end = Clock::now();
+        m_phase_times.prepare_sec     += std::chrono::duration<double>(t_compute - t_prepare).count();
+        m_phase_times.compute_sec     += std::chrono::duration<double>(t_inter_beams - t_compute).count();
+        m_phase_times.inter_beams_sec += std::chrono::duration<double>(t_collisions - t_inter_beams).count();
+        m_phase_times.collisions_sec  += std::chrono::duration<double>(t_end - t_collisions).count();
+        m_phase_times.num_substeps++;
+
+        m_physics_time += PHYSICS_DT;
     }
     for (auto actor : m_actors)
     {
         actor->m_ongoing_reset = false;
-        if (actor->ar_update_physics && m_physics_steps > 0)
+        if (actor->m_num_substeps_run > 0)
         {
-            Vector3  camera_gforces = actor->m_camera_gforces_accu / m_physics_steps;
+            Vector3  camera_gforces = actor->m_camera_gforces_accu / actor->m_num_substeps_run;
             actor->m_camera_gforces_accu = Vector3::ZERO;
             actor->m_camera_gforces = actor->m_camera_gforces * 0.5f + camera_gforces * 0.5f;
             actor->calculateLocalGForces();
@@ -1168,12 +1341,39 @@ void ActorManager::UpdatePhysicsSimulation()
             actor->ar_top_speed = std::max(actor->ar_top_speed, actor->ar_nodes[0].Velocity.length());
         }
     }
+
+    // Hand the final positions to the renderer (same condition as `GfxActor::IsActorLive()`, plus sleeping actors moved meanwhile)
+    App::GetThreadPool()->ParallelFor(0, static_cast<int>(m_actors.size()), 1, [this](int t)
+        {
+            if (m_actors[t]->ar_sim_state != Actor::SimState::LOCAL_SLEEPING || m_actors[t]->m_sim_snapshot_stale)
+            {
+                m_actors[t]->PublishSimSnapshot();
+            }
+        });
 }
 
 void ActorManager::SyncWithSimThread()
 {
+    ROR_PROFILE_EVENT("SyncWithSimThread");
     if (m_sim_task)
         m_sim_task->join();
+    if (m_sim_task_running && App::GetSimTerrain())
+    {
+        App::GetSimTerrain()->GetCollisions()->SetGridInUse(false);
+    }
+    m_sim_task_running = false;
+}
+
+void ActorManager::RunSimCommands()
+{
+    // Commands may queue more commands; those run next frame
+    const size_t num_commands = m_sim_commands.size();
+    for (size_t i = 0; i < num_commands; i++)
+    {
+        const SimCommand cmd = m_sim_commands[i]; // Copy; the vector may reallocate
+        cmd.func(cmd.dt);
+    }
+    m_sim_commands.erase(m_sim_commands.begin(), m_sim_commands.begin() + num_commands);
 }
 
 void HandleErrorLoadingFile(std::string type, std::string filename, std::string exception_msg)
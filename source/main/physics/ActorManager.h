@@ -26,8 +26,10 @@
 
 #include "Application.h"
 
+#include "ActorBroadphase.h"
 #include "SimData.h"
 #include "CmdKeyInertia.h"
+#include "DynamicCollisions.h"
 #include "Network.h"
 #include "RigDef_Prerequisites.h"
 #include "ThreadPool.h"
@@ -44,13 +46,38 @@ class ActorManager
 {
 public:
 
+    /// Wall-clock time spent in the phases of `UpdatePhysicsSimulation()`, accumulated until reset.
+    struct PhysicsPhaseTimes
+    {
+        double     prepare_sec      = 0.0;
+        double     compute_sec      = 0.0;
+        double     inter_beams_sec  = 0.0;
+        double     collisions_sec   = 0.0;
+        long       num_substeps     = 0;
+    };
+
+    typedef void (*SimCommandFunc)(float dt);
+
+    struct SimCommand //!< See `QueueSimCommand()`; a plain function pointer, so that queueing doesn't allocate
+    {
+        SimCommandFunc func;
+        float          dt;
+    };
+
     ActorManager();
     ~ActorManager();
 
     Actor*         CreateActorInstance(ActorSpawnRequest rq, std::shared_ptr<RigDef::File> def);
     void           UpdateActors(Actor* player_actor);
     void           SyncWithSimThread();
+    void           QueueSimCommand(SimCommandFunc func, float dt) { m_sim_commands.push_back({func, dt}); } //!< Defers main-thread work on actors until `RunSimCommands()`; see cvar 'app_pipelined_physics'
+    void           RunSimCommands();                       //!< Runs queued commands in order; call after `SyncWithSimThread()`
+    bool           IsSimThreadRunning() const              { return m_sim_task_running; } //!< Main thread only; true while live actor data is off limits
+    Actor*         GetSimPlayerActor() const               { return m_sim_player_actor; } //!< Player actor as of the last `UpdateActors()`; safe to read from the sim thread
     void           UpdatePhysicsSimulation();
+    void           SetPhysicsSteps(int steps)              { m_physics_steps = steps; } //!< Only for driving `UpdatePhysicsSimulation()` directly, like RoR_simbench does
+    const PhysicsPhaseTimes& GetPhysicsPhaseTimes() const  { return m_phase_times; }
+    void           ResetPhysicsPhaseTimes()                { m_phase_times = PhysicsPhaseTimes(); }
     void           WakeUpAllActors();
     void           SendAllActorsSleeping();
     unsigned long  GetNetTime()                            { return m_net_timer.getMilliseconds(); };
@@ -67,7 +94,8 @@ public:
     float          GetSimulationSpeed() const              { return m_simulation_speed; };
     bool           IsSimulationPaused() const              { return m_simulation_paused; }
     void           SetSimulationPaused(bool v)             { m_simulation_paused = v; }
-    float          GetTotalTime() const                    { return m_total_sim_time; }
+    double         GetTotalTime() const                    { return m_total_sim_time; } //!< Sim time at the end of the frame being simulated, for the main thread
+    double         GetPhysicsTime() const                  { return m_physics_time; } //!< Sim time of the running substep; only valid during `UpdatePhysicsSimulation()`
     RoR::CmdKeyInertiaConfig& GetInertiaConfig()           { return m_inertia_config; }
     Actor*         FetchNextVehicleOnList(Actor* player, Actor* prev_player);
     Actor*         FetchPreviousVehicleOnList(Actor* player, Actor* prev_player);
@@ -99,6 +127,8 @@ public:
 
     std::vector<Actor*> GetActors() const                  { return m_actors; };
     std::vector<Actor*> GetLocalActors();
+    const ActorBroadphase& GetBroadphase() const          { return m_broadphase; }
+    void           InvalidatePhysicsTaskGraph()            { m_physics_graph_dirty = true; } //!< Call when actors get linked or unlinked
 
     std::pair<Actor*, float> GetNearestActor(Ogre::Vector3 position);
 
@@ -112,8 +142,11 @@ private:
     bool           PredictActorCollAabbIntersect(int a, int b);  //!< Returns whether or not the bounding boxes of truck a and truck b might intersect during the next framestep. Based on the truck collision bounding boxes.
     void           RemoveStreamSource(int sourceid);
     void           RecursiveActivation(int j, std::vector<bool>& visited);
+    float          GetIslandRestTime(Actor* actor);     //!< Shortest idle time among the locally simulated actors linked to `actor`, including itself.
     void           ForwardCommands(Actor* source_actor); //!< Fowards things to trailers
     void           UpdateTruckFeatures(Actor* vehicle, float dt);
+    void           BuildPhysicsTaskGraph();      //!< Sizes the per-substep task lists and groups linked actors; called when actors or links change.
+    void           UpdateInterActorGroups();     //!< Partitions actors connected by inter-actor beams into independent groups.
 
     // Networking
     std::map<int, std::set<int>> m_stream_mismatches; //!< Networking: A set of streams without a corresponding actor in the actor-array for each stream source
@@ -129,11 +162,28 @@ private:
     float               m_last_simulation_speed  = 0.1f;  //!< previously used time ratio between real time (evt.timeSinceLastFrame) and physics time ('dt' used in calcPhysics)
     float               m_simulation_time        = 0.f;   //!< Amount of time the physics simulation is going to be advanced
     bool                m_simulation_paused      = false;
-    float               m_total_sim_time         = 0.f;
+    double              m_total_sim_time         = 0.0;   //!< Main thread's copy of `m_physics_time`, taken while physics is stopped
+    double              m_physics_time           = 0.0;   //!< The sim clock; advanced by the sim thread per substep
+
+    // Physics task graph: prepare -> per-actor compute -> inter-actor beams (per group) -> inter-actor collisions
+    // Built by `BuildPhysicsTaskGraph()` when actors are added/removed or linked/unlinked, replayed by `UpdatePhysicsSimulation()`
+    // for every substep. Only the lists of awake actors are refilled per substep, without allocating.
+    bool                m_physics_graph_dirty    = true;  //!< Set by `InvalidatePhysicsTaskGraph()`
+    std::vector<Actor*> m_compute_tasks;         //!< Actors to run `CalcForcesEulerCompute()` for; refilled every substep
+    std::vector<Actor*> m_collision_tasks;       //!< Actors to resolve inter-actor collisions for; refilled every substep
+    std::vector<InterActorCollisionBuffer> m_collision_buffers; //!< One per entry of `m_collision_tasks`; contacts are applied serially in task order
+    std::vector<Actor*> m_inter_group_actors;    //!< Actors with inter-actor beams, ordered by group; cached until links change
+    std::vector<int>    m_inter_group_offsets;   //!< Group `g` spans `m_inter_group_actors[offsets[g] .. offsets[g+1]]`
+    std::vector<bool>   m_inter_group_visited;   //!< Indexed by `Actor::ar_vector_index`
+    ActorBroadphase     m_broadphase;            //!< Candidate pairs for sleep/wake propagation and inter-actor collisions
+    PhysicsPhaseTimes   m_phase_times;
 
     // Utils
     std::unique_ptr<ThreadPool> m_sim_thread_pool;
     std::shared_ptr<Task>       m_sim_task;
+    bool                        m_sim_task_running = false; //!< Main thread only; set by `UpdateActors()`, cleared by `SyncWithSimThread()`
+    Actor*                      m_sim_player_actor = nullptr; //!< Latched by `UpdateActors()` before the sim task starts
+    std::vector<SimCommand>     m_sim_commands;     //!< Main thread only; capacity is reused across frames
     RoR::CmdKeyInertiaConfig    m_inertia_config;
 };
 
@@ -0,0 +1,102 @@
+/*
+    This source file is part of Rigs of Rods
+    Copyright 2026 Rigs of Rods contributors
+
+    For more information, see http://www.rigsofrods.org/
+
+    Rigs of Rods is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License version 3, as
+    published by the Free Software Foundation.
+
+    Rigs of Rods is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Rigs of Rods. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "CounterRng.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define ROR_RNG_SSE2
+    #include <emmintrin.h>
+#endif
+
+using namespace RoR;
+
+void CounterRng::SetKey(uint32_t seed, uint32_t stream)
+{
+    m_key = Mix(Mix(seed) ^ (stream * GOLDEN_RATIO));
+    this->SetStep(0);
+}
+
+void CounterRng::SetStep(uint32_t step)
+{
+    m_step = step;
+    m_step_key = Mix(m_key ^ Mix(step + GOLDEN_RATIO));
+}
+
+#ifdef ROR_RNG_SSE2
+
+namespace {
+
+// SSE2 has no 32-bit `mullo`; build it from two 32x32->64 multiplies
+inline __m128i MulLo32(__m128i a, uint32_t b)
+{
+    const __m128i vb = _mm_set1_epi32(static_cast<int>(b));
+    const __m128i even = _mm_mul_epu32(a, vb);
+    const __m128i odd = _mm_mul_epu32(_mm_srli_epi64(a, 32), vb);
+    return _mm_unpacklo_epi32(_mm_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 2, 0)), _mm_shuffle_epi32(odd, _MM_SHUFFLE(0, 0, 2, 0)));
+}
+
+inline __m128i Mix4(__m128i x)
+{
+    x = _mm_xor_si128(x, _mm_srli_epi32(x, 16));
+    x = MulLo32(x, 0x85ebca6bu);
+    x = _mm_xor_si128(x, _mm_srli_epi32(x, 13));
+    x = MulLo32(x, 0xc2b2ae35u);
+    x = _mm_xor_si128(x, _mm_srli_epi32(x, 16));
+    return x;
+}
+
+} // namespace
+
+void CounterRng::Fill11(float* out, uint32_t first, size_t count) const
+{
+    size_t i = 0;
+    if (count >= 4)
+    {
+        // Lanes hold `step_key + index * GOLDEN_RATIO` for 4 consecutive indices
+        __m128i input = _mm_add_epi32(
+            _mm_set1_epi32(static_cast<int>(m_step_key + first * GOLDEN_RATIO)),
+            _mm_set_epi32(static_cast<int>(3 * GOLDEN_RATIO), static_cast<int>(2 * GOLDEN_RATIO), static_cast<int>(GOLDEN_RATIO), 0));
+        const __m128i stride = _mm_set1_epi32(static_cast<int>(4 * GOLDEN_RATIO));
+        const __m128i exponent = _mm_set1_epi32(0x40000000);
+        const __m128 three = _mm_set1_ps(3.0f);
+        for (; i + 4 <= count; i += 4)
+        {
+            const __m128i bits = _mm_or_si128(_mm_srli_epi32(Mix4(input), 9), exponent);
+            _mm_storeu_ps(out + i, _mm_sub_ps(_mm_castsi128_ps(bits), three));
+            input = _mm_add_epi32(input, stride);
+        }
+    }
+
+    for (; i < count; i++)
+    {
+        out[i] = this->Get11(first + static_cast<uint32_t>(i));
+    }
+}
+
+#else // ROR_RNG_SSE2
+
+void CounterRng::Fill11(float* out, uint32_t first, size_t count) const
+{
+    for (size_t i = 0; i < count; i++)
+    {
+        out[i] = this->Get11(first + static_cast<uint32_t>(i));
+    }
+}
+
+#endif // ROR_RNG_SSE2
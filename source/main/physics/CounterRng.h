@@ -0,0 +1,78 @@
+/*
+    This source file is part of Rigs of Rods
+    Copyright 2026 Rigs of Rods contributors
+
+    For more information, see http://www.rigsofrods.org/
+
+    Rigs of Rods is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License version 3, as
+    published by the Free Software Foundation.
+
+    Rigs of Rods is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Rigs of Rods. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/// @file
+/// @brief Stateless random numbers for physics (see cvar 'sim_rng_seed').
+
+#pragma once
+
+// NOTE: Only depends on the standard library, so that microbenchmarks can use it directly.
+
+#include <cstddef>
+#include <cstdint>
+
+namespace RoR {
+
+/// Physics: Counter-based random number generator.
+///
+/// The n-th number of a step is a pure function of (key, step, n) - a hash, not a sequence.
+/// Threads can therefore draw numbers for any index in any order without shared state,
+/// and a simulation replays bit-exactly for the same seed, regardless of how work was split.
+/// The mixer is the 32-bit MurmurHash3 finalizer; plenty for turbulence, not for cryptography.
+class CounterRng
+{
+public:
+    void            SetKey(uint32_t seed, uint32_t stream); //!< Also rewinds to step 0
+    void            SetStep(uint32_t step);
+    uint32_t        GetStep() const           { return m_step; }
+    void            NextStep()                { this->SetStep(m_step + 1); }
+
+    uint32_t        GetUint(uint32_t index) const { return Mix(m_step_key + index * GOLDEN_RATIO); }
+    float           Get11(uint32_t index) const   { return ToFloat11(this->GetUint(index)); } //!< Range [-1, 1)
+
+    /// Writes `Get11(first) ... Get11(first + count - 1)` to `out`; 4 at a time with SSE2, same results.
+    void            Fill11(float* out, uint32_t first, size_t count) const;
+
+    static uint32_t Mix(uint32_t x)
+    {
+        x ^= x >> 16;
+        x *= 0x85ebca6bu;
+        x ^= x >> 13;
+        x *= 0xc2b2ae35u;
+        x ^= x >> 16;
+        return x;
+    }
+
+    static float    ToFloat11(uint32_t bits)
+    {
+        // Mantissa from the top bits, exponent of [2, 4) - like `frand_11()`
+        union { uint32_t u; float f; } conv;
+        conv.u = (bits >> 9) | 0x40000000u;
+        return conv.f - 3.0f;
+    }
+
+private:
+    static const uint32_t GOLDEN_RATIO = 0x9e3779b9u;
+
+    uint32_t        m_key = 0;
+    uint32_t        m_step = 0;
+    uint32_t        m_step_key = 0;
+};
+
+} // namespace RoR
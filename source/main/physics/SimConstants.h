@@ -72,5 +72,13 @@ static const float HOOK_SPEED_DEFAULT           = 0.00025f;
 static const float HOOK_LOCK_TIMER_DEFAULT      = 5.0;
 static const int   NODE_LOCKGROUP_DEFAULT       = -1; // all hooks scan all nodes
 static const int   DEFAULT_DETACHER_GROUP       = 0; // default for detaching beam group
+static const int   PHYSICS_SPLIT_MIN_NODES      = 2000; //!< Actors this big spread CalcNodes()/CalcBeams() across the thread pool
+static const int   PHYSICS_SPLIT_NODE_GRAIN     = 512;  //!< Nodes per task when an actor is split
+static const int   PHYSICS_SPLIT_MIN_BUOYCABS   = 256;  //!< Split actors (see `PHYSICS_SPLIT_MIN_NODES`) with this many buoycabs spread CalcBuoyance() across the thread pool
+static const int   PHYSICS_SPLIT_BUOYCAB_GRAIN  = 64;   //!< Buoycabs per task when buoyancy is split
+static const float ISLAND_SLEEP_REST_TIME       = 10.f; //!< Seconds at rest before an island of linked actors falls asleep
+static const float ISLAND_DOZE_REST_TIME        = 1.f;  //!< Seconds at rest before an island only runs every `ISLAND_DOZE_SUBSTEP_STRIDE`-th substep (cvar 'sim_island_dozing')
+static const int   ISLAND_DOZE_SUBSTEP_STRIDE   = 4;    //!< A dozing island integrates this many substeps in one step of `ISLAND_DOZE_SUBSTEP_STRIDE * PHYSICS_DT`
+static const float ISLAND_DOZE_STABILITY_MARGIN = 0.5f; //!< Fraction of the explicit Euler stability limit a dozing step may use, see `Actor::UpdateDozeStability()`
 
 static const float FLAP_ANGLES[6] = {0.f, -0.07f, -0.17f, -0.33f, -0.67f, -1.f};
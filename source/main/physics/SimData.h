@@ -235,6 +235,7 @@ struct node_t
     Ogre::Vector3   Forces;
 
     Ogre::Real      mass;
+    Ogre::Real      inv_mass;                //!< 1 / mass; refreshed by `Actor::UpdateNodeInverseMasses()`
     Ogre::Real      buoyancy;
     Ogre::Real      friction_coef;
     Ogre::Real      surface_coef;
@@ -0,0 +1,105 @@
+/*
+    This source file is part of Rigs of Rods
+    Copyright 2026 Rigs of Rods contributors
+
+    For more information, see http://www.rigsofrods.org/
+
+    Rigs of Rods is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License version 3, as
+    published by the Free Software Foundation.
+
+    Rigs of Rods is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Rigs of Rods. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "ActorBroadphase.h"
+
+#include "Actor.h"
+
+#include <algorithm>
+
+using namespace Ogre;
+using namespace RoR;
+
+void ActorBroadphase::Clear()
+{
+    m_entries.clear();
+    m_candidates.clear(); // May point to a deleted actor
+}
+
+void ActorBroadphase::Update(const std::vector<Actor*>& actors)
+{
+    if (m_entries.size() != actors.size())
+    {
+        m_entries.clear();
+        for (Actor* actor: actors)
+        {
+            m_entries.push_back({actor, 0.f, 0.f});
+        }
+    }
+
+    for (Entry& entry: m_entries)
+    {
+        const AxisAlignedBox& box = entry.actor->ar_predicted_bounding_box;
+        entry.min_x = box.getMinimum().x;
+        entry.max_x = box.getMaximum().x;
+    }
+
+    // Insertion sort; the order from the previous update is nearly right
+    for (size_t i = 1; i < m_entries.size(); i++)
+    {
+        const Entry entry = m_entries[i];
+        size_t j = i;
+        while (j > 0 && m_entries[j - 1].min_x > entry.min_x)
+        {
+            m_entries[j] = m_entries[j - 1];
+            j--;
+        }
+        m_entries[j] = entry;
+    }
+
+    m_candidates.resize(actors.size());
+    for (std::vector<Actor*>& candidates: m_candidates)
+    {
+        candidates.clear();
+    }
+
+    // Sweep along X, test the other axes only for actors whose X extents overlap
+    for (size_t i = 0; i < m_entries.size(); i++)
+    {
+        Actor* a = m_entries[i].actor;
+        const AxisAlignedBox& box_a = a->ar_predicted_bounding_box;
+        for (size_t j = i + 1; j < m_entries.size() && m_entries[j].min_x <= m_entries[i].max_x; j++)
+        {
+            Actor* b = m_entries[j].actor;
+            if (box_a.intersects(b->ar_predicted_bounding_box))
+            {
+                m_candidates[a->ar_vector_index].push_back(b);
+                m_candidates[b->ar_vector_index].push_back(a);
+            }
+        }
+    }
+
+    // Callers used to loop over all actors; keep their order
+    for (std::vector<Actor*>& candidates: m_candidates)
+    {
+        std::sort(candidates.begin(), candidates.end(), [](const Actor* a, const Actor* b)
+            {
+                return a->ar_vector_index < b->ar_vector_index;
+            });
+    }
+}
+
+const std::vector<Actor*>& ActorBroadphase::GetCandidates(const Actor* actor) const
+{
+    static const std::vector<Actor*> none;
+    if (actor->ar_vector_index >= m_candidates.size())
+        return none; // Cleared, not updated yet
+
+    return m_candidates[actor->ar_vector_index];
+}
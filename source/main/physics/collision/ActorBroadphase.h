@@ -0,0 +1,61 @@
+/*
+    This source file is part of Rigs of Rods
+    Copyright 2026 Rigs of Rods contributors
+
+    For more information, see http://www.rigsofrods.org/
+
+    Rigs of Rods is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License version 3, as
+    published by the Free Software Foundation.
+
+    Rigs of Rods is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Rigs of Rods. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/// @file
+/// @brief Sweep-and-prune broadphase over actor bounding boxes.
+
+#pragma once
+
+#include "ForwardDeclarations.h"
+
+#include <vector>
+
+namespace RoR {
+
+/// Finds pairs of actors whose bounding boxes overlap, without testing every pair.
+///
+/// Actors are kept sorted by the X extent of `Actor::ar_predicted_bounding_box`, which encloses
+/// `ar_bounding_box` and all (predicted) `ar_collision_bounding_boxes`, so any pair which passes one of
+/// the finer tests in ActorManager or PointColDetector is among the reported candidates.
+/// The order persists between updates; actors barely move in one step, so re-sorting it
+/// with insertion sort is close to linear.
+///
+/// Owned by ActorManager, updated on the simulation thread; queries are read-only and may run in parallel.
+class ActorBroadphase
+{
+public:
+    void            Update(const std::vector<Actor*>& actors); //!< Re-sorts and re-sweeps; call when boxes have moved.
+    void            Clear();                                   //!< Call when actors were added or removed; drops all candidates until the next `Update()`.
+
+    /// Actors whose predicted box overlaps the given actor's, ordered by `Actor::ar_vector_index`; empty between `Clear()` and `Update()`.
+    const std::vector<Actor*>& GetCandidates(const Actor* actor) const;
+
+private:
+    struct Entry
+    {
+        Actor*      actor;
+        float       min_x;
+        float       max_x;
+    };
+
+    std::vector<Entry>                m_entries;    //!< Sorted by `min_x`
+    std::vector<std::vector<Actor*>>  m_candidates; //!< Indexed by `Actor::ar_vector_index`
+};
+
+} // namespace RoR
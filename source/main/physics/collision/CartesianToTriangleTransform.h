@@ -118,6 +118,16 @@ public:
         return {result[0], result[1], (1.f - result[0] - result[1]), result[2]};
     }
 
+    /// Return the transformation matrix, for applying it to many points at once; see operator().
+    const Ogre::Matrix3& matrix() const
+    {
+        if (!m_initialized) {
+            InitMatrix();
+            m_initialized = true;
+        }
+        return m_matrix;
+    }
+
 private:
     /// Initialize the transformation matrix
     void InitMatrix() const {
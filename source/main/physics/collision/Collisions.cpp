@@ -122,14 +122,11 @@ Collisions::Collisions(Ogre::Vector3 terrn_size):
     , free_eventsource(0)
     , hashmask(0)
     , landuse(0)
+    , m_grid_generation(1)
+    , m_grid_in_use(false)
     , m_terrain_size(terrn_size)
 {
     debugMode = App::diag_collisions->GetBool(); // TODO: make interactive - do not copy the value, use GVar directly
-    for (int i=0; i < HASH_POWER; i++)
-    {
-        hashmask = hashmask << 1;
-        hashmask++;
-    }
 
     loadDefaultModels();
     defaultgm = getGroundModelByString("concrete");
@@ -371,7 +368,7 @@ ground_model_t *Collisions::getGroundModelByString(const String name)
     return &ground_models[name];
 }
 
-unsigned int Collisions::hashfunc(unsigned int cellid)
+unsigned int Collisions::hashfunc(unsigned int cellid) const
 {
     unsigned int hash = 0;
     for (int i=0; i < 4; i++)
@@ -385,18 +382,125 @@ unsigned int Collisions::hashfunc(unsigned int cellid)
 void Collisions::hash_add(int cell_x, int cell_z, int value, float h)
 {
     unsigned int cell_id = (cell_x << 16) + cell_z;
-    unsigned int pos    = hashfunc(cell_id);
 
-    hashtable[pos].emplace_back(cell_id, value);
-    hashtable_height[pos] = std::max(hashtable_height[pos], h);
+    m_grid_staging.push_back({cell_id, value, h});
 }
 
-int Collisions::hash_find(int cell_x, int cell_z)
+const Collisions::grid_cell_t& Collisions::hash_find(int cell_x, int cell_z, NodeCellCache* cache) const
 {
+    static const grid_cell_t EMPTY_CELL = {0, 0, 0, -std::numeric_limits<float>::max()};
+
     unsigned int cellid = (cell_x << 16) + cell_z;
-    unsigned int pos    = hashfunc(cellid);
+    if (cache && cache->cell_id == cellid && cache->generation == m_grid_generation)
+        return (cache->slot == -1) ? EMPTY_CELL : m_grid_cells[cache->slot];
+
+    int slot = -1;
+    if (!m_grid_cells.empty())
+    {
+        for (unsigned int pos = hashfunc(cellid); m_grid_cells[pos].count != 0; pos = (pos + 1) & hashmask)
+        {
+            if (m_grid_cells[pos].cell_id == cellid)
+            {
+                slot = static_cast<int>(pos);
+                break;
+            }
+        }
+    }
+
+    if (cache)
+    {
+        cache->cell_id = cellid;
+        cache->slot = slot;
+        cache->generation = m_grid_generation;
+    }
+    return (slot == -1) ? EMPTY_CELL : m_grid_cells[slot];
+}
+
+void Collisions::UpdateGrid()
+{
+    if (!m_grid_staging.empty())
+    {
+        this->packStagedElements();
+    }
+}
+
+void Collisions::packStagedElementsIfIdle()
+{
+    // Check the flag first: while physics runs, the main thread may be adding to the staging area
+    if (!m_grid_in_use && !m_grid_staging.empty())
+    {
+        this->packStagedElements();
+    }
+}
+
+void Collisions::packStagedElements()
+{
+    // Group the new elements by cell; within a cell, elements stay in the order they were added
+    std::stable_sort(m_grid_staging.begin(), m_grid_staging.end(), [](const grid_staged_element_t& a, const grid_staged_element_t& b)
+        {
+            return a.cell_id < b.cell_id;
+        });
+
+    // Runs in `m_grid_elements` are laid out in cell ID order, so the packed cells can be merged with the new ones in one pass
+    std::vector<grid_cell_t> old_cells;
+    old_cells.reserve(m_grid_cells.size() / 2);
+    for (const grid_cell_t& cell: m_grid_cells)
+    {
+        if (cell.count != 0)
+            old_cells.push_back(cell);
+    }
+    std::sort(old_cells.begin(), old_cells.end(), [](const grid_cell_t& a, const grid_cell_t& b) { return a.begin < b.begin; });
+
+    std::vector<grid_cell_t> cells;
+    cells.reserve(old_cells.size() + m_grid_staging.size());
+    std::vector<int> elements;
+    elements.reserve(m_grid_elements.size() + m_grid_staging.size());
+    size_t o = 0; // Into `old_cells`
+    size_t n = 0; // Into `m_grid_staging`
+    while (o < old_cells.size() || n < m_grid_staging.size())
+    {
+        const unsigned int cell_id = (n == m_grid_staging.size() || (o < old_cells.size() && old_cells[o].cell_id <= m_grid_staging[n].cell_id))
+            ? old_cells[o].cell_id : m_grid_staging[n].cell_id;
+
+        grid_cell_t cell{cell_id, static_cast<int>(elements.size()), 0, -std::numeric_limits<float>::max()};
+        if (o < old_cells.size() && old_cells[o].cell_id == cell_id)
+        {
+            elements.insert(elements.end(), m_grid_elements.begin() + old_cells[o].begin,
+                m_grid_elements.begin() + old_cells[o].begin + old_cells[o].count);
+            cell.height = old_cells[o].height;
+            o++;
+        }
+        for (; n < m_grid_staging.size() && m_grid_staging[n].cell_id == cell_id; n++)
+        {
+            elements.push_back(m_grid_staging[n].element_index);
+            cell.height = std::max(cell.height, m_grid_staging[n].height);
+        }
+        cell.count = static_cast<int>(elements.size()) - cell.begin;
+        cells.push_back(cell);
+    }
+
+    // At most half full, so that probe sequences stay short
+    size_t table_size = 16;
+    while (table_size < cells.size() * 2)
+    {
+        table_size <<= 1;
+    }
+    hashmask = static_cast<unsigned int>(table_size - 1);
+    m_grid_cells.assign(table_size, grid_cell_t{0, 0, 0, 0.f});
+    for (const grid_cell_t& cell: cells)
+    {
+        unsigned int pos = hashfunc(cell.cell_id);
+        while (m_grid_cells[pos].count != 0)
+        {
+            pos = (pos + 1) & hashmask;
+        }
+        m_grid_cells[pos] = cell;
+    }
+    m_grid_elements.swap(elements);
+    m_grid_generation++;
 
-    return static_cast<int>(pos);
+    // Packed now; release the bulk of the terrain load instead of keeping it for later additions
+    std::vector<grid_staged_element_t>().swap(m_grid_staging);
 }
 
 int Collisions::addCollisionBox(SceneNode *tenode, bool rotating, bool virt, Vector3 pos, Ogre::Vector3 rot, Ogre::Vector3 l, Ogre::Vector3 h, Ogre::Vector3 sr, const Ogre::String &eventname, const Ogre::String &instancename, bool forcecam, Ogre::Vector3 campos, Ogre::Vector3 sc /* = Vector3::UNIT_SCALE */, Ogre::Vector3 dr /* = Vector3::ZERO */, CollisionEventFilter event_filter /* = EVENT_ALL */, int scripthandler /* = -1 */)
@@ -659,10 +763,11 @@ int Collisions::addCollisionTri(Vector3 p1, Vector3 p2, Vector3 p3, ground_model
 {
     int new_tri_index = this->GetNumCollisionTris();
     collision_tri_t new_tri;
-    new_tri.a=p1;
-    new_tri.b=p2;
-    new_tri.c=p3;
-    new_tri.gm=gm;
+    collision_tri_ext_t new_tri_ext;
+    new_tri_ext.a=p1;
+    new_tri_ext.b=p2;
+    new_tri_ext.c=p3;
+    new_tri_ext.gm=gm;
     new_tri.enabled=true;
     // compute transformations
     // base construction
@@ -671,21 +776,25 @@ int Collisions::addCollisionTri(Vector3 p1, Vector3 p2, Vector3 p3, ground_model
     Vector3 bz=bx.crossProduct(by);
     bz.normalise();
     // coordinates change matrix
-    new_tri.reverse.SetColumn(0, bx);
-    new_tri.reverse.SetColumn(1, by);
-    new_tri.reverse.SetColumn(2, bz);
-    new_tri.forward=new_tri.reverse.Inverse();
+    new_tri_ext.reverse.SetColumn(0, bx);
+    new_tri_ext.reverse.SetColumn(1, by);
+    new_tri_ext.reverse.SetColumn(2, bz);
+    new_tri_ext.forward=new_tri_ext.reverse.Inverse();
+    // plane; `bz` is perpendicular to the tri, so it's also the 3rd row of `forward`
+    new_tri.normal=bz;
+    new_tri.plane_d=bz.dotProduct(p1);
 
     // compute tri AAB
-    new_tri.aab.merge(p1);
-    new_tri.aab.merge(p2);
-    new_tri.aab.merge(p3);
-    new_tri.aab.setMinimum(new_tri.aab.getMinimum() - 0.1f);
-    new_tri.aab.setMaximum(new_tri.aab.getMaximum() + 0.1f);
+    AxisAlignedBox aab;
+    aab.merge(p1);
+    aab.merge(p2);
+    aab.merge(p3);
+    new_tri.lo = aab.getMinimum() - 0.1f;
+    new_tri.hi = aab.getMaximum() + 0.1f;
     
     // register this collision tri in the index
-    Ogre::Vector3 ilo(new_tri.aab.getMinimum() / Ogre::Real(CELL_SIZE));
-    Ogre::Vector3 ihi(new_tri.aab.getMaximum() / Ogre::Real(CELL_SIZE));
+    Ogre::Vector3 ilo(new_tri.lo / Ogre::Real(CELL_SIZE));
+    Ogre::Vector3 ihi(new_tri.hi / Ogre::Real(CELL_SIZE));
     
     // clamp between 0 and MAXIMUM_CELL;
     ilo.makeCeil(Ogre::Vector3(0.0f));
@@ -697,7 +806,7 @@ int Collisions::addCollisionTri(Vector3 p1, Vector3 p2, Vector3 p3, ground_model
     {
         for (int j = ilo.z; j<=ihi.z; j++)
         {
-            hash_add(i, j, new_tri_index + hash_coll_element_t::ELEMENT_TRI_BASE_INDEX, new_tri.aab.getMaximum().y);
+            hash_add(i, j, new_tri_index + ELEMENT_TRI_BASE_INDEX, new_tri.hi.y);
         }
     }
     
@@ -708,8 +817,9 @@ int Collisions::addCollisionTri(Vector3 p1, Vector3 p2, Vector3 p3, ground_model
         debugmo->position(p3);
     }
 
-    m_collision_aab.merge(new_tri.aab);
+    m_collision_aab.merge(AxisAlignedBox(new_tri.lo, new_tri.hi));
     m_collision_tris.push_back(new_tri);
+    m_collision_tris_ext.push_back(new_tri_ext);
     return new_tri_index;
 }
 
@@ -739,7 +849,7 @@ std::pair<bool, Ogre::Real> Collisions::intersectsTris(Ogre::Ray ray)
 {
     int steps = ray.getDirection().length() / (float)CELL_SIZE;
 
-    int lhash = -1;
+    const grid_cell_t* lcell = nullptr;
 
     for (int i = 0; i <= steps; i++)
     {
@@ -748,25 +858,25 @@ std::pair<bool, Ogre::Real> Collisions::intersectsTris(Ogre::Ray ray)
         // find the correct cell
         int refx = (int)(pos.x / (float)CELL_SIZE);
         int refz = (int)(pos.z / (float)CELL_SIZE);
-        int hash = hash_find(refx, refz);
+        const grid_cell_t& cell = hash_find(refx, refz);
 
-        if (hash == lhash)
+        if (&cell == lcell)
             continue;
 
-        lhash = hash;
+        lcell = &cell;
 
-        size_t num_elements = hashtable[hash].size();
-        for (size_t k = 0; k < num_elements; k++)
+        for (int k = cell.begin; k < cell.begin + cell.count; k++)
         {
-            if (hashtable[hash][k].IsCollisionTri())
+            if (IsCollisionTri(m_grid_elements[k]))
             {
-                const int ctri_index = hashtable[hash][k].element_index - hash_coll_element_t::ELEMENT_TRI_BASE_INDEX;
+                const int ctri_index = m_grid_elements[k] - ELEMENT_TRI_BASE_INDEX;
                 collision_tri_t *ctri = &m_collision_tris[ctri_index];
+                collision_tri_ext_t *ctri_ext = &m_collision_tris_ext[ctri_index];
 
                 if (!ctri->enabled)
                     continue;
 
-                auto result = Ogre::Math::intersects(ray, ctri->a, ctri->b, ctri->c);
+                auto result = Ogre::Math::intersects(ray, ctri_ext->a, ctri_ext->b, ctri_ext->c);
                 if (result.first && result.second < 1.0f)
                 {
                     return result;
@@ -785,22 +895,23 @@ float Collisions::getSurfaceHeight(float x, float z)
 
 float Collisions::getSurfaceHeightBelow(float x, float z, float height)
 {
+    this->packStagedElementsIfIdle(); // e.g. spawn placement right after a script added objects
+
     float surface_height = App::GetSimTerrain()->GetHeightAt(x, z);
 
     // find the correct cell
     int refx = (int)(x / (float)CELL_SIZE);
     int refz = (int)(z / (float)CELL_SIZE);
-    int hash = hash_find(refx, refz);
+    const grid_cell_t& cell = hash_find(refx, refz);
 
-    Vector3 origin = Vector3(x, hashtable_height[hash], z);
+    Vector3 origin = Vector3(x, cell.height, z);
     Ray ray(origin, -Vector3::UNIT_Y);
 
-    size_t num_elements = hashtable[hash].size();
-    for (size_t k = 0; k < num_elements; k++)
+    for (int k = cell.begin; k < cell.begin + cell.count; k++)
     {
-        if (hashtable[hash][k].IsCollisionBox())
+        if (IsCollisionBox(m_grid_elements[k]))
         {
-            collision_box_t* cbox = &m_collision_boxes[hashtable[hash][k].element_index];
+            collision_box_t* cbox = &m_collision_boxes[m_grid_elements[k]];
 
             if (!cbox->enabled)
                 continue;
@@ -846,20 +957,21 @@ float Collisions::getSurfaceHeightBelow(float x, float z, float height)
         }
         else // The element is a triangle
         {
-            const int ctri_index = hashtable[hash][k].element_index - hash_coll_element_t::ELEMENT_TRI_BASE_INDEX;
+            const int ctri_index = m_grid_elements[k] - ELEMENT_TRI_BASE_INDEX;
             collision_tri_t *ctri = &m_collision_tris[ctri_index];
 
             if (!ctri->enabled)
                 continue;
 
-            auto lo = ctri->aab.getMinimum();
-            auto hi = ctri->aab.getMaximum();
+            const Vector3& lo = ctri->lo;
+            const Vector3& hi = ctri->hi;
             if (surface_height >= hi.y)
                 continue;
             if (x < lo.x || z < lo.z || x > hi.x || z > hi.z)
                 continue;
 
-            auto result = Ogre::Math::intersects(ray, ctri->a, ctri->b, ctri->c);
+            const collision_tri_ext_t *ctri_ext = &m_collision_tris_ext[ctri_index];
+            auto result = Ogre::Math::intersects(ray, ctri_ext->a, ctri_ext->b, ctri_ext->c);
             if (result.first)
             {
                 if (origin.y - result.second < height)
@@ -875,27 +987,28 @@ float Collisions::getSurfaceHeightBelow(float x, float z, float height)
 
 bool Collisions::collisionCorrect(Vector3 *refpos, bool envokeScriptCallbacks)
 {
+    this->packStagedElementsIfIdle();
+
     // find the correct cell
     int refx = (int)(refpos->x / (float)CELL_SIZE);
     int refz = (int)(refpos->z / (float)CELL_SIZE);
-    int hash = hash_find(refx, refz);
+    const grid_cell_t& cell = hash_find(refx, refz);
 
-    if (refpos->y > hashtable_height[hash])
+    if (refpos->y > cell.height)
         return false;
 
-    collision_tri_t *minctri = 0;
+    collision_tri_ext_t *minctri = 0;
     float minctridist = 100.0f;
     Vector3 minctripoint;
 
     bool contacted = false;
     bool isScriptCallbackEnvoked = false;
 
-    size_t num_elements = hashtable[hash].size();
-    for (size_t k = 0; k < num_elements; k++)
+    for (int k = cell.begin; k < cell.begin + cell.count; k++)
     {
-        if (hashtable[hash][k].IsCollisionBox())
+        if (IsCollisionBox(m_grid_elements[k]))
         {
-            collision_box_t* cbox = &m_collision_boxes[hashtable[hash][k].element_index];
+            collision_box_t* cbox = &m_collision_boxes[m_grid_elements[k]];
 
             if (!cbox->enabled)
                 continue;
@@ -975,21 +1088,28 @@ bool Collisions::collisionCorrect(Vector3 *refpos, bool envokeScriptCallbacks)
         }
         else // The element is a triangle
         {
-            const int ctri_index = hashtable[hash][k].element_index - hash_coll_element_t::ELEMENT_TRI_BASE_INDEX;
+            const int ctri_index = m_grid_elements[k] - ELEMENT_TRI_BASE_INDEX;
             collision_tri_t *ctri = &m_collision_tris[ctri_index];
             if (!ctri->enabled)
                 continue;
-            if (!ctri->aab.contains(*refpos))
+            if (refpos->y > ctri->hi.y || refpos->y < ctri->lo.y ||
+                refpos->x > ctri->hi.x || refpos->x < ctri->lo.x ||
+                refpos->z > ctri->hi.z || refpos->z < ctri->lo.z)
+                continue;
+            // cheap plane test first; slightly lenient, the exact test follows
+            const float plane_dist = ctri->normal.dotProduct(*refpos) - ctri->plane_d;
+            if (plane_dist > 0.001f || plane_dist < -0.101f)
                 continue;
             // check if this tri is minimal
             // transform
-            Vector3 point = ctri->forward * (*refpos-ctri->a);
+            collision_tri_ext_t *ctri_ext = &m_collision_tris_ext[ctri_index];
+            Vector3 point = ctri_ext->forward * (*refpos-ctri_ext->a);
             // test if within tri collision volume (potential cause of bug!)
             if (point.x >= 0 && point.y >= 0 && (point.x + point.y) <= 1.0 && point.z < 0 && point.z > -0.1)
             {
                 if (-point.z < minctridist)
                 {
-                    minctri = ctri;
+                    minctri = ctri_ext;
                     minctridist = -point.z;
                     minctripoint = point;
                 }
@@ -1036,34 +1156,28 @@ bool Collisions::permitEvent(CollisionEventFilter filter)
     }
 }
 
-bool Collisions::nodeCollision(node_t *node, float dt, bool envokeScriptCallbacks)
+bool Collisions::nodeCollision(node_t *node, float dt, bool envokeScriptCallbacks, NodeCellCache* cell_cache)
 {
     // find the correct cell
     int refx = (int)(node->AbsPosition.x / CELL_SIZE);
     int refz = (int)(node->AbsPosition.z / CELL_SIZE);
-    int hash = hash_find(refx, refz);
-    unsigned int cell_id = (refx << 16) + refz;
+    const grid_cell_t& cell = hash_find(refx, refz, cell_cache);
 
-    if (node->AbsPosition.y > hashtable_height[hash])
+    if (node->AbsPosition.y > cell.height)
         return false;
 
-    collision_tri_t *minctri = 0;
+    collision_tri_ext_t *minctri = 0;
     float minctridist = 100.0;
     Vector3 minctripoint;
 
     bool contacted = false;
     bool isScriptCallbackEnvoked = false;
 
-    size_t num_elements = hashtable[hash].size();
-    for (size_t k=0; k < num_elements; k++)
+    for (int k = cell.begin; k < cell.begin + cell.count; k++)
     {
-        if (hashtable[hash][k].cell_id != cell_id)
+        if (IsCollisionBox(m_grid_elements[k]))
         {
-            continue;
-        }
-        else if (hashtable[hash][k].IsCollisionBox())
-        {
-            collision_box_t *cbox = &m_collision_boxes[hashtable[hash][k].element_index];
+            collision_box_t *cbox = &m_collision_boxes[m_grid_elements[k]];
 
             if (!cbox->enabled)
                 continue;
@@ -1169,23 +1283,28 @@ bool Collisions::nodeCollision(node_t *node, float dt, bool envokeScriptCallback
         else
         {
             // tri collision
-            const int ctri_index = hashtable[hash][k].element_index - hash_coll_element_t::ELEMENT_TRI_BASE_INDEX;
+            const int ctri_index = m_grid_elements[k] - ELEMENT_TRI_BASE_INDEX;
             collision_tri_t *ctri = &m_collision_tris[ctri_index];
             if (!ctri->enabled)
                 continue;
-            if (node->AbsPosition.y > ctri->aab.getMaximum().y || node->AbsPosition.y < ctri->aab.getMinimum().y ||
-                node->AbsPosition.x > ctri->aab.getMaximum().x || node->AbsPosition.x < ctri->aab.getMinimum().x ||
-                node->AbsPosition.z > ctri->aab.getMaximum().z || node->AbsPosition.z < ctri->aab.getMinimum().z)
+            if (node->AbsPosition.y > ctri->hi.y || node->AbsPosition.y < ctri->lo.y ||
+                node->AbsPosition.x > ctri->hi.x || node->AbsPosition.x < ctri->lo.x ||
+                node->AbsPosition.z > ctri->hi.z || node->AbsPosition.z < ctri->lo.z)
+                continue;
+            // cheap plane test first; slightly lenient, the exact test follows
+            const float plane_dist = ctri->normal.dotProduct(node->AbsPosition) - ctri->plane_d;
+            if (plane_dist > 0.001f || plane_dist < -0.101f)
                 continue;
             // check if this tri is minimal
             // transform
-            Vector3 point = ctri->forward * (node->AbsPosition - ctri->a);
+            collision_tri_ext_t *ctri_ext = &m_collision_tris_ext[ctri_index];
+            Vector3 point = ctri_ext->forward * (node->AbsPosition - ctri_ext->a);
             // test if within tri collision volume (potential cause of bug!)
             if (point.x >= 0 && point.y >= 0 && (point.x + point.y) <= 1.0 && point.z < 0 && point.z > -0.1)
             {
                 if (-point.z < minctridist)
                 {
-                    minctri = ctri;
+                    minctri = ctri_ext;
                     minctridist = -point.z;
                     minctripoint = point;
                 }
@@ -1307,6 +1426,65 @@ bool Collisions::groundCollision(node_t *node, float dt)
     return false;
 }
 
+void Collisions::groundCollisionBatch(node_t* nodes, int begin, int end, float dt, GroundQueryBatch& batch)
+{
+    const size_t num_nodes = static_cast<size_t>(end - begin);
+    batch.ground_contact.assign(num_nodes, 0);
+    if (batch.cells.size() != num_nodes)
+    {
+        batch.cells.assign(num_nodes, NodeCellCache());
+    }
+
+    batch.nodes.clear();
+    batch.pos_x.clear();
+    batch.pos_y.clear();
+    batch.pos_z.clear();
+    for (int i = begin; i < end; i++)
+    {
+        if (nodes[i].nd_no_ground_contact)
+            continue;
+        batch.nodes.push_back(i);
+        batch.pos_x.push_back(nodes[i].AbsPosition.x);
+        batch.pos_y.push_back(nodes[i].AbsPosition.y);
+        batch.pos_z.push_back(nodes[i].AbsPosition.z);
+    }
+
+    const int num_queries = static_cast<int>(batch.nodes.size());
+    batch.height.resize(num_queries);
+    App::GetSimTerrain()->GetHeightsAt(batch.pos_x.data(), batch.pos_z.data(), batch.height.data(), num_queries);
+
+    batch.contacts.clear();
+    batch.contact_x.clear();
+    batch.contact_y.clear();
+    batch.contact_z.clear();
+    for (int k = 0; k < num_queries; k++)
+    {
+        if (batch.height[k] > batch.pos_y[k])
+        {
+            batch.contacts.push_back(k);
+            batch.contact_x.push_back(batch.pos_x[k]);
+            batch.contact_y.push_back(batch.height[k]);
+            batch.contact_z.push_back(batch.pos_z[k]);
+        }
+    }
+
+    const int num_contacts = static_cast<int>(batch.contacts.size());
+    batch.normals.resize(num_contacts);
+    App::GetSimTerrain()->GetNormalsAt(batch.contact_x.data(), batch.contact_y.data(), batch.contact_z.data(), batch.normals.data(), num_contacts);
+
+    for (int c = 0; c < num_contacts; c++)
+    {
+        const int k = batch.contacts[c];
+        node_t* node = &nodes[batch.nodes[k]];
+        ground_model_t* ogm = landuse ? landuse->getGroundModelAt(node->AbsPosition.x, node->AbsPosition.z) : nullptr;
+        // when landuse fails or we don't have it, use the default value
+        if (!ogm) ogm = defaultgroundgm;
+        node->Forces += primitiveCollision(node, node->Velocity, node->mass, batch.normals[c], dt, ogm, batch.height[k] - node->AbsPosition.y);
+        node->nd_last_collision_gm = ogm;
+        batch.ground_contact[batch.nodes[k] - begin] = 1;
+    }
+}
+
 Vector3 RoR::primitiveCollision(node_t *node, Vector3 velocity, float mass, Vector3 normal, float dt, ground_model_t* gm, float penetration)
 {
     Vector3 force = Vector3::ZERO;
@@ -1439,11 +1617,9 @@ int Collisions::createCollisionDebugVisualization()
         {
             int cellx = (int)(x/(float)CELL_SIZE);
             int cellz = (int)(z/(float)CELL_SIZE);
-            const int hash = hash_find(cellx, cellz);
+            const grid_cell_t& cell = hash_find(cellx, cellz);
 
-            bool used = std::find_if(hashtable[hash].begin(), hashtable[hash].end(), [&](hash_coll_element_t const &c) {
-                    return c.cell_id == (cellx << 16) + cellz;
-            }) != hashtable[hash].end();
+            bool used = cell.count > 0;
 
             if (used)
             {
@@ -1458,7 +1634,7 @@ int Collisions::createCollisionDebugVisualization()
                 groundheight = std::max(groundheight, App::GetSimTerrain()->GetHeightAt(x2, z2));
                 groundheight += 0.1; // 10 cm hover
 
-                float percentd = static_cast<float>(hashtable[hash].size()) / static_cast<float>(CELL_BLOCKSIZE);
+                float percentd = static_cast<float>(cell.count) / static_cast<float>(CELL_BLOCKSIZE);
 
                 if (percentd > 1) percentd = 1;
                 String matName = "mat-coll-dbg-"+TOSTRING((int)(percentd*100));
@@ -1689,6 +1865,15 @@ void Collisions::getMeshInformation(Mesh* mesh,size_t &vertex_count,Vector3* &ve
 
 void Collisions::finishLoadingTerrain()
 {
+    this->UpdateGrid();
+
+    const size_t grid_bytes = m_grid_cells.capacity() * sizeof(grid_cell_t) + m_grid_elements.capacity() * sizeof(int);
+    const size_t tri_bytes = m_collision_tris.capacity() * sizeof(collision_tri_t);
+    const size_t tri_ext_bytes = m_collision_tris_ext.capacity() * sizeof(collision_tri_ext_t);
+    LOG(fmt::format("COLL: static grid: {} elements in {} cells ({:.1f} MB); {} tris: {:.1f} MB hot, {:.1f} MB cold",
+        m_grid_elements.size(), std::count_if(m_grid_cells.begin(), m_grid_cells.end(), [](const grid_cell_t& c) { return c.count > 0; }),
+        grid_bytes / (1024.f * 1024.f), m_collision_tris.size(), tri_bytes / (1024.f * 1024.f), tri_ext_bytes / (1024.f * 1024.f)));
+
     if (debugMode)
     {
         SceneNode *debugsn = App::GetGfxScene()->GetSceneManager()->getRootSceneNode()->createChildSceneNode();
@@ -25,6 +25,7 @@
 #include "Application.h"
 #include "SimData.h" // for collision_box_t
 
+#include <atomic>
 #include <mutex>
 #include <Ogre.h>
 
@@ -41,6 +42,27 @@ struct eventsource_t
     bool enabled;
 };
 
+/// Remembers the static collision grid cell a node was last found in, see `Collisions::nodeCollision()`
+struct NodeCellCache
+{
+    unsigned int cell_id = 0;
+    int slot = -1;               //!< Index into the cell table; -1 if the cell is empty
+    unsigned int generation = 0; //!< Grid version the entry is valid for
+};
+
+/// Scratch data of `Collisions::groundCollisionBatch()`, kept by the caller so buffers are reused every substep
+struct GroundQueryBatch
+{
+    std::vector<int>           nodes;          //!< Queried nodes (those with ground contact enabled)
+    std::vector<float>         pos_x, pos_y, pos_z;
+    std::vector<float>         height;         //!< Terrain height below each of `nodes`
+    std::vector<int>           contacts;       //!< Entries of `nodes` below the terrain
+    std::vector<float>         contact_x, contact_y, contact_z;
+    std::vector<Ogre::Vector3> normals;        //!< Terrain normal at each of `contacts`
+    std::vector<char>          ground_contact; //!< Per node of the range: touched the terrain
+    std::vector<NodeCellCache> cells;          //!< Per node of the range
+};
+
 class Collisions : public ZeroedMemoryAllocator
 {
 public:
@@ -61,43 +83,58 @@ private:
 
     /// Static collision object lookup system
     /// -------------------------------------
-    /// Terrain is split into equal-size 'cells' of dimension CELL_SIZE, identified by CellID
-    /// A hash table aggregates elements from multiple cells in one entry
-    struct hash_coll_element_t
+    /// Terrain is split into equal-size 'cells' of dimension CELL_SIZE, identified by CellID.
+    /// Elements are staged while the terrain loads; `finishLoadingTerrain()` packs them CSR-style:
+    /// an open-addressing table of occupied cells, each pointing to a contiguous run of `m_grid_elements`.
+    /// Elements added later (roads, script-spawned objects) are staged, too; `UpdateGrid()` merges them
+    /// into the packed runs before the next physics step. Lookups only read, so any number of physics threads may run them.
+    /// Main thread queries (`getSurfaceHeightBelow()`, `collisionCorrect()`) pack staged elements on demand while physics is stopped.
+    struct grid_staged_element_t
     {
-        static const int ELEMENT_TRI_BASE_INDEX = 1000000; // Effectively a maximum number of collision boxes
+        unsigned int cell_id;
+        int element_index;
+        float height;
+    };
 
-        inline hash_coll_element_t(unsigned int cell_id_, int value): cell_id(cell_id_), element_index(value) {}
+    struct grid_cell_t
+    {
+        unsigned int cell_id;
+        int begin;          //!< First entry in `m_grid_elements`
+        int count;
+        float height;       //!< Top of the highest element in the cell
+    };
 
-        inline bool IsCollisionBox() const { return element_index < ELEMENT_TRI_BASE_INDEX; }
-        inline bool IsCollisionTri() const { return element_index >= ELEMENT_TRI_BASE_INDEX; }
+    static const int ELEMENT_TRI_BASE_INDEX = 1000000; // Effectively a maximum number of collision boxes
 
-        unsigned int cell_id;
+    /// Values below ELEMENT_TRI_BASE_INDEX are collision box indices (Collisions::m_collision_boxes),
+    ///    values above are collision tri indices (Collisions::m_collision_tris).
+    static inline bool IsCollisionBox(int element_index) { return element_index < ELEMENT_TRI_BASE_INDEX; }
+    static inline bool IsCollisionTri(int element_index) { return element_index >= ELEMENT_TRI_BASE_INDEX; }
 
-        /// Values below ELEMENT_TRI_BASE_INDEX are collision box indices (Collisions::m_collision_boxes),
-        ///    values above are collision tri indices (Collisions::m_collision_tris).
-        int element_index;
+    /// Hot data of a collision tri, scanned by every lookup
+    struct collision_tri_t
+    {
+        Ogre::Vector3 lo;       //!< AABB, enlarged by 0.1m
+        Ogre::Vector3 hi;
+        Ogre::Vector3 normal;   //!< Unit normal; `normal.dotProduct(pos) - plane_d` is the signed distance from the tri's plane
+        float plane_d;
+        bool enabled;
     };
 
-    struct collision_tri_t
+    /// Cold data of a collision tri, only touched once a position is inside the AABB and near the plane
+    struct collision_tri_ext_t
     {
         Ogre::Vector3 a;
         Ogre::Vector3 b;
         Ogre::Vector3 c;
-        Ogre::AxisAlignedBox aab;
         Ogre::Matrix3 forward;
         Ogre::Matrix3 reverse;
         ground_model_t* gm;
-        bool enabled;
     };
 
     static const int LATEST_GROUND_MODEL_VERSION = 3;
     static const int MAX_EVENT_SOURCE = 500;
 
-    // this is a power of two, change with caution
-    static const int HASH_POWER = 20;
-    static const int HASH_SIZE = 1 << HASH_POWER;
-
     // how many elements per cell? power of 2 minus 2 is better
     static const int CELL_BLOCKSIZE = 126;
 
@@ -111,12 +148,16 @@ private:
 
     // collision tris pool;
     std::vector<collision_tri_t> m_collision_tris; // Formerly MAX_COLLISION_TRIS = 100000
+    std::vector<collision_tri_ext_t> m_collision_tris_ext; // Parallel to `m_collision_tris`
 
     Ogre::AxisAlignedBox m_collision_aab; // Tight bounding box around all collision meshes
 
-    // collision hashtable
-    Ogre::Real hashtable_height[HASH_SIZE];
-    std::vector<hash_coll_element_t> hashtable[HASH_SIZE];
+    // collision grid
+    std::vector<grid_staged_element_t> m_grid_staging;  //!< Elements added since the last `UpdateGrid()`, in order; freed once packed
+    std::vector<grid_cell_t>           m_grid_cells;    //!< Open addressing, size is a power of 2
+    std::vector<int>                   m_grid_elements; //!< Element indices grouped by cell, runs in cell ID order
+    unsigned int                       m_grid_generation; //!< Bumped on every repack; invalidates `NodeCellCache` entries
+    std::atomic<bool>                  m_grid_in_use;   //!< Physics is running and reading the grid; staged elements must wait for `UpdateGrid()`
 
     // ground models
     std::map<Ogre::String, ground_model_t> ground_models;
@@ -134,13 +175,15 @@ private:
     int collision_version;
     inline int GetNumCollisionTris() const { return static_cast<int>(m_collision_tris.size()); }
     inline int GetNumCollisionBoxes() const { return static_cast<int>(m_collision_boxes.size()); }
-    unsigned int hashmask;
+    unsigned int hashmask;   //!< `m_grid_cells.size() - 1`
 
     const Ogre::Vector3 m_terrain_size;
 
     void hash_add(int cell_x, int cell_z, int value, float h);
-    int hash_find(int cell_x, int cell_z); /// Returns index to 'hashtable'
-    unsigned int hashfunc(unsigned int cellid);
+    const grid_cell_t& hash_find(int cell_x, int cell_z, NodeCellCache* cache = nullptr) const; /// Returns the cell, or an empty one; doesn't see elements added since `UpdateGrid()`
+    unsigned int hashfunc(unsigned int cellid) const;
+    void packStagedElements(); //!< Merges `m_grid_staging` into the packed grid: sorts only the new elements, then one linear pass
+    void packStagedElementsIfIdle(); //!< `packStagedElements()` if there are any and physics is stopped
     void parseGroundConfig(Ogre::ConfigFile* cfg, Ogre::String groundModel = "");
 
     Ogre::Vector3 calcCollidedSide(const Ogre::Vector3& pos, const Ogre::Vector3& lo, const Ogre::Vector3& hi);
@@ -163,11 +206,14 @@ public:
     float getSurfaceHeightBelow(float x, float z, float height);
     bool collisionCorrect(Ogre::Vector3* refpos, bool envokeScriptCallbacks = true);
     bool groundCollision(node_t* node, float dt);
+    void groundCollisionBatch(node_t* nodes, int begin, int end, float dt, GroundQueryBatch& batch); //!< `groundCollision()` for nodes [begin, end) in one pass
     bool isInside(Ogre::Vector3 pos, const Ogre::String& inst, const Ogre::String& box, float border = 0);
     bool isInside(Ogre::Vector3 pos, collision_box_t* cbox, float border = 0);
-    bool nodeCollision(node_t* node, float dt, bool envokeScriptCallbacks = true);
+    bool nodeCollision(node_t* node, float dt, bool envokeScriptCallbacks = true, NodeCellCache* cell_cache = nullptr);
 
     void finishLoadingTerrain();
+    void UpdateGrid(); //!< Packs elements added since the last call into the grid; main thread, only while physics is stopped.
+    void SetGridInUse(bool in_use) { m_grid_in_use = in_use; } //!< Set by ActorManager while the sim thread runs.
 
     int addCollisionBox(Ogre::SceneNode* tenode, bool rotating, bool virt, Ogre::Vector3 pos, Ogre::Vector3 rot, Ogre::Vector3 l, Ogre::Vector3 h, Ogre::Vector3 sr, const Ogre::String& eventname, const Ogre::String& instancename, bool forcecam, Ogre::Vector3 campos, Ogre::Vector3 sc = Ogre::Vector3::UNIT_SCALE, Ogre::Vector3 dr = Ogre::Vector3::ZERO, CollisionEventFilter event_filter = EVENT_ALL, int scripthandler = -1);
     int addCollisionMesh(Ogre::String meshname, Ogre::Vector3 pos, Ogre::Quaternion q, Ogre::Vector3 scale, ground_model_t* gm = 0, std::vector<int>* collTris = 0);
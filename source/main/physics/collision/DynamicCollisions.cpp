@@ -29,6 +29,13 @@
 #include "PointColDetector.h"
 #include "Triangle.h"
 
+#include <limits>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define ROR_COLLISIONS_SSE2
+    #include <emmintrin.h>
+#endif
+
 using namespace Ogre;
 using namespace RoR;
 
@@ -92,9 +99,117 @@ static bool InsideTriangleTest(const CartesianToTriangleTransform::TriangleCoord
 }
 
 
-/// Calculate collision forces and apply them to the collision node and the three vertex nodes of the collision triangle.
-void ResolveCollisionForces(const float penetration_depth,
-        node_t &hitnode, node_t &na, node_t &nb, node_t &no,
+/// Batched `CartesianToTriangleTransform` and `InsideTriangleTest` for the hit list positions in `buf`.
+/**
+ * Evaluates 4 points at a time; the padding lanes hold NaN and never pass.
+ * Fills `buf.hit_alpha`, `buf.hit_beta`, `buf.hit_distance` and lists the hits inside
+ * the triangle in `buf.inside`, in hit list order.
+ *
+ * @param m Transformation matrix, see `CartesianToTriangleTransform::matrix()`.
+ * @param c Vertex c of the triangle.
+ */
+static void InsideTriangleTestBatch(const Matrix3 &m, const Vector3 &c, const int num_points, const float margin,
+        InterActorCollisionBuffer &buf)
+{
+    buf.inside.clear();
+
+#ifdef ROR_COLLISIONS_SSE2
+    const __m128 m00 = _mm_set1_ps(m[0][0]), m01 = _mm_set1_ps(m[0][1]), m02 = _mm_set1_ps(m[0][2]);
+    const __m128 m10 = _mm_set1_ps(m[1][0]), m11 = _mm_set1_ps(m[1][1]), m12 = _mm_set1_ps(m[1][2]);
+    const __m128 m20 = _mm_set1_ps(m[2][0]), m21 = _mm_set1_ps(m[2][1]), m22 = _mm_set1_ps(m[2][2]);
+    const __m128 cx = _mm_set1_ps(c.x), cy = _mm_set1_ps(c.y), cz = _mm_set1_ps(c.z);
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 one = _mm_set1_ps(1.f);
+    const __m128 abs_mask = _mm_castsi128_ps(_mm_set1_epi32(0x7fffffff));
+    const __m128 margin4 = _mm_set1_ps(margin);
+
+    for (int i = 0; i < num_points; i += 4)
+    {
+        const __m128 dx = _mm_sub_ps(_mm_loadu_ps(&buf.hit_x[i]), cx);
+        const __m128 dy = _mm_sub_ps(_mm_loadu_ps(&buf.hit_y[i]), cy);
+        const __m128 dz = _mm_sub_ps(_mm_loadu_ps(&buf.hit_z[i]), cz);
+
+        // Same order of operations as `Matrix3 * Vector3`
+        const __m128 alpha    = _mm_add_ps(_mm_add_ps(_mm_mul_ps(m00, dx), _mm_mul_ps(m01, dy)), _mm_mul_ps(m02, dz));
+        const __m128 beta     = _mm_add_ps(_mm_add_ps(_mm_mul_ps(m10, dx), _mm_mul_ps(m11, dy)), _mm_mul_ps(m12, dz));
+        const __m128 distance = _mm_add_ps(_mm_add_ps(_mm_mul_ps(m20, dx), _mm_mul_ps(m21, dy)), _mm_mul_ps(m22, dz));
+        const __m128 gamma    = _mm_sub_ps(_mm_sub_ps(one, alpha), beta);
+
+        __m128 inside = _mm_and_ps(_mm_cmpge_ps(alpha, zero), _mm_cmpge_ps(beta, zero));
+        inside = _mm_and_ps(inside, _mm_cmpge_ps(gamma, zero));
+        inside = _mm_and_ps(inside, _mm_cmple_ps(_mm_and_ps(distance, abs_mask), margin4));
+
+        int mask = _mm_movemask_ps(inside);
+        if (mask != 0)
+        {
+            _mm_storeu_ps(&buf.hit_alpha[i], alpha);
+            _mm_storeu_ps(&buf.hit_beta[i], beta);
+            _mm_storeu_ps(&buf.hit_distance[i], distance);
+            for (int lane = 0; mask != 0; lane++, mask >>= 1)
+            {
+                if (mask & 1)
+                {
+                    buf.inside.push_back(i + lane);
+                }
+            }
+        }
+    }
+#else // ROR_COLLISIONS_SSE2
+    for (int i = 0; i < num_points; i++)
+    {
+        const float dx = buf.hit_x[i] - c.x;
+        const float dy = buf.hit_y[i] - c.y;
+        const float dz = buf.hit_z[i] - c.z;
+
+        const float alpha    = m[0][0] * dx + m[0][1] * dy + m[0][2] * dz;
+        const float beta     = m[1][0] * dx + m[1][1] * dy + m[1][2] * dz;
+        const float distance = m[2][0] * dx + m[2][1] * dy + m[2][2] * dz;
+        const float gamma    = 1.f - alpha - beta;
+
+        if ((alpha >= 0) && (beta >= 0) && (gamma >= 0) && (std::abs(distance) <= margin))
+        {
+            buf.hit_alpha[i] = alpha;
+            buf.hit_beta[i] = beta;
+            buf.hit_distance[i] = distance;
+            buf.inside.push_back(i);
+        }
+    }
+#endif // ROR_COLLISIONS_SSE2
+}
+
+
+/// Copy the hit list positions to `buf` as SoA, padded to a multiple of 4.
+static void GatherHitPositions(const std::vector<PointColDetector::pointid_t*> &hit_list, InterActorCollisionBuffer &buf)
+{
+    const size_t num_hits = hit_list.size();
+    const size_t padded = (num_hits + 3) & ~size_t(3);
+    if (buf.hit_x.size() < padded)
+    {
+        buf.hit_x.resize(padded);
+        buf.hit_y.resize(padded);
+        buf.hit_z.resize(padded);
+        buf.hit_alpha.resize(padded);
+        buf.hit_beta.resize(padded);
+        buf.hit_distance.resize(padded);
+    }
+
+    for (size_t i = 0; i < num_hits; i++)
+    {
+        const Vector3 &pos = hit_list[i]->actor->ar_nodes[hit_list[i]->node_id].AbsPosition;
+        buf.hit_x[i] = pos.x;
+        buf.hit_y[i] = pos.y;
+        buf.hit_z[i] = pos.z;
+    }
+    for (size_t i = num_hits; i < padded; i++)
+    {
+        buf.hit_x[i] = buf.hit_y[i] = buf.hit_z[i] = std::numeric_limits<float>::quiet_NaN();
+    }
+}
+
+
+/// Calculate the collision force on the collision node; the three vertex nodes of the collision triangle get the opposite.
+static Vector3 CalcCollisionForce(const float penetration_depth,
+        node_t &hitnode, const node_t &na, const node_t &nb, const node_t &no,
         const float alpha, const float beta, const float gamma,
         const Vector3 &normal,
         const float dt,
@@ -105,7 +220,21 @@ void ResolveCollisionForces(const float penetration_depth,
     const float tr_mass = na.mass * alpha + nb.mass * beta + no.mass * gamma;
     const float    mass = remote ? hitnode.mass : (hitnode.mass * tr_mass) / (hitnode.mass + tr_mass);
 
-    auto forcevec = primitiveCollision(&hitnode, velocity, mass, normal, dt, &submesh_ground_model, penetration_depth);
+    return primitiveCollision(&hitnode, velocity, mass, normal, dt, &submesh_ground_model, penetration_depth);
+}
+
+
+/// Calculate collision forces and apply them to the collision node and the three vertex nodes of the collision triangle.
+void ResolveCollisionForces(const float penetration_depth,
+        node_t &hitnode, node_t &na, node_t &nb, node_t &no,
+        const float alpha, const float beta, const float gamma,
+        const Vector3 &normal,
+        const float dt,
+        const bool remote,
+        ground_model_t &submesh_ground_model)
+{
+    const auto forcevec = CalcCollisionForce(penetration_depth, hitnode, na, nb, no, alpha, beta, gamma,
+            normal, dt, remote, submesh_ground_model);
 
     hitnode.Forces += forcevec;
     na.Forces      -= forcevec * alpha;
@@ -118,7 +247,8 @@ void RoR::ResolveInterActorCollisions(const float dt, PointColDetector &interPoi
         const int free_collcab, int collcabs[], int cabs[],
         collcab_rate_t inter_collcabrate[], node_t nodes[],
         const float collrange,
-        ground_model_t &submesh_ground_model)
+        ground_model_t &submesh_ground_model,
+        InterActorCollisionBuffer &buffer)
 {
     for (int i=0; i<free_collcab; i++)
     {
@@ -146,47 +276,43 @@ void RoR::ResolveInterActorCollisions(const float dt, PointColDetector &interPoi
             const Triangle triangle(na->AbsPosition, nb->AbsPosition, no->AbsPosition);
             const CartesianToTriangleTransform transform(triangle);
 
-            for (auto h : interPointCD.hit_list)
+            // transform all points to triangle local coordinates and test them at once
+            GatherHitPositions(interPointCD.hit_list, buffer);
+            InsideTriangleTestBatch(transform.matrix(), triangle.c, static_cast<int>(interPointCD.hit_list.size()),
+                    collrange, buffer);
+
+            for (int k : buffer.inside)
             {
+                const auto h = interPointCD.hit_list[k];
                 const auto hit_actor = h->actor;
                 const auto hitnode = &hit_actor->ar_nodes[h->node_id];
 
-                // transform point to triangle local coordinates
-                const auto local_point = transform(hitnode->AbsPosition);
-
-                // collision test
-                const bool is_colliding = InsideTriangleTest(local_point, collrange);
-                if (is_colliding)
-                {
-                    inter_collcabrate[i].rate = 0;
+                inter_collcabrate[i].rate = 0;
 
-                    const auto coord = local_point.barycentric;
-                    auto distance   = local_point.distance;
-                    auto normal     = triangle.normal();
+                const float alpha = buffer.hit_alpha[k];
+                const float beta  = buffer.hit_beta[k];
+                const float gamma = 1.f - alpha - beta;
+                auto distance     = buffer.hit_distance[k];
+                auto normal       = triangle.normal();
 
-                    // adapt in case the collision is occuring on the backface of the triangle
-                    const auto neighbour_node_ids = hit_actor->ar_node_to_node_connections[h->node_id];
-                    const bool is_backface = BackfaceCollisionTest(distance, normal, *no, neighbour_node_ids, hit_actor->ar_nodes);
-                    if (is_backface)
-                    {
-                        // flip surface normal and distance to triangle plane
-                        normal   = -normal;
-                        distance = -distance;
-                    }
+                // adapt in case the collision is occuring on the backface of the triangle
+                const auto &neighbour_node_ids = hit_actor->ar_node_to_node_connections[h->node_id];
+                const bool is_backface = BackfaceCollisionTest(distance, normal, *no, neighbour_node_ids, hit_actor->ar_nodes);
+                if (is_backface)
+                {
+                    // flip surface normal and distance to triangle plane
+                    normal   = -normal;
+                    distance = -distance;
+                }
 
-                    const auto penetration_depth = collrange - distance;
+                const auto penetration_depth = collrange - distance;
 
-                    const bool remote = (hit_actor->ar_sim_state == Actor::SimState::NETWORKED_OK);
+                const bool remote = (hit_actor->ar_sim_state == Actor::SimState::NETWORKED_OK);
 
-                    ResolveCollisionForces(penetration_depth, *hitnode, *na, *nb, *no, coord.alpha,
-                            coord.beta, coord.gamma, normal, dt, remote, submesh_ground_model);
+                const Vector3 force = CalcCollisionForce(penetration_depth, *hitnode, *na, *nb, *no, alpha,
+                        beta, gamma, normal, dt, remote, submesh_ground_model);
 
-                    hitnode->nd_last_collision_gm = &submesh_ground_model;
-                    hitnode->nd_has_mesh_contact = true;
-                    na->nd_has_mesh_contact = true;
-                    nb->nd_has_mesh_contact = true;
-                    no->nd_has_mesh_contact = true;
-                }
+                buffer.contacts.push_back({hitnode, na, nb, no, force, alpha, beta, gamma, &submesh_ground_model});
             }
         }
         else
@@ -197,6 +323,24 @@ void RoR::ResolveInterActorCollisions(const float dt, PointColDetector &interPoi
 }
 
 
+void RoR::ApplyInterActorContacts(const std::vector<InterActorContact> &contacts)
+{
+    for (const InterActorContact &c : contacts)
+    {
+        c.hitnode->Forces += c.force;
+        c.na->Forces      -= c.force * c.alpha;
+        c.nb->Forces      -= c.force * c.beta;
+        c.no->Forces      -= c.force * c.gamma;
+
+        c.hitnode->nd_last_collision_gm = c.gm;
+        c.hitnode->nd_has_mesh_contact = true;
+        c.na->nd_has_mesh_contact = true;
+        c.nb->nd_has_mesh_contact = true;
+        c.no->nd_has_mesh_contact = true;
+    }
+}
+
+
 void RoR::ResolveIntraActorCollisions(const float dt, PointColDetector &intraPointCD,
         const int free_collcab, int collcabs[], int cabs[],
         collcab_rate_t intra_collcabrate[], node_t nodes[],
@@ -24,13 +24,42 @@
 #include "ForwardDeclarations.h"
 #include "SimData.h"
 
+#include <vector>
+
 namespace RoR {
 
+/// Collision of a node with a collcab of another actor, found by `ResolveInterActorCollisions()`.
+struct InterActorContact
+{
+    node_t*         hitnode;
+    node_t*         na;
+    node_t*         nb;
+    node_t*         no;
+    Ogre::Vector3   force;              //!< Force on `hitnode`; the triangle nodes get the opposite, weighted by alpha/beta/gamma
+    float           alpha, beta, gamma;
+    ground_model_t* gm;
+};
+
+/// Scratch space of `ResolveInterActorCollisions()`; one per concurrent call, reused between substeps.
+struct InterActorCollisionBuffer
+{
+    std::vector<float>  hit_x, hit_y, hit_z;     //!< Hit list positions (SoA), padded to a multiple of 4
+    std::vector<float>  hit_alpha, hit_beta, hit_distance;
+    std::vector<int>    inside;                  //!< Hit list indices which passed the inside-triangle test
+    std::vector<InterActorContact> contacts;     //!< Output; cleared by the caller
+};
+
+/// Finds the collisions of other actors' nodes with the collcabs, but doesn't touch any node:
+/// the contacts go to `buffer.contacts`, to be applied by `ApplyInterActorContacts()`. Calls for
+/// different actors may thus run concurrently.
 void ResolveInterActorCollisions(const float dt, PointColDetector &interPointCD,
         const int free_collcab, int collcabs[], int cabs[],
         collcab_rate_t inter_collcabrate[], node_t nodes[],
         const float collrange,
-        ground_model_t &submesh_ground_model);
+        ground_model_t &submesh_ground_model,
+        InterActorCollisionBuffer &buffer);
+
+void ApplyInterActorContacts(const std::vector<InterActorContact> &contacts);
 
 void ResolveIntraActorCollisions(const float dt, PointColDetector &intraPointCD,
         const int free_collcab, int collcabs[], int cabs[],
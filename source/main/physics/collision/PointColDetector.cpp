@@ -38,18 +38,23 @@ void PointColDetector::UpdateIntraPoint(bool contactables)
         update_structures_for_contacters(contactables);
     }
 
-    m_kdtree[0].ref = NULL;
-    m_kdtree[0].begin = 0;
-    m_kdtree[0].end = -m_object_list_size;
+    m_kdtree.Update(PointKdTree::Mode::REFIT);
 }
 
 void PointColDetector::UpdateInterPoint(bool ignorestate)
 {
     m_linked_actors = m_actor->GetAllLinkedActors();
 
+    // The broadphase is only up to date on the simulation thread; `ignorestate` callers (spawn, reset) scan everything
+    ActorManager* actor_manager = App::GetGameContext()->GetActorManager();
+    std::vector<Actor*> all_actors;
+    if (ignorestate)
+        all_actors = actor_manager->GetActors();
+    const std::vector<Actor*>& candidates = ignorestate ? all_actors : actor_manager->GetBroadphase().GetCandidates(m_actor);
+
     int contacters_size = 0;
     std::vector<Actor*> collision_partners;
-    for (auto actor : App::GetGameContext()->GetActorManager()->GetActors())
+    for (auto actor : candidates)
     {
         if (actor != m_actor && (ignorestate || actor->ar_update_physics) &&
                 m_actor->ar_bounding_box.intersects(actor->ar_bounding_box))
@@ -82,15 +87,13 @@ void PointColDetector::UpdateInterPoint(bool ignorestate)
         update_structures_for_contacters(false);
     }
 
-    m_kdtree[0].ref = NULL;
-    m_kdtree[0].begin = 0;
-    m_kdtree[0].end = -m_object_list_size;
+    m_kdtree.Update(PointKdTree::Mode::REFIT);
 }
 
 void PointColDetector::update_structures_for_contacters(bool ignoreinternal)
 {
-    m_ref_list.resize(m_object_list_size);
     m_pointid_list.resize(m_object_list_size);
+    m_kdtree.Reset(m_object_list_size);
 
     // Insert all contacters into the list of points to consider when building the kdtree
     int refi = 0;
@@ -104,14 +107,11 @@ void PointColDetector::update_structures_for_contacters(bool ignoreinternal)
             {
                 m_pointid_list[refi].actor = actor;
                 m_pointid_list[refi].node_id = i;
-                m_ref_list[refi].pidref = &m_pointid_list[refi];
-                m_ref_list[refi].point = actor->ar_nodes[i].AbsPosition.ptr();
+                m_kdtree.SetPoint(refi, actor->ar_nodes[i].AbsPosition.ptr());
                 refi++;
             }
         }
     }
-
-    m_kdtree.resize(std::max(1.0, std::pow(2, std::ceil(std::log2(m_object_list_size)) + 1)));
 }
 
 void PointColDetector::query(const Vector3 &vec1, const Vector3 &vec2, const Vector3 &vec3, float enlargeBB)
@@ -143,187 +143,10 @@ void PointColDetector::query(const Vector3 &vec1, const Vector3 &vec2, const Vec
     m_bbmax += enlargeBB;
 
     hit_list.clear();
-    queryrec(0, 0);
-}
-
-void PointColDetector::queryrec(int kdindex, int axis)
-{
-    for (;;)
-    {
-        if (m_kdtree[kdindex].end < 0)
-        {
-            build_kdtree_incr(axis, kdindex);
-        }
-
-        if (m_kdtree[kdindex].ref != NULL)
-        {
-            const float *point = m_kdtree[kdindex].ref->point;
-            if (point[0] >= m_bbmin.x && point[0] <= m_bbmax.x &&
-                point[1] >= m_bbmin.y && point[1] <= m_bbmax.y &&
-                point[2] >= m_bbmin.z && point[2] <= m_bbmax.z)
-            {
-                hit_list.push_back(m_kdtree[kdindex].ref->pidref);
-            }
-            return;
-        }
-
-        if (m_bbmax[axis] >= m_kdtree[kdindex].middle)
-        {
-            if (m_bbmin[axis] > m_kdtree[kdindex].max)
-            {
-                return;
-            }
-
-            int newaxis = axis + 1;
-
-            if (newaxis >= 3)
-            {
-                newaxis = 0;
-            }
-
-            int newindex = kdindex + kdindex + 1;
-
-            if (m_bbmin[axis] <= m_kdtree[kdindex].middle)
-            {
-                queryrec(newindex, newaxis);
-            }
-
-            kdindex = newindex + 1;
-            axis = newaxis;
-        }
-        else
-        {
-            if (m_bbmax[axis] < m_kdtree[kdindex].min)
-            {
-                return;
-            }
-
-            kdindex = 2 * kdindex + 1;
-            axis++;
-
-            if (axis >= 3)
-            {
-                axis = 0;
-            }
-        }
-    }
-}
-
-void PointColDetector::build_kdtree_incr(int axis, int index)
-{
-    int end = -m_kdtree[index].end;
-    m_kdtree[index].end = end;
-    int begin = m_kdtree[index].begin;
-    int median;
-    int slice_size = end - begin;
-    if (slice_size != 1)
-    {
-        int newindex=index+index+1;
-        if (slice_size == 2)
-        {
-            median = begin+1;
-            if (m_ref_list[begin].point[axis] > m_ref_list[median].point[axis])
-            {
-                std::swap(m_ref_list[begin], m_ref_list[median]);
-            }
-
-            m_kdtree[index].min = m_ref_list[begin].point[axis];
-            m_kdtree[index].max = m_ref_list[median].point[axis];
-            m_kdtree[index].middle = m_kdtree[index].max;
-            m_kdtree[index].ref = NULL;
-
-            axis++;
-            if (axis >= 3)
-            {
-                axis = 0;
-            }
-
-            m_kdtree[newindex].ref = &m_ref_list[begin];
-            m_kdtree[newindex].middle = m_kdtree[newindex].ref->point[axis];
-            m_kdtree[newindex].min = m_kdtree[newindex].middle;
-            m_kdtree[newindex].max = m_kdtree[newindex].middle;
-            m_kdtree[newindex].end = median;
-            newindex++;
-
-            m_kdtree[newindex].ref = &m_ref_list[median];
-            m_kdtree[newindex].middle = m_kdtree[newindex].ref->point[axis];
-            m_kdtree[newindex].min = m_kdtree[newindex].middle;
-            m_kdtree[newindex].max = m_kdtree[newindex].middle;
-            m_kdtree[newindex].end = end;
-            return;
-        }
-        else
-        {
-            median = begin + (slice_size / 2);
-            partintwo(begin, median, end, axis, m_kdtree[index].min, m_kdtree[index].max);
-        }
-
-        m_kdtree[index].middle = m_ref_list[median].point[axis];
-        m_kdtree[index].ref = NULL;
-
-        m_kdtree[newindex].begin = begin;
-        m_kdtree[newindex].end = -median;
-
-        newindex++;
-        m_kdtree[newindex].begin = median;
-        m_kdtree[newindex].end = -end;
-
-    }
-    else
-    {
-        m_kdtree[index].ref = &m_ref_list[begin];
-        m_kdtree[index].middle = m_kdtree[index].ref->point[axis];
-        m_kdtree[index].min = m_kdtree[index].middle;
-        m_kdtree[index].max = m_kdtree[index].middle;
-    }
-}
-
-void PointColDetector::partintwo(const int start, const int median, const int end, const int axis, float &minex, float &maxex)
-{
-    int i, j, l, m;
-    int k = median;
-    l = start;
-    m = end - 1;
-
-    float x = m_ref_list[k].point[axis];
-    while (l < m)
-    {
-        i = l;
-        j = m;
-        while (!(j < k || k < i))
-        {
-            while (m_ref_list[i].point[axis] < x)
-            {
-                i++;
-            }
-            while (x < m_ref_list[j].point[axis])
-            {
-                j--;
-            }
-
-            std::swap(m_ref_list[i], m_ref_list[j]);
-            i++;
-            j--;
-        }
-        if (j < k)
-        {
-            l = i;
-        }
-        if (k < i)
-        {
-            m = j;
-        }
-        x = m_ref_list[k].point[axis];
-    }
-
-    minex = x;
-    maxex = x;
-    for (int i = start; i < median; ++i)
-    {
-        minex = std::min(m_ref_list[i].point[axis], minex);
-    }
-    for (int i = median+1; i < end; ++i)
+    m_hit_ids.clear();
+    m_kdtree.Query(m_bbmin.ptr(), m_bbmax.ptr(), m_hit_ids);
+    for (int id : m_hit_ids)
     {
-        maxex = std::max(maxex, m_ref_list[i].point[axis]);
+        hit_list.push_back(&m_pointid_list[id]);
     }
 }
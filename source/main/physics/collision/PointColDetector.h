@@ -20,6 +20,7 @@
 #pragma once
 
 #include "Application.h"
+#include "PointKdTree.h"
 
 namespace RoR {
 
@@ -43,35 +44,16 @@ public:
 
 private:
 
-    struct refelem_t
-    {
-        pointid_t* pidref;
-        const float* point;
-    };
-
-    struct kdnode_t
-    {
-        float min;
-        int end;
-        float max;
-        refelem_t* ref;
-        float middle;
-        int begin;
-    };
-
     Actor*                 m_actor;
     std::vector<Actor*>    m_linked_actors;
     std::vector<Actor*>    m_collision_partners;
-    std::vector<refelem_t> m_ref_list;
     std::vector<pointid_t> m_pointid_list;
-    std::vector<kdnode_t>  m_kdtree;
+    std::vector<int>       m_hit_ids;
+    PointKdTree            m_kdtree;             //!< Refitted every substep, see `PointKdTree::Mode::REFIT`
     Ogre::Vector3          m_bbmin;
     Ogre::Vector3          m_bbmax;
     int                    m_object_list_size;
 
-    void queryrec(int kdindex, int axis);
-    void build_kdtree_incr(int axis, int index);
-    void partintwo(const int start, const int median, const int end, const int axis, float& minex, float& maxex);
     void update_structures_for_contacters(bool ignoreinternal);
 };
 
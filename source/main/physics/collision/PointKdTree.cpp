@@ -0,0 +1,308 @@
+/*
+    This source file is part of Rigs of Rods
+    Copyright 2009 Lefteris Stamatogiannakis
+    Copyright 2026 Rigs of Rods contributors
+
+    For more information, see http://www.rigsofrods.org/
+
+    Rigs of Rods is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License version 3, as
+    published by the Free Software Foundation.
+
+    Rigs of Rods is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Rigs of Rods. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "PointKdTree.h"
+
+#include <algorithm>
+#include <utility>
+
+using namespace RoR;
+
+const float PointKdTree::REFIT_MAX_OVERLAP = 0.25f;
+
+void PointKdTree::Reset(int num_points)
+{
+    m_refs.resize(num_points);
+
+    // Median splits give a balanced tree; a complete one with `num_points` leaves fits into 2 * 2^ceil(log2(n)) slots
+    size_t num_leaves = 1;
+    while (num_leaves < static_cast<size_t>(num_points))
+    {
+        num_leaves <<= 1;
+    }
+    m_nodes.resize(2 * num_leaves);
+    m_bounds.resize(2 * num_leaves);
+    m_fully_built = false;
+}
+
+void PointKdTree::Update(Mode mode)
+{
+    if (mode == Mode::REFIT && m_fully_built)
+    {
+        this->Refit();
+        return;
+    }
+
+    kdnode_t& root = m_nodes[0];
+    root.begin = 0;
+    root.end = -static_cast<int>(m_refs.size());
+    root.ref = -1;
+    root.axis = 0;
+    m_fully_built = false;
+
+    if (mode == Mode::REFIT && !m_refs.empty())
+    {
+        this->BuildAll();
+    }
+}
+
+void PointKdTree::Query(const float bbmin[3], const float bbmax[3], std::vector<int>& hits)
+{
+    if (m_refs.empty())
+        return;
+
+    // Depth-first, left child first - same hit order as a recursive traversal
+    m_stack.clear();
+    m_stack.push_back(0);
+    while (!m_stack.empty())
+    {
+        int index = m_stack.back();
+        m_stack.pop_back();
+        for (;;)
+        {
+            if (m_nodes[index].end < 0)
+            {
+                this->BuildNode(index);
+            }
+
+            const kdnode_t& node = m_nodes[index];
+            if (node.ref != -1)
+            {
+                const float* point = m_refs[node.ref].point;
+                if (point[0] >= bbmin[0] && point[0] <= bbmax[0] &&
+                    point[1] >= bbmin[1] && point[1] <= bbmax[1] &&
+                    point[2] >= bbmin[2] && point[2] <= bbmax[2])
+                {
+                    hits.push_back(m_refs[node.ref].id);
+                }
+                break;
+            }
+
+            const int axis = node.axis;
+            if (bbmin[axis] > node.max || bbmax[axis] < node.min)
+                break;
+
+            const bool visit_left = bbmin[axis] <= node.left_max;
+            const bool visit_right = bbmax[axis] >= node.right_min;
+            const int left = index + index + 1;
+            if (visit_left && visit_right)
+            {
+                m_stack.push_back(left + 1);
+                index = left;
+            }
+            else if (visit_left)
+            {
+                index = left;
+            }
+            else if (visit_right)
+            {
+                index = left + 1;
+            }
+            else
+            {
+                break;
+            }
+        }
+    }
+}
+
+void PointKdTree::BuildNode(int index)
+{
+    kdnode_t& node = m_nodes[index];
+    const int end = -node.end;
+    node.end = end;
+    const int begin = node.begin;
+    const int axis = node.axis;
+    const int slice_size = end - begin;
+
+    if (slice_size == 1)
+    {
+        node.ref = begin;
+        node.min = m_refs[begin].point[axis];
+        node.max = node.min;
+        return;
+    }
+
+    const int newaxis = (axis + 1 < 3) ? axis + 1 : 0;
+    kdnode_t& left = m_nodes[index + index + 1];
+    kdnode_t& right = m_nodes[index + index + 2];
+    left.axis = newaxis;
+    right.axis = newaxis;
+    node.ref = -1;
+
+    int median;
+    if (slice_size == 2)
+    {
+        median = begin + 1;
+        if (m_refs[begin].point[axis] > m_refs[median].point[axis])
+        {
+            std::swap(m_refs[begin], m_refs[median]);
+        }
+        node.min = m_refs[begin].point[axis];
+        node.max = m_refs[median].point[axis];
+        node.left_max = node.min;
+        node.right_min = node.max;
+
+        // Both children are leaves
+        left.begin = begin;
+        left.end = median;
+        left.ref = begin;
+        left.min = m_refs[begin].point[newaxis];
+        left.max = left.min;
+
+        right.begin = median;
+        right.end = end;
+        right.ref = median;
+        right.min = m_refs[median].point[newaxis];
+        right.max = right.min;
+        return;
+    }
+
+    median = begin + (slice_size / 2);
+    this->PartInTwo(begin, median, end, axis, node.min, node.max);
+    node.left_max = m_refs[median].point[axis];
+    node.right_min = node.left_max;
+
+    left.begin = begin;
+    left.end = -median;
+    right.begin = median;
+    right.end = -end;
+}
+
+void PointKdTree::BuildAll()
+{
+    // Top-down, breadth-first; parents end up before their children in `m_built_nodes`
+    m_built_nodes.clear();
+    m_built_nodes.push_back(0);
+    for (size_t i = 0; i < m_built_nodes.size(); i++)
+    {
+        const int index = m_built_nodes[i];
+        if (m_nodes[index].end < 0)
+        {
+            this->BuildNode(index);
+        }
+        if (m_nodes[index].ref == -1)
+        {
+            m_built_nodes.push_back(index + index + 1);
+            m_built_nodes.push_back(index + index + 2);
+        }
+    }
+    m_fully_built = true;
+    m_num_rebuilds++;
+}
+
+void PointKdTree::Refit()
+{
+    float overlap = 0.f;
+    float extent = 0.f;
+
+    // Bottom-up: children before parents
+    for (size_t i = m_built_nodes.size(); i-- > 0; )
+    {
+        const int index = m_built_nodes[i];
+        kdnode_t& node = m_nodes[index];
+        bounds_t& bounds = m_bounds[index];
+        if (node.ref != -1)
+        {
+            const float* point = m_refs[node.ref].point;
+            for (int a = 0; a < 3; a++)
+            {
+                bounds.min[a] = point[a];
+                bounds.max[a] = point[a];
+            }
+            node.min = point[node.axis];
+            node.max = point[node.axis];
+            continue;
+        }
+
+        const bounds_t& left = m_bounds[index + index + 1];
+        const bounds_t& right = m_bounds[index + index + 2];
+        for (int a = 0; a < 3; a++)
+        {
+            bounds.min[a] = std::min(left.min[a], right.min[a]);
+            bounds.max[a] = std::max(left.max[a], right.max[a]);
+        }
+        const int axis = node.axis;
+        node.min = bounds.min[axis];
+        node.max = bounds.max[axis];
+        node.left_max = left.max[axis];
+        node.right_min = right.min[axis];
+
+        overlap += std::max(0.f, node.left_max - node.right_min);
+        extent += node.max - node.min;
+    }
+
+    if (overlap > REFIT_MAX_OVERLAP * extent)
+    {
+        m_nodes[0].begin = 0;
+        m_nodes[0].end = -static_cast<int>(m_refs.size());
+        this->BuildAll();
+    }
+}
+
+void PointKdTree::PartInTwo(const int start, const int median, const int end, const int axis, float& minex, float& maxex)
+{
+    int i, j, l, m;
+    int k = median;
+    l = start;
+    m = end - 1;
+
+    float x = m_refs[k].point[axis];
+    while (l < m)
+    {
+        i = l;
+        j = m;
+        while (!(j < k || k < i))
+        {
+            while (m_refs[i].point[axis] < x)
+            {
+                i++;
+            }
+            while (x < m_refs[j].point[axis])
+            {
+                j--;
+            }
+
+            std::swap(m_refs[i], m_refs[j]);
+            i++;
+            j--;
+        }
+        if (j < k)
+        {
+            l = i;
+        }
+        if (k < i)
+        {
+            m = j;
+        }
+        x = m_refs[k].point[axis];
+    }
+
+    minex = x;
+    maxex = x;
+    for (int i = start; i < median; ++i)
+    {
+        minex = std::min(m_refs[i].point[axis], minex);
+    }
+    for (int i = median+1; i < end; ++i)
+    {
+        maxex = std::max(maxex, m_refs[i].point[axis]);
+    }
+}
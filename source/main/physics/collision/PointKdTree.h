@@ -0,0 +1,96 @@
+/*
+    This source file is part of Rigs of Rods
+    Copyright 2009 Lefteris Stamatogiannakis
+    Copyright 2026 Rigs of Rods contributors
+
+    For more information, see http://www.rigsofrods.org/
+
+    Rigs of Rods is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License version 3, as
+    published by the Free Software Foundation.
+
+    Rigs of Rods is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Rigs of Rods. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/// @file
+/// @brief Kd-tree over moving points, used by PointColDetector. Depends only on the standard library.
+
+#pragma once
+
+#include <vector>
+
+namespace RoR {
+
+/// Kd-tree over points which move every physics substep (node positions).
+///
+/// REBUILD mode: the tree is discarded on every `Update()` and nodes are built lazily
+/// by the queries which reach them - cheap when only a few queries run.
+///
+/// REFIT mode: the topology (point order and splits) is kept across updates and only the
+/// bounds are recomputed, bottom-up. Moving points make sibling bounds overlap; once the
+/// overlap exceeds `REFIT_MAX_OVERLAP` of the extents, the tree is rebuilt.
+class PointKdTree
+{
+public:
+    enum class Mode
+    {
+        REBUILD,
+        REFIT
+    };
+
+    static const float REFIT_MAX_OVERLAP; //!< Summed sibling overlap / summed node extent which triggers a rebuild
+
+    void            Reset(int num_points);                   //!< Resizes the tree; points must be re-assigned with `SetPoint()`.
+    void            SetPoint(int id, const float* point)     { m_refs[id].id = id; m_refs[id].point = point; }
+    void            Update(Mode mode);                       //!< Call after points have moved, before querying.
+    void            Query(const float bbmin[3], const float bbmax[3], std::vector<int>& hits); //!< Appends ids of points inside the box.
+
+    int             GetNumPoints() const                     { return static_cast<int>(m_refs.size()); }
+    int             GetNumRebuilds() const                   { return m_num_rebuilds; }
+
+private:
+    struct refelem_t
+    {
+        int          id;
+        const float* point;
+    };
+
+    struct kdnode_t
+    {
+        float min;          //!< Extent of the node's points along `axis`
+        float max;
+        float left_max;     //!< Upper bound of the left child along `axis`
+        float right_min;    //!< Lower bound of the right child along `axis`
+        int   begin;        //!< Range of `m_refs`
+        int   end;          //!< Negative until built (lazy build)
+        int   ref;          //!< Index to `m_refs` for leaves, -1 otherwise
+        int   axis;
+    };
+
+    struct bounds_t
+    {
+        float min[3];
+        float max[3];
+    };
+
+    void            BuildNode(int index);
+    void            BuildAll();
+    void            Refit();
+    void            PartInTwo(int start, int median, int end, int axis, float& minex, float& maxex);
+
+    std::vector<refelem_t> m_refs;
+    std::vector<kdnode_t>  m_nodes;
+    std::vector<int>       m_built_nodes;     //!< REFIT: nodes in build order (parents before children)
+    std::vector<bounds_t>  m_bounds;          //!< REFIT: scratch, indexed like `m_nodes`
+    std::vector<int>       m_stack;           //!< Query traversal stack
+    bool                   m_fully_built = false;
+    int                    m_num_rebuilds = 0;
+};
+
+} // namespace RoR
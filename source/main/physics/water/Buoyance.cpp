@@ -34,8 +34,7 @@ using namespace RoR;
 Buoyance::Buoyance(DustPool* splash, DustPool* ripple) :
     splashp(splash),
     ripplep(ripple),
-    sink(0),
-    update(false)
+    sink(0)
 {
 }
 
@@ -44,13 +43,43 @@ Buoyance::~Buoyance()
 }
 
 //compute tetrahedron volume
-inline float Buoyance::computeVolume(Vector3 o, Vector3 a, Vector3 b, Vector3 c)
+inline float Buoyance::computeVolume(Vector3 o, Vector3 a, Vector3 b, Vector3 c) const
 {
     return ((a - o).dotProduct((b - o).crossProduct(c - o))) / 6.0;
 }
 
+//barycentric coordinates of a point on the node triangle
+void Buoyance::computeWaveWeights(const NodeTriangle& tri, Vector3 p, float& wa, float& wb, float& wc) const
+{
+    if (tri.inv_denom == 0.f)
+    {
+        wa = wb = wc = 1.f / 3.f;
+        return;
+    }
+    const Vector3 d = p - tri.pos[0];
+    const float d0 = d.dotProduct(tri.edge[0]);
+    const float d1 = d.dotProduct(tri.edge[1]);
+    wb = (tri.dot[2] * d0 - tri.dot[1] * d1) * tri.inv_denom;
+    wc = (tri.dot[0] * d1 - tri.dot[1] * d0) * tri.inv_denom;
+    wa = 1.f - wb - wc;
+}
+
+float Buoyance::getWaveHeight(const NodeTriangle& tri, Vector3 p) const
+{
+    float wa, wb, wc;
+    this->computeWaveWeights(tri, p, wa, wb, wc);
+    return wa * tri.wave_height[0] + wb * tri.wave_height[1] + wc * tri.wave_height[2];
+}
+
+Vector3 Buoyance::getWaveVelocity(const NodeTriangle& tri, Vector3 p) const
+{
+    float wa, wb, wc;
+    this->computeWaveWeights(tri, p, wa, wb, wc);
+    return wa * tri.wave_velocity[0] + wb * tri.wave_velocity[1] + wc * tri.wave_velocity[2];
+}
+
 //compute pressure and drag force on a submerged triangle
-Vector3 Buoyance::computePressureForceSub(Vector3 a, Vector3 b, Vector3 c, Vector3 vel, int type)
+Vector3 Buoyance::computePressureForceSub(const NodeTriangle& tri, Vector3 a, Vector3 b, Vector3 c, Vector3 vel, int type) const
 {
     //compute normal vector
     Vector3 normal = (b - a).crossProduct(c - a);
@@ -63,9 +92,9 @@ Vector3 Buoyance::computePressureForceSub(Vector3 a, Vector3 b, Vector3 c, Vecto
     if (type != BUOY_DRAGONLY)
     {
         //compute pression prism points
-        Vector3 ap = a + (App::GetSimTerrain()->getWater()->CalcWavesHeight(a) - a.y) * 9810 * normal;
-        Vector3 bp = b + (App::GetSimTerrain()->getWater()->CalcWavesHeight(b) - b.y) * 9810 * normal;
-        Vector3 cp = c + (App::GetSimTerrain()->getWater()->CalcWavesHeight(c) - c.y) * 9810 * normal;
+        Vector3 ap = a + (getWaveHeight(tri, a) - a.y) * 9810 * normal;
+        Vector3 bp = b + (getWaveHeight(tri, b) - b.y) * 9810 * normal;
+        Vector3 cp = c + (getWaveHeight(tri, c) - c.y) * 9810 * normal;
         //find centroid
         Vector3 ctd = (a + b + c + ap + bp + cp) / 6.0;
         //compute volume
@@ -85,7 +114,7 @@ Vector3 Buoyance::computePressureForceSub(Vector3 a, Vector3 b, Vector3 c, Vecto
         //take in account the wave speed
         //compute center
         Vector3 tc = (a + b + c) / 3.0;
-        vel = vel - App::GetSimTerrain()->getWater()->CalcWavesVelocity(tc);
+        vel = vel - getWaveVelocity(tri, tc);
         float vell = vel.length();
         if (vell > 0.01)
         {
@@ -94,7 +123,7 @@ Vector3 Buoyance::computePressureForceSub(Vector3 a, Vector3 b, Vector3 c, Vecto
             drg = (-500.0 * surf * vell * vell * cosaoa) * normal;
             if (normal.dotProduct(vel / vell) < 0)
                 drg = -drg;
-            if (update && splashp)
+            if (tri.update && splashp)
             {
                 float fxl = vell * cosaoa * surf;
                 if (fxl > 1.5) //if enough pushing drag
@@ -103,14 +132,15 @@ Vector3 Buoyance::computePressureForceSub(Vector3 a, Vector3 b, Vector3 c, Vecto
                     if (fxdir.y < 0)
                         fxdir.y = -fxdir.y;
 
-                    if (App::GetSimTerrain()->getWater()->CalcWavesHeight(a) - a.y < 0.1)
-                        splashp->malloc(a, fxdir);
+                    DustSpawnQueue& spawn_queue = App::GetGfxScene()->GetDustSpawnQueue();
+                    if (getWaveHeight(tri, a) - a.y < 0.1)
+                        spawn_queue.Push(splashp, DustSpawnQueue::SPAWN_DUST, a, fxdir);
 
-                    else if (App::GetSimTerrain()->getWater()->CalcWavesHeight(b) - b.y < 0.1)
-                        splashp->malloc(b, fxdir);
+                    else if (getWaveHeight(tri, b) - b.y < 0.1)
+                        spawn_queue.Push(splashp, DustSpawnQueue::SPAWN_DUST, b, fxdir);
 
-                    else if (App::GetSimTerrain()->getWater()->CalcWavesHeight(c) - c.y < 0.1)
-                        splashp->malloc(c, fxdir);
+                    else if (getWaveHeight(tri, c) - c.y < 0.1)
+                        spawn_queue.Push(splashp, DustSpawnQueue::SPAWN_DUST, c, fxdir);
                 }
             }
         }
@@ -122,9 +152,9 @@ Vector3 Buoyance::computePressureForceSub(Vector3 a, Vector3 b, Vector3 c, Vecto
 }
 
 //compute pressure and drag forces on a random triangle
-Vector3 Buoyance::computePressureForce(Vector3 a, Vector3 b, Vector3 c, Vector3 vel, int type)
+Vector3 Buoyance::computePressureForce(const NodeTriangle& tri, Vector3 a, Vector3 b, Vector3 c, Vector3 vel, int type) const
 {
-    float wha = App::GetSimTerrain()->getWater()->CalcWavesHeight((a + b + c) / 3.0);
+    float wha = getWaveHeight(tri, (a + b + c) / 3.0);
     //check if fully emerged
     if (a.y > wha && b.y > wha && c.y > wha)
         return Vector3::ZERO;
@@ -135,55 +165,74 @@ Vector3 Buoyance::computePressureForce(Vector3 a, Vector3 b, Vector3 c, Vector3
         //one dip
         if (a.y < wha && b.y > wha && c.y > wha)
         {
-            return computePressureForceSub(a, a + (wha - a.y) / (b.y - a.y) * (b - a), a + (wha - a.y) / (c.y - a.y) * (c - a), vel, type);
+            return computePressureForceSub(tri, a, a + (wha - a.y) / (b.y - a.y) * (b - a), a + (wha - a.y) / (c.y - a.y) * (c - a), vel, type);
         }
         if (b.y < wha && c.y > wha && a.y > wha)
         {
-            return computePressureForceSub(b, b + (wha - b.y) / (c.y - b.y) * (c - b), b + (wha - b.y) / (a.y - b.y) * (a - b), vel, type);
+            return computePressureForceSub(tri, b, b + (wha - b.y) / (c.y - b.y) * (c - b), b + (wha - b.y) / (a.y - b.y) * (a - b), vel, type);
         }
         if (c.y < wha && a.y > wha && b.y > wha)
         {
-            return computePressureForceSub(c, c + (wha - c.y) / (a.y - c.y) * (a - c), c + (wha - c.y) / (b.y - c.y) * (b - c), vel, type);
+            return computePressureForceSub(tri, c, c + (wha - c.y) / (a.y - c.y) * (a - c), c + (wha - c.y) / (b.y - c.y) * (b - c), vel, type);
         }
         //two dips
         if (a.y > wha && b.y < wha && c.y < wha)
         {
             Vector3 tb = a + (wha - a.y) / (b.y - a.y) * (b - a);
             Vector3 tc = a + (wha - a.y) / (c.y - a.y) * (c - a);
-            Vector3 f = computePressureForceSub(tb, b, tc, vel, type);
-            return f + computePressureForceSub(tc, b, c, vel, type);
+            Vector3 f = computePressureForceSub(tri, tb, b, tc, vel, type);
+            return f + computePressureForceSub(tri, tc, b, c, vel, type);
         }
         if (b.y > wha && c.y < wha && a.y < wha)
         {
             Vector3 tc = b + (wha - b.y) / (c.y - b.y) * (c - b);
             Vector3 ta = b + (wha - b.y) / (a.y - b.y) * (a - b);
-            Vector3 f = computePressureForceSub(tc, c, ta, vel, type);
-            return f + computePressureForceSub(ta, c, a, vel, type);
+            Vector3 f = computePressureForceSub(tri, tc, c, ta, vel, type);
+            return f + computePressureForceSub(tri, ta, c, a, vel, type);
         }
         if (c.y > wha && a.y < wha && b.y < wha)
         {
             Vector3 ta = c + (wha - c.y) / (a.y - c.y) * (a - c);
             Vector3 tb = c + (wha - c.y) / (b.y - c.y) * (b - c);
-            Vector3 f = computePressureForceSub(ta, a, tb, vel, type);
-            return f + computePressureForceSub(tb, a, b, vel, type);
+            Vector3 f = computePressureForceSub(tri, ta, a, tb, vel, type);
+            return f + computePressureForceSub(tri, tb, a, b, vel, type);
         }
         return Vector3::ZERO;
     }
     else
     {
         //fully submerged case
-        return computePressureForceSub(a, b, c, vel, type);
+        return computePressureForceSub(tri, a, b, c, vel, type);
     }
 }
 
-void Buoyance::computeNodeForce(node_t* a, node_t* b, node_t* c, bool doUpdate, int type)
+void Buoyance::computeNodeForce(const node_t* a, const node_t* b, const node_t* c, bool doUpdate, int type, const float* water_heights, const Vector3* water_velocities, Vector3* out_forces) const
 {
-    if (a->AbsPosition.y > App::GetSimTerrain()->getWater()->CalcWavesHeight(a->AbsPosition) &&
-        b->AbsPosition.y > App::GetSimTerrain()->getWater()->CalcWavesHeight(b->AbsPosition) &&
-        c->AbsPosition.y > App::GetSimTerrain()->getWater()->CalcWavesHeight(c->AbsPosition))
+    if (a->AbsPosition.y > water_heights[a->pos] &&
+        b->AbsPosition.y > water_heights[b->pos] &&
+        c->AbsPosition.y > water_heights[c->pos])
+    {
+        out_forces[0] = out_forces[1] = out_forces[2] = Vector3::ZERO;
         return;
+    }
 
-    update = doUpdate;
+    //waves were evaluated once per node; all points below lie on this triangle
+    NodeTriangle tri;
+    const node_t* corners[3] = { a, b, c };
+    for (int i = 0; i < 3; i++)
+    {
+        tri.pos[i] = corners[i]->AbsPosition;
+        tri.wave_height[i] = water_heights[corners[i]->pos];
+        tri.wave_velocity[i] = water_velocities[corners[i]->pos];
+    }
+    tri.edge[0] = tri.pos[1] - tri.pos[0];
+    tri.edge[1] = tri.pos[2] - tri.pos[0];
+    tri.dot[0] = tri.edge[0].dotProduct(tri.edge[0]);
+    tri.dot[1] = tri.edge[0].dotProduct(tri.edge[1]);
+    tri.dot[2] = tri.edge[1].dotProduct(tri.edge[1]);
+    const float denom = tri.dot[0] * tri.dot[2] - tri.dot[1] * tri.dot[1];
+    tri.inv_denom = (denom > 1e-12f) ? 1.f / denom : 0.f;
+    tri.update = doUpdate;
 
     //compute center
     Vector3 m = (a->AbsPosition + b->AbsPosition + c->AbsPosition) / 3.0;
@@ -204,8 +253,8 @@ void Buoyance::computeNodeForce(node_t* a, node_t* b, node_t* c, bool doUpdate,
     Vector3 mca = (c->AbsPosition + a->AbsPosition) / 2.0;
     Vector3 vel = (a->Velocity + b->Velocity + c->Velocity) / 3.0;
 
-    //apply forces
-    a->Forces += computePressureForce(a->AbsPosition, mab, m, vel, type) + computePressureForce(a->AbsPosition, m, mca, vel, type);
-    b->Forces += computePressureForce(b->AbsPosition, mbc, m, vel, type) + computePressureForce(b->AbsPosition, m, mab, vel, type);
-    c->Forces += computePressureForce(c->AbsPosition, mca, m, vel, type) + computePressureForce(c->AbsPosition, m, mbc, vel, type);
+    //compute forces
+    out_forces[0] = computePressureForce(tri, a->AbsPosition, mab, m, vel, type) + computePressureForce(tri, a->AbsPosition, m, mca, vel, type);
+    out_forces[1] = computePressureForce(tri, b->AbsPosition, mbc, m, vel, type) + computePressureForce(tri, b->AbsPosition, m, mab, vel, type);
+    out_forces[2] = computePressureForce(tri, c->AbsPosition, mca, m, vel, type) + computePressureForce(tri, c->AbsPosition, m, mbc, vel, type);
 }
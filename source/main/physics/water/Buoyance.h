@@ -31,7 +31,11 @@ public:
     Buoyance(DustPool* splash, DustPool* ripple);
     ~Buoyance();
 
-    void computeNodeForce(node_t *a, node_t *b, node_t *c, bool doUpdate, int type);
+    /// Forces on one node triangle; thread-safe, the caller adds them to the nodes (see `Actor::CalcBuoyance()`).
+    /// @param water_heights    Wave surface height at each node (see `Actor::CalcNodes()`)
+    /// @param water_velocities Wave surface velocity at each node
+    /// @param out_forces       Forces on a, b, c
+    void computeNodeForce(const node_t *a, const node_t *b, const node_t *c, bool doUpdate, int type, const float* water_heights, const Ogre::Vector3* water_velocities, Ogre::Vector3* out_forces) const;
 
     enum { BUOY_NORMAL, BUOY_DRAGONLY, BUOY_DRAGLESS };
 
@@ -39,17 +43,33 @@ public:
 
 private:
 
+    /// The node triangle being computed, with the wave surface at its corners
+    struct NodeTriangle
+    {
+        Ogre::Vector3 pos[3];
+        float         wave_height[3];
+        Ogre::Vector3 wave_velocity[3];
+        Ogre::Vector3 edge[2];
+        float         dot[3];       //!< edge0*edge0, edge0*edge1, edge1*edge1
+        float         inv_denom;    //!< 0 if the triangle is degenerate
+        bool          update;
+    };
+
     //compute tetrahedron volume
-    inline float computeVolume(Ogre::Vector3 o, Ogre::Vector3 a, Ogre::Vector3 b, Ogre::Vector3 c);
+    inline float computeVolume(Ogre::Vector3 o, Ogre::Vector3 a, Ogre::Vector3 b, Ogre::Vector3 c) const;
 
     //compute pressure and drag force on a submerged triangle
-    Ogre::Vector3 computePressureForceSub(Ogre::Vector3 a, Ogre::Vector3 b, Ogre::Vector3 c, Ogre::Vector3 vel, int type);
+    Ogre::Vector3 computePressureForceSub(const NodeTriangle& tri, Ogre::Vector3 a, Ogre::Vector3 b, Ogre::Vector3 c, Ogre::Vector3 vel, int type) const;
     
     //compute pressure and drag forces on a random triangle
-    Ogre::Vector3 computePressureForce(Ogre::Vector3 a, Ogre::Vector3 b, Ogre::Vector3 c, Ogre::Vector3 vel, int type);
+    Ogre::Vector3 computePressureForce(const NodeTriangle& tri, Ogre::Vector3 a, Ogre::Vector3 b, Ogre::Vector3 c, Ogre::Vector3 vel, int type) const;
+
+    //wave surface over the node triangle, interpolated from its corners
+    void computeWaveWeights(const NodeTriangle& tri, Ogre::Vector3 p, float& wa, float& wb, float& wc) const;
+    float getWaveHeight(const NodeTriangle& tri, Ogre::Vector3 p) const;
+    Ogre::Vector3 getWaveVelocity(const NodeTriangle& tri, Ogre::Vector3 p) const;
     
     DustPool *splashp, *ripplep;
-    bool update;
 };
 
 } // namespace RoRs
@@ -45,12 +45,12 @@ Screwprop::Screwprop(node_t* nodes, int noderef, int nodeback, int nodeup, float
     reset();
 }
 
-void Screwprop::updateForces(int update)
+void Screwprop::updateForces(int update, const float* water_heights)
 {
     if (!App::GetSimTerrain()->getWater())
         return;
 
-    float depth = App::GetSimTerrain()->getWater()->CalcWavesHeight(nodes[noderef].AbsPosition) - nodes[noderef].AbsPosition.y;
+    float depth = water_heights[noderef] - nodes[noderef].AbsPosition.y;
     if (depth < 0)
         return; //out of water!
     Vector3 dir = nodes[nodeback].RelPosition - nodes[noderef].RelPosition;
@@ -64,11 +64,12 @@ void Screwprop::updateForces(int update)
 
     if (update && splashp && throtle > 0.1)
     {
+        DustSpawnQueue& spawn_queue = App::GetGfxScene()->GetDustSpawnQueue();
         if (depth < 0.2)
-            splashp->allocSplash(nodes[noderef].AbsPosition, 10.0 * dir / fullpower);
+            spawn_queue.Push(splashp, DustSpawnQueue::SPAWN_SPLASH, nodes[noderef].AbsPosition, 10.0 * dir / fullpower);
         else
-            splashp->allocSplash(nodes[noderef].AbsPosition, 5.0 * dir / fullpower);
-        ripplep->allocRipple(nodes[noderef].AbsPosition, 10.0 * dir / fullpower);
+            spawn_queue.Push(splashp, DustSpawnQueue::SPAWN_SPLASH, nodes[noderef].AbsPosition, 5.0 * dir / fullpower);
+        spawn_queue.Push(ripplep, DustSpawnQueue::SPAWN_RIPPLE, nodes[noderef].AbsPosition, 10.0 * dir / fullpower);
     }
 }
 
@@ -0,0 +1,279 @@
+/*
+    This source file is part of Rigs of Rods
+    Copyright 2005-2012 Pierre-Michel Ricordel
+    Copyright 2007-2012 Thomas Fischer
+    Copyright 2013-2020 Petr Ohlidal
+    Copyright 2026 Rigs of Rods contributors
+
+    For more information, see http://www.rigsofrods.org/
+
+    Rigs of Rods is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License version 3, as
+    published by the Free Software Foundation.
+
+    Rigs of Rods is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Rigs of Rods. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "Wavefield.h"
+
+#include <algorithm>
+#include <cmath>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define ROR_WAVES_SSE2
+    #include <emmintrin.h>
+#endif
+
+using namespace RoR;
+
+namespace {
+
+const double TWO_PI          = 6.283185307179586;
+const float  DISTANCE_FACTOR = 1.f / 3000000.f; // Squared distance from the calm center -> amplitude factor
+
+// sin/cos: reduce to [-pi/4, pi/4] by multiples of pi/2 (Cody-Waite, 3 parts), then Cephes polynomials
+const float  TWO_OVER_PI     = 0.636619772f;
+const float  PIO2_A          = 1.5703125f;
+const float  PIO2_B          = 4.837512969970703125e-4f;
+const float  PIO2_C          = 7.54978995489188216e-8f;
+const float  SIN_P0 = -1.9515295891e-4f,       SIN_P1 = 8.3321608736e-3f,        SIN_P2 = -1.6666654611e-1f;
+const float  COS_P0 = 2.443315711809948e-5f,   COS_P1 = -1.388731625493765e-3f,  COS_P2 = 4.166664568298827e-2f;
+
+#ifdef ROR_WAVES_SSE2
+
+inline void SinCos4(__m128 x, __m128& out_sin, __m128& out_cos)
+{
+    const __m128i q = _mm_cvtps_epi32(_mm_mul_ps(x, _mm_set1_ps(TWO_OVER_PI)));
+    const __m128 qf = _mm_cvtepi32_ps(q);
+    __m128 r = _mm_sub_ps(x, _mm_mul_ps(qf, _mm_set1_ps(PIO2_A)));
+    r = _mm_sub_ps(r, _mm_mul_ps(qf, _mm_set1_ps(PIO2_B)));
+    r = _mm_sub_ps(r, _mm_mul_ps(qf, _mm_set1_ps(PIO2_C)));
+    const __m128 z = _mm_mul_ps(r, r);
+
+    __m128 s = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(SIN_P0), z), _mm_set1_ps(SIN_P1));
+    s = _mm_add_ps(_mm_mul_ps(s, z), _mm_set1_ps(SIN_P2));
+    s = _mm_add_ps(_mm_mul_ps(_mm_mul_ps(s, z), r), r);
+
+    __m128 c = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(COS_P0), z), _mm_set1_ps(COS_P1));
+    c = _mm_add_ps(_mm_mul_ps(c, z), _mm_set1_ps(COS_P2));
+    c = _mm_mul_ps(_mm_mul_ps(c, z), z);
+    c = _mm_add_ps(_mm_sub_ps(c, _mm_mul_ps(_mm_set1_ps(0.5f), z)), _mm_set1_ps(1.f));
+
+    // Quadrant `q & 3`: sin(x) = [s, c, -s, -c], cos(x) = [c, -s, -c, s]
+    const __m128i one = _mm_set1_epi32(1);
+    const __m128i two = _mm_set1_epi32(2);
+    const __m128 swap = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(q, one), one));
+    const __m128 sin_sign = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(q, two), 30));
+    const __m128 cos_sign = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(_mm_add_epi32(q, one), two), 30));
+    out_sin = _mm_xor_ps(_mm_or_ps(_mm_and_ps(swap, c), _mm_andnot_ps(swap, s)), sin_sign);
+    out_cos = _mm_xor_ps(_mm_or_ps(_mm_and_ps(swap, s), _mm_andnot_ps(swap, c)), cos_sign);
+}
+
+#else // ROR_WAVES_SSE2
+
+inline void SinCos(float x, float& out_sin, float& out_cos)
+{
+    const int q = static_cast<int>(std::nearbyint(x * TWO_OVER_PI));
+    const float r = ((x - q * PIO2_A) - q * PIO2_B) - q * PIO2_C;
+    const float z = r * r;
+    const float s = ((SIN_P0 * z + SIN_P1) * z + SIN_P2) * z * r + r;
+    const float c = ((COS_P0 * z + COS_P1) * z + COS_P2) * z * z - 0.5f * z + 1.f;
+
+    // Quadrant `q & 3`: sin(x) = [s, c, -s, -c], cos(x) = [c, -s, -c, s]
+    out_sin = (q & 1) ? c : s;
+    out_cos = (q & 1) ? s : c;
+    if (q & 2)
+        out_sin = -out_sin;
+    if ((q + 1) & 2)
+        out_cos = -out_cos;
+}
+
+#endif // ROR_WAVES_SSE2
+
+} // namespace
+
+bool Wavefield::AddWaveTrain(float wavelength, float amplitude, float maxheight, float direction_rad)
+{
+    if (m_num_trains == MAX_TRAINS || wavelength <= 0.f)
+    {
+        return false;
+    }
+
+    const double wavespeed = 1.25 * std::sqrt(static_cast<double>(wavelength));
+    const double wavenumber = TWO_PI / wavelength;
+
+    WaveTrain& train = m_trains[m_num_trains++];
+    train.amplitude = amplitude;
+    train.maxheight = maxheight;
+    train.dir_sin = std::sin(direction_rad);
+    train.dir_cos = std::cos(direction_rad);
+    train.kx = static_cast<float>(wavenumber * train.dir_sin);
+    train.kz = static_cast<float>(wavenumber * train.dir_cos);
+    train.omega_dp = wavenumber * wavespeed;
+    train.omega = static_cast<float>(train.omega_dp);
+
+    m_max_amplitude += maxheight;
+    return true;
+}
+
+void Wavefield::SetCalmCenter(float x, float z)
+{
+    m_center_x = x;
+    m_center_z = z;
+}
+
+float Wavefield::CalcHeight(double time_sec, float x, float y, float z) const
+{
+    const float xyz[3] = { x, y, z };
+    float height;
+    this->CalcBatch(time_sec, xyz, 1, &height, nullptr);
+    return height;
+}
+
+void Wavefield::CalcVelocity(double time_sec, float x, float y, float z, float* out_xyz) const
+{
+    const float xyz[3] = { x, y, z };
+    float height;
+    this->CalcBatch(time_sec, xyz, 1, &height, out_xyz);
+}
+
+#ifdef ROR_WAVES_SSE2
+
+void Wavefield::CalcBatch(double time_sec, const float* xyz, size_t count, float* out_height, float* out_velocity) const
+{
+    // The time term of each train is the same for the whole batch; reduce it in double precision
+    // so the waves don't get choppy after hours of sim time
+    float time_phase[MAX_TRAINS];
+    for (size_t t = 0; t < m_num_trains; t++)
+    {
+        time_phase[t] = static_cast<float>(std::fmod(m_trains[t].omega_dp * time_sec, TWO_PI));
+    }
+
+    const __m128 sea_level = _mm_set1_ps(m_sea_level);
+    const __m128 limit = _mm_set1_ps(m_sea_level + m_max_amplitude);
+    for (size_t i = 0; i < count; i += 4)
+    {
+        // Deinterleave 4 points; a short tail repeats its last point
+        const size_t num_lanes = std::min<size_t>(4, count - i);
+        float lanes[3][4];
+        for (size_t l = 0; l < 4; l++)
+        {
+            const float* p = xyz + 3 * (i + std::min(l, num_lanes - 1));
+            lanes[0][l] = p[0];
+            lanes[1][l] = p[1];
+            lanes[2][l] = p[2];
+        }
+        const __m128 x = _mm_loadu_ps(lanes[0]);
+        const __m128 y = _mm_loadu_ps(lanes[1]);
+        const __m128 z = _mm_loadu_ps(lanes[2]);
+
+        __m128 height = sea_level;
+        __m128 vel_x = _mm_setzero_ps();
+        __m128 vel_y = _mm_setzero_ps();
+        __m128 vel_z = _mm_setzero_ps();
+        const __m128 active = _mm_cmple_ps(y, limit); // Points above the highest wave just get the sea level
+        if (_mm_movemask_ps(active) != 0)
+        {
+            const __m128 dx = _mm_sub_ps(x, _mm_set1_ps(m_center_x));
+            const __m128 dy = _mm_sub_ps(y, sea_level);
+            const __m128 dz = _mm_sub_ps(z, _mm_set1_ps(m_center_z));
+            const __m128 dist_sq = _mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)), _mm_mul_ps(dz, dz));
+            const __m128 factor = _mm_mul_ps(dist_sq, _mm_set1_ps(DISTANCE_FACTOR));
+
+            __m128 waves = _mm_setzero_ps();
+            for (size_t t = 0; t < m_num_trains; t++)
+            {
+                const WaveTrain& train = m_trains[t];
+                const __m128 amp = _mm_min_ps(_mm_mul_ps(_mm_set1_ps(train.amplitude), factor), _mm_set1_ps(train.maxheight));
+                const __m128 phase = _mm_add_ps(_mm_set1_ps(time_phase[t]),
+                    _mm_add_ps(_mm_mul_ps(_mm_set1_ps(train.kx), x), _mm_mul_ps(_mm_set1_ps(train.kz), z)));
+                __m128 wave_sin, wave_cos;
+                SinCos4(phase, wave_sin, wave_cos);
+                waves = _mm_add_ps(waves, _mm_mul_ps(amp, wave_sin));
+                if (out_velocity)
+                {
+                    const __m128 speed = _mm_mul_ps(amp, _mm_set1_ps(train.omega));
+                    const __m128 speed_sin = _mm_mul_ps(speed, wave_sin);
+                    vel_x = _mm_add_ps(vel_x, _mm_mul_ps(speed_sin, _mm_set1_ps(train.dir_sin)));
+                    vel_y = _mm_add_ps(vel_y, _mm_mul_ps(speed, wave_cos));
+                    vel_z = _mm_add_ps(vel_z, _mm_mul_ps(speed_sin, _mm_set1_ps(train.dir_cos)));
+                }
+            }
+            height = _mm_add_ps(sea_level, _mm_and_ps(active, waves));
+            vel_x = _mm_and_ps(active, vel_x);
+            vel_y = _mm_and_ps(active, vel_y);
+            vel_z = _mm_and_ps(active, vel_z);
+        }
+
+        float result[4][4];
+        _mm_storeu_ps(result[0], height);
+        _mm_storeu_ps(result[1], vel_x);
+        _mm_storeu_ps(result[2], vel_y);
+        _mm_storeu_ps(result[3], vel_z);
+        for (size_t l = 0; l < num_lanes; l++)
+        {
+            out_height[i + l] = result[0][l];
+            if (out_velocity)
+            {
+                out_velocity[3 * (i + l) + 0] = result[1][l];
+                out_velocity[3 * (i + l) + 1] = result[2][l];
+                out_velocity[3 * (i + l) + 2] = result[3][l];
+            }
+        }
+    }
+}
+
+#else // ROR_WAVES_SSE2
+
+void Wavefield::CalcBatch(double time_sec, const float* xyz, size_t count, float* out_height, float* out_velocity) const
+{
+    float time_phase[MAX_TRAINS];
+    for (size_t t = 0; t < m_num_trains; t++)
+    {
+        time_phase[t] = static_cast<float>(std::fmod(m_trains[t].omega_dp * time_sec, TWO_PI));
+    }
+
+    for (size_t i = 0; i < count; i++)
+    {
+        const float x = xyz[3 * i + 0];
+        const float y = xyz[3 * i + 1];
+        const float z = xyz[3 * i + 2];
+        float height = m_sea_level;
+        float vel[3] = { 0.f, 0.f, 0.f };
+        if (y <= m_sea_level + m_max_amplitude)
+        {
+            const float dx = x - m_center_x;
+            const float dy = y - m_sea_level;
+            const float dz = z - m_center_z;
+            const float factor = (dx * dx + dy * dy + dz * dz) * DISTANCE_FACTOR;
+            for (size_t t = 0; t < m_num_trains; t++)
+            {
+                const WaveTrain& train = m_trains[t];
+                const float amp = std::min(train.amplitude * factor, train.maxheight);
+                float wave_sin, wave_cos;
+                SinCos(time_phase[t] + train.kx * x + train.kz * z, wave_sin, wave_cos);
+                height += amp * wave_sin;
+                const float speed = amp * train.omega;
+                vel[0] += speed * wave_sin * train.dir_sin;
+                vel[1] += speed * wave_cos;
+                vel[2] += speed * wave_sin * train.dir_cos;
+            }
+        }
+
+        out_height[i] = height;
+        if (out_velocity)
+        {
+            out_velocity[3 * i + 0] = vel[0];
+            out_velocity[3 * i + 1] = vel[1];
+            out_velocity[3 * i + 2] = vel[2];
+        }
+    }
+}
+
+#endif // ROR_WAVES_SSE2
@@ -0,0 +1,78 @@
+/*
+    This source file is part of Rigs of Rods
+    Copyright 2005-2012 Pierre-Michel Ricordel
+    Copyright 2007-2012 Thomas Fischer
+    Copyright 2013-2020 Petr Ohlidal
+    Copyright 2026 Rigs of Rods contributors
+
+    For more information, see http://www.rigsofrods.org/
+
+    Rigs of Rods is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License version 3, as
+    published by the Free Software Foundation.
+
+    Rigs of Rods is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Rigs of Rods. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/// @file
+/// @brief Sea surface made of sine wave trains (see 'wavefield.cfg').
+
+#pragma once
+
+// NOTE: Only depends on the standard library, so that microbenchmarks can use it directly.
+
+#include <cstddef>
+
+namespace RoR {
+
+/// Physics: Sum of sine wave trains; the surface of class `Water`.
+///
+/// Time is an argument of every query, not a clock of its own - the simulation passes its sim time,
+/// so the sea follows slow motion and pause and replays exactly. Queries are const and thread-safe.
+/// Waves grow with the distance from the calm center (the middle of the terrain).
+class Wavefield
+{
+public:
+    static const size_t MAX_TRAINS = 16;
+
+    bool            AddWaveTrain(float wavelength, float amplitude, float maxheight, float direction_rad); //!< Returns false when full
+    size_t          GetNumTrains() const          { return m_num_trains; }
+    float           GetMaxAmplitude() const       { return m_max_amplitude; } //!< Sum of the max. heights of all trains
+    void            SetSeaLevel(float height)     { m_sea_level = height; }
+    float           GetSeaLevel() const           { return m_sea_level; }
+    void            SetCalmCenter(float x, float z);
+
+    /// Surface height and velocity at `count` points, given as packed x/y/z triplets.
+    /// Points above the highest possible wave get the sea level and zero velocity.
+    /// `out_velocity` (x/y/z triplets) may be null. Evaluates 4 points at a time with SSE2.
+    void            CalcBatch(double time_sec, const float* xyz, size_t count, float* out_height, float* out_velocity) const;
+
+    float           CalcHeight(double time_sec, float x, float y, float z) const;
+    void            CalcVelocity(double time_sec, float x, float y, float z, float* out_xyz) const;
+
+private:
+    struct WaveTrain
+    {
+        float       amplitude;  //!< Height per unit of the distance factor
+        float       maxheight;
+        float       kx, kz;     //!< Wave vector: direction * 2pi / wavelength
+        float       omega;      //!< Angular frequency: 2pi * speed / wavelength
+        double      omega_dp;   //!< Same in double precision, for the time term
+        float       dir_sin, dir_cos;
+    };
+
+    WaveTrain       m_trains[MAX_TRAINS];
+    size_t          m_num_trains = 0;
+    float           m_max_amplitude = 0.f;
+    float           m_sea_level = 0.f;
+    float           m_center_x = 0.f;
+    float           m_center_z = 0.f;
+};
+
+} // namespace RoR
@@ -42,14 +42,27 @@
 #include "SkinFileFormat.h"
 #include "TerrainManager.h"
 #include "Terrn2FileFormat.h"
+#include "ThreadPool.h"
 #include "Utils.h"
 
 #include <OgreFileSystem.h>
+#include <OgreZip.h>
 #include <rapidjson/document.h>
 #include <rapidjson/istreamwrapper.h>
 #include <rapidjson/ostreamwrapper.h>
 #include <rapidjson/writer.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
 #include <fstream>
+#include <functional>
+#include <iterator>
+#include <numeric>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
 
 using namespace Ogre;
 using namespace RoR;
@@ -123,7 +136,12 @@ void CacheSystem::LoadModCache(CacheValidity validity)
         if (validity == CacheValidity::NEEDS_REBUILD)
         {
             RoR::Log("[RoR|ModCache] Performing rebuild ...");
+            if (m_entries.empty())
+            {
+                this->LoadCacheFile(); // Only to remove the old preview images
+            }
             this->ClearCache();
+            this->LogChangeReport(this->ScanBundles(m_bundles));
         }
         else
         {
@@ -136,82 +154,117 @@ void CacheSystem::LoadModCache(CacheValidity validity)
         this->ParseKnownFiles(RGN_CONTENT);
         App::diag_log_console_echo->SetVal(orig_echo);
         this->DetectDuplicates();
-        this->WriteCacheFileJson();
+        this->WriteCacheFile();
     }
 
-    this->LoadCacheFileJson();
+    m_has_validity_report = false; // Only valid for this update, the files may change afterwards
+    m_validity_report = CacheChangeReport();
+    m_validity_bundles.clear();
+
+    this->LoadCacheFile();
 
     RoR::Log("[RoR|ModCache] Cache loaded");
 }
 
+namespace {
+
+/// Appends the trigrams (3 consecutive bytes) of a string, packed into integers; unsorted, with duplicates.
+void CollectTrigrams(std::string const& str, std::vector<uint32_t>& out)
+{
+    for (size_t i = 0; i + 3 <= str.size(); i++)
+    {
+        out.push_back(uint32_t(uint8_t(str[i])) | (uint32_t(uint8_t(str[i + 1])) << 8) | (uint32_t(uint8_t(str[i + 2])) << 16));
+    }
+}
+
+void SortUnique(std::vector<uint32_t>& v)
+{
+    std::sort(v.begin(), v.end());
+    v.erase(std::unique(v.begin(), v.end()), v.end());
+}
+
+/// Which entries are listed by `CacheSystem::Query()` for a `LoaderType`.
+bool IsExtensionOfType(std::string const& fext, LoaderType type)
+{
+    if (fext == "terrn2")
+        return (type == LT_Terrain);
+    else if (fext == "skin")
+        return (type == LT_Skin);
+    else if (fext == "truck")
+        return (type == LT_AllBeam || type == LT_Vehicle || type == LT_Truck);
+    else if (fext == "car")
+        return (type == LT_AllBeam || type == LT_Vehicle || type == LT_Truck || type == LT_Car);
+    else if (fext == "boat")
+        return (type == LT_AllBeam || type == LT_Boat);
+    else if (fext == "airplane")
+        return (type == LT_AllBeam || type == LT_Airplane);
+    else if (fext == "trailer")
+        return (type == LT_AllBeam || type == LT_Trailer || type == LT_Extension);
+    else if (fext == "train")
+        return (type == LT_AllBeam || type == LT_Train);
+    else if (fext == "load")
+        return (type == LT_AllBeam || type == LT_Load || type == LT_Extension);
+    return false;
+}
+
+bool IsTerrainFilterMatched(CacheEntry const& entry, LoaderType type)
+{
+    return (type == LT_Terrain) == (entry.fext == "terrn2");
+}
+
+} // anonymous namespace
+
 CacheEntry* CacheSystem::FindEntryByFilename(LoaderType type, bool partial, std::string filename)
 {
     StringUtil::toLowerCase(filename);
+    CacheEntry* exact_match = this->FindEntryByLowercaseFilename(filename, type, /*match_type=*/true);
+    if (exact_match || !partial)
+        return exact_match;
+
+    // Shortest filename which contains the string
+    std::vector<size_t> positions;
+    if (!this->FindTrigramCandidates(filename, positions))
+    {
+        positions.resize(m_entries.size());
+        std::iota(positions.begin(), positions.end(), 0);
+    }
     size_t partial_match_length = std::numeric_limits<size_t>::max();
     CacheEntry* partial_match = nullptr;
-    for (CacheEntry& entry : m_entries)
+    for (size_t pos : positions)
     {
-        if ((type == LT_Terrain) != (entry.fext == "terrn2"))
+        CacheEntry& entry = m_entries[pos];
+        if (!IsTerrainFilterMatched(entry, type))
             continue;
 
-        String fname = entry.fname;
-        String fname_without_uid = entry.fname_without_uid;
-        StringUtil::toLowerCase(fname);
-        StringUtil::toLowerCase(fname_without_uid);
-        if (fname == filename || fname_without_uid == filename)
-            return &entry;
-
-        if (partial &&
-            fname.length() < partial_match_length &&
-            fname.find(filename) != std::string::npos)
+        if (entry.fname_lower.length() < partial_match_length &&
+            entry.fname_lower.find(filename) != std::string::npos)
         {
             partial_match = &entry;
-            partial_match_length = fname.length();
+            partial_match_length = entry.fname_lower.length();
         }
     }
 
-    return (partial) ? partial_match : nullptr;
+    return partial_match;
 }
 
 CacheValidity CacheSystem::EvaluateCacheValidity()
 {
-    this->GenerateHashFromFilenames();
-    this->LoadCacheFileJson();
-
-    // First, open cache file and get hash for quick update check
-    rapidjson::Document j_doc;
-    if (!App::GetContentManager()->LoadAndParseJson(CACHE_FILE, RGN_CACHE, j_doc))
-    {
-        RoR::Log("[RoR|ModCache] Invalid or missing cache file");
-        return CacheValidity::NEEDS_REBUILD;
-    }
-
-    if (j_doc["format_version"].GetInt() != CACHE_FILE_FORMAT)
+    m_has_validity_report = false;
+    m_validity_bundles.clear();
+    if (!this->LoadBundleIndex(m_validity_bundles))
     {
-        RoR::Log("[RoR|ModCache] Invalid cache file format");
-        return CacheValidity::NEEDS_REBUILD;
+        return CacheValidity::NEEDS_REBUILD; // Logged
     }
 
-    if (j_doc["global_hash"].GetString() != m_filenames_hash)
+    // Kept for the update, so it doesn't list and hash the bundles again; see `PruneCache()`
+    m_validity_report = this->ScanBundles(m_validity_bundles);
+    m_has_validity_report = true;
+    if (m_validity_report.HasChanges())
     {
         RoR::Log("[RoR|ModCache] Cache file out of date");
         return CacheValidity::NEEDS_UPDATE;
     }
 
-    for (auto& entry : m_entries)
-    {
-        std::string fn = entry.resource_bundle_path;
-        if (entry.resource_bundle_type == "FileSystem")
-        {
-            fn = PathCombine(fn, entry.fname);
-        }
-
-        if ((entry.filetime != RoR::GetFileLastModifiedTime(fn)))
-        {
-            return CacheValidity::NEEDS_UPDATE;
-        }
-    }
-
     RoR::Log("[RoR|ModCache] Cache valid");
     return CacheValidity::VALID;
 }
@@ -237,14 +290,7 @@ void CacheSystem::ImportEntryFromJson(rapidjson::Value& j_entry, CacheEntry & ou
     Ogre::StringUtil::trim(out_entry.guid);
 
     // Category
-    int category_id = j_entry["categoryid"].GetInt();
-    auto category_itor = m_categories.find(category_id);
-    if (category_itor == m_categories.end() || category_id >= CID_Max)
-    {
-        category_itor = m_categories.find(CID_Unsorted);
-    }
-    out_entry.categoryname = category_itor->second;
-    out_entry.categoryid = category_itor->first;
+    this->SetEntryCategory(out_entry, j_entry["categoryid"].GetInt());
 
      // Common - Authors
     for (rapidjson::Value& j_author: j_entry["authors"].GetArray())
@@ -302,33 +348,70 @@ void CacheSystem::ImportEntryFromJson(rapidjson::Value& j_entry, CacheEntry & ou
     }
 }
 
+static void ImportBundlesFromJson(rapidjson::Value& j_bundles, std::vector<CacheBundleInfo>& out_bundles)
+{
+    out_bundles.clear();
+    for (rapidjson::Value& j_bundle: j_bundles.GetArray())
+    {
+        CacheBundleInfo bundle;
+        bundle.path =         j_bundle["path"].GetString();
+        bundle.type =         j_bundle["type"].GetString();
+        bundle.size =         j_bundle["size"].GetUint64();
+        bundle.mtime =        static_cast<std::time_t>(j_bundle["mtime"].GetInt64());
+        bundle.content_hash = j_bundle["content_hash"].GetUint64();
+        out_bundles.push_back(bundle);
+    }
+}
+
 void CacheSystem::LoadCacheFileJson()
 {
     // Clear existing entries
     m_entries.clear();
+    m_bundles.clear();
+    this->ClearIndex();
 
     rapidjson::Document j_doc;
-    if (!App::GetContentManager()->LoadAndParseJson(CACHE_FILE, RGN_CACHE, j_doc) ||
-        !j_doc.IsObject() || !j_doc.HasMember("entries") || !j_doc["entries"].IsArray())
+    if (!App::GetContentManager()->LoadAndParseJson(CACHE_FILE_JSON, RGN_CACHE, j_doc) ||
+        !j_doc.IsObject() || !j_doc.HasMember("entries") || !j_doc["entries"].IsArray() ||
+        !j_doc.HasMember("bundles") || !j_doc["bundles"].IsArray())
     {
         RoR::Log("[RoR|ModCache] Error, cache file still invalid after check/update, content selector will be empty.");
         return;
     }
 
+    ImportBundlesFromJson(j_doc["bundles"], m_bundles);
+
     for (rapidjson::Value& j_entry: j_doc["entries"].GetArray())
     {
         CacheEntry entry;
         this->ImportEntryFromJson(j_entry, entry);
         entry.number = static_cast<int>(m_entries.size() + 1); // Let's number mods from 1
         m_entries.push_back(entry);
+        this->AddToIndex(m_entries.size() - 1);
     }
 }
 
 void CacheSystem::PruneCache()
 {
-    this->LoadCacheFileJson();
+    this->LoadCacheFile();
+
+    CacheChangeReport report;
+    if (m_has_validity_report)
+    {
+        // `LoadCacheFile()` read the same index `EvaluateCacheValidity()` started from
+        report = m_validity_report;
+        m_bundles = m_validity_bundles;
+    }
+    else
+    {
+        report = this->ScanBundles(m_bundles);
+    }
+    this->LogChangeReport(report);
+
+    std::set<std::string> stale_paths(report.removed.begin(), report.removed.end());
+    stale_paths.insert(report.modified.begin(), report.modified.end());
+    std::set<std::string> touched_paths(report.touched.begin(), report.touched.end());
 
-    std::vector<String> paths;
     for (auto& entry : m_entries)
     {
         std::string fn = entry.resource_bundle_path;
@@ -337,24 +420,222 @@ void CacheSystem::PruneCache()
             fn = PathCombine(fn, entry.fname);
         }
 
-        if (!RoR::FileExists(fn.c_str()) || (entry.filetime != RoR::GetFileLastModifiedTime(fn)))
+        if (stale_paths.find(fn) != stale_paths.end())
         {
             if (!entry.deleted)
             {
-                if (std::find(paths.begin(), paths.end(), fn) == paths.end())
-                {
-                    RoR::LogFormat("[RoR|ModCache] Removing '%s'", fn.c_str());
-                    paths.push_back(fn);
-                }
                 this->RemoveFileCache(entry);
             }
             entry.deleted = true;
         }
         else
         {
+            if (touched_paths.find(fn) != touched_paths.end())
+            {
+                entry.filetime = RoR::GetFileLastModifiedTime(fn);
+            }
             m_resource_paths.insert(fn);
         }
     }
+
+    // Bundles without entries (no usable content) were scanned before, too - only added and modified ones need it again
+    std::set<std::string> added_paths(report.added.begin(), report.added.end());
+    for (CacheBundleInfo const& bundle : m_bundles)
+    {
+        if (added_paths.find(bundle.path) == added_paths.end() && stale_paths.find(bundle.path) == stale_paths.end())
+        {
+            m_resource_paths.insert(bundle.path);
+        }
+    }
+}
+
+namespace {
+
+uint64_t HashBytes(const char* data, size_t size) // FNV-1a
+{
+    uint64_t hash = 14695981039346656037ull;
+    for (size_t i = 0; i < size; i++)
+    {
+        hash = (hash ^ static_cast<uint8_t>(data[i])) * 1099511628211ull;
+    }
+    return hash;
+}
+
+uint32_t ReadLittleEndian32(const char* data)
+{
+    const uint8_t* b = reinterpret_cast<const uint8_t*>(data);
+    return uint32_t(b[0]) | (uint32_t(b[1]) << 8) | (uint32_t(b[2]) << 16) | (uint32_t(b[3]) << 24);
+}
+
+/// For ZIP archives, only the central directory is hashed: it lists names, sizes and CRC-32 of all files.
+/// Returns false if the file can't be read.
+bool HashBundleContent(CacheBundleInfo const& bundle, uint64_t& out_hash)
+{
+    if (bundle.size == 0)
+    {
+        out_hash = HashBytes(nullptr, 0); // `MappedFile` doesn't open empty files
+        return true;
+    }
+
+    MappedFile file;
+    if (!file.Open(bundle.path.c_str()))
+    {
+        return false;
+    }
+
+    const char* data = file.GetData();
+    const size_t size = file.GetSize();
+    const size_t EOCD_SIZE = 22;       // End of central directory record, without the comment
+    const size_t MAX_COMMENT = 0xFFFF;
+    if (bundle.type == "Zip" && size >= EOCD_SIZE)
+    {
+        const size_t search_end = (size > EOCD_SIZE + MAX_COMMENT) ? (size - EOCD_SIZE - MAX_COMMENT) : 0;
+        for (size_t pos = size - EOCD_SIZE + 1; pos-- > search_end; )
+        {
+            if (std::memcmp(data + pos, "PK\x05\x06", 4) == 0)
+            {
+                const uint32_t cd_size = ReadLittleEndian32(data + pos + 12);
+                const uint32_t cd_offset = ReadLittleEndian32(data + pos + 16);
+                if (uint64_t(cd_offset) + cd_size <= pos)
+                {
+                    out_hash = HashBytes(data + cd_offset, cd_size);
+                    return true;
+                }
+                break; // ZIP64 or damaged; hash everything
+            }
+        }
+    }
+    out_hash = HashBytes(data, size);
+    return true;
+}
+
+bool CompareBundlePaths(CacheBundleInfo const& a, CacheBundleInfo const& b)
+{
+    return a.path < b.path;
+}
+
+} // anonymous namespace
+
+CacheChangeReport CacheSystem::ScanBundles(std::vector<CacheBundleInfo>& in_out_bundles) const
+{
+    // List the bundles as `ParseZipArchives()` and `ParseKnownFiles()` will find them
+    std::vector<CacheBundleInfo> found;
+    std::vector<std::string> patterns = { "*.zip", "*.skinzip" };
+    const size_t num_archive_patterns = patterns.size();
+    for (auto ext : m_known_extensions)
+    {
+        patterns.push_back("*." + ext);
+    }
+    for (size_t i = 0; i < patterns.size(); i++)
+    {
+        auto files = ResourceGroupManager::getSingleton().findResourceFileInfo(RGN_CONTENT, patterns[i]);
+        for (const auto& file : *files)
+        {
+            CacheBundleInfo bundle;
+            if (i < num_archive_patterns)
+            {
+                bundle.type = "Zip";
+                bundle.path = PathCombine(file.archive->getName(), file.filename);
+            }
+            else if (file.archive->getType() == "Zip") // Content archive added directly to RGN_CONTENT
+            {
+                bundle.type = "Zip";
+                bundle.path = file.archive->getName();
+            }
+            else
+            {
+                bundle.type = "FileSystem";
+                bundle.path = PathCombine(file.archive->getName(), file.filename);
+            }
+            if (RoR::GetFileSizeAndTime(bundle.path, bundle.size, bundle.mtime))
+            {
+                found.push_back(bundle);
+            }
+        }
+    }
+    std::sort(found.begin(), found.end(), CompareBundlePaths);
+    found.erase(std::unique(found.begin(), found.end(),
+        [](CacheBundleInfo const& a, CacheBundleInfo const& b) { return a.path == b.path; }), found.end());
+
+    // Compare with the index; both are sorted by path
+    std::sort(in_out_bundles.begin(), in_out_bundles.end(), CompareBundlePaths);
+    CacheChangeReport report;
+    std::vector<CacheBundleInfo> indexed;
+    auto old_itor = in_out_bundles.begin();
+    for (CacheBundleInfo& bundle : found)
+    {
+        while (old_itor != in_out_bundles.end() && old_itor->path < bundle.path)
+        {
+            report.removed.push_back(old_itor->path);
+            ++old_itor;
+        }
+
+        const bool is_new = (old_itor == in_out_bundles.end() || old_itor->path != bundle.path);
+        if (!is_new && old_itor->size == bundle.size && old_itor->mtime == bundle.mtime)
+        {
+            bundle.content_hash = old_itor->content_hash;
+            report.num_unchanged++;
+        }
+        else if (!HashBundleContent(bundle, bundle.content_hash))
+        {
+            // Content unknown - leave it out of the index, so it's treated as removed now and as added once it can be read.
+            RoR::LogFormat("[RoR|ModCache] Cannot read bundle '%s', skipping", bundle.path.c_str());
+            if (!is_new)
+            {
+                report.removed.push_back(bundle.path);
+                ++old_itor;
+            }
+            continue;
+        }
+        else if (is_new)
+        {
+            report.added.push_back(bundle.path);
+        }
+        else if (bundle.content_hash == old_itor->content_hash)
+        {
+            report.touched.push_back(bundle.path);
+        }
+        else
+        {
+            report.modified.push_back(bundle.path);
+        }
+
+        if (!is_new)
+        {
+            ++old_itor;
+        }
+        indexed.push_back(bundle);
+    }
+    for (; old_itor != in_out_bundles.end(); ++old_itor)
+    {
+        report.removed.push_back(old_itor->path);
+    }
+
+    in_out_bundles = indexed;
+    return report;
+}
+
+void CacheSystem::LogChangeReport(CacheChangeReport const& report)
+{
+    RoR::LogFormat("[RoR|ModCache] Bundles: %d unchanged, %d added, %d removed, %d modified, %d touched",
+        static_cast<int>(report.num_unchanged), static_cast<int>(report.added.size()), static_cast<int>(report.removed.size()),
+        static_cast<int>(report.modified.size()), static_cast<int>(report.touched.size()));
+    for (std::string const& path : report.added)
+    {
+        RoR::LogFormat("[RoR|ModCache] Added '%s'", path.c_str());
+    }
+    for (std::string const& path : report.removed)
+    {
+        RoR::LogFormat("[RoR|ModCache] Removing '%s'", path.c_str());
+    }
+    for (std::string const& path : report.modified)
+    {
+        RoR::LogFormat("[RoR|ModCache] Modified '%s'", path.c_str());
+    }
+    for (std::string const& path : report.touched)
+    {
+        RoR::LogFormat("[RoR|ModCache] Touched, same content '%s'", path.c_str());
+    }
 }
 
 void CacheSystem::DetectDuplicates()
@@ -549,7 +830,20 @@ void CacheSystem::WriteCacheFileJson()
     rapidjson::Document j_doc;
     j_doc.SetObject();
     j_doc.AddMember("format_version", CACHE_FILE_FORMAT, j_doc.GetAllocator());
-    j_doc.AddMember("global_hash", rapidjson::StringRef(m_filenames_hash.c_str()), j_doc.GetAllocator());
+
+    // Bundles
+    rapidjson::Value j_bundles(rapidjson::kArrayType);
+    for (CacheBundleInfo const& bundle : m_bundles)
+    {
+        rapidjson::Value j_bundle(rapidjson::kObjectType);
+        j_bundle.AddMember("path",         rapidjson::StringRef(bundle.path.c_str()),    j_doc.GetAllocator());
+        j_bundle.AddMember("type",         rapidjson::StringRef(bundle.type.c_str()),    j_doc.GetAllocator());
+        j_bundle.AddMember("size",         bundle.size,                                  j_doc.GetAllocator());
+        j_bundle.AddMember("mtime",        static_cast<int64_t>(bundle.mtime),           j_doc.GetAllocator());
+        j_bundle.AddMember("content_hash", bundle.content_hash,                          j_doc.GetAllocator());
+        j_bundles.PushBack(j_bundle, j_doc.GetAllocator());
+    }
+    j_doc.AddMember("bundles", j_bundles, j_doc.GetAllocator());
 
     // Entries
     rapidjson::Value j_entries(rapidjson::kArrayType);
@@ -563,15 +857,561 @@ void CacheSystem::WriteCacheFileJson()
     j_doc.AddMember("entries", j_entries, j_doc.GetAllocator());
 
     // Write to file
-    if (App::GetContentManager()->SerializeAndWriteJson(CACHE_FILE, RGN_CACHE, j_doc)) // Logs errors
+    if (App::GetContentManager()->SerializeAndWriteJson(CACHE_FILE_JSON, RGN_CACHE, j_doc)) // Logs errors
+    {
+        RoR::LogFormat("[RoR|ModCache] File '%s' written OK", CACHE_FILE_JSON);
+    }
+}
+
+void CacheSystem::SetEntryCategory(CacheEntry& entry, int category_id) const
+{
+    auto category_itor = m_categories.find(category_id);
+    if (category_itor == m_categories.end() || category_id >= CID_Max)
+    {
+        category_itor = m_categories.find(CID_Unsorted);
+    }
+    entry.categoryname = category_itor->second;
+    entry.categoryid = category_itor->first;
+}
+
+void CacheSystem::WriteCacheFile()
+{
+    this->WriteCacheFileBinary();
+    if (App::diag_cache_json->GetBool())
+    {
+        this->WriteCacheFileJson();
+    }
+}
+
+void CacheSystem::LoadCacheFile()
+{
+    if (App::diag_cache_json->GetBool())
+    {
+        this->LoadCacheFileJson();
+    }
+    else
+    {
+        this->LoadCacheFileBinary();
+    }
+}
+
+// -------------------------- Binary cache file --------------------------
+// Layout: header, bundle index, entry records, author records, section config names, string table.
+// Records have fixed size; strings and lists are ranges in the tables further down.
+// The file never leaves the machine, so native byte order is used.
+
+namespace {
+
+const char CACHE_FILE_MAGIC[8] = {'R', 'o', 'R', 'C', 'a', 'c', 'h', 'e'};
+
+struct CacheFileString
+{
+    uint32_t offset;   //!< In the string table
+    uint32_t length;
+};
+
+struct CacheFileHeader
+{
+    char            magic[8];
+    uint32_t        format_version;
+    uint32_t        num_bundles;
+    uint32_t        num_entries;
+    uint32_t        num_authors;
+    uint32_t        num_sectionconfigs;
+    uint32_t        strings_size;
+};
+
+struct CacheFileBundle
+{
+    CacheFileString path;
+    CacheFileString type;
+    uint64_t        size;
+    int64_t         mtime;
+    uint64_t        content_hash;
+};
+
+struct CacheFileAuthor
+{
+    int32_t         id;
+    CacheFileString type;
+    CacheFileString name;
+    CacheFileString email;
+};
+
+struct CacheFileEntry
+{
+    // Common details
+    int64_t         addtimestamp;
+    int64_t         filetime;
+    CacheFileString resource_bundle_type;
+    CacheFileString resource_bundle_path;
+    CacheFileString fpath;
+    CacheFileString fname;
+    CacheFileString fname_without_uid;
+    CacheFileString fext;
+    CacheFileString dname;
+    CacheFileString uniqueid;
+    CacheFileString guid;
+    CacheFileString filecachename;
+    int32_t         usagecounter;
+    int32_t         version;
+    int32_t         categoryid;
+    uint32_t        first_author;
+    uint32_t        num_authors;
+
+    // Vehicle details
+    CacheFileString description;
+    CacheFileString tags;
+    int32_t         fileformatversion;
+    int32_t         nodecount;
+    int32_t         beamcount;
+    int32_t         shockcount;
+    int32_t         fixescount;
+    int32_t         hydroscount;
+    int32_t         wheelcount;
+    int32_t         propwheelcount;
+    int32_t         commandscount;
+    int32_t         flarescount;
+    int32_t         propscount;
+    int32_t         wingscount;
+    int32_t         turbopropscount;
+    int32_t         turbojetcount;
+    int32_t         rotatorscount;
+    int32_t         exhaustscount;
+    int32_t         flexbodiescount;
+    int32_t         soundsourcescount;
+    float           truckmass;
+    float           loadmass;
+    float           minrpm;
+    float           maxrpm;
+    float           torque;
+    int32_t         driveable;
+    int32_t         numgears;
+    uint32_t        first_sectionconfig;
+    uint32_t        num_sectionconfigs;
+    uint8_t         hasSubmeshs;
+    uint8_t         customtach;
+    uint8_t         custom_particles;
+    uint8_t         forwardcommands;
+    uint8_t         importcommands;
+    uint8_t         rescuer;
+    char            enginetype;
+    uint8_t         padding;
+};
+
+static_assert(sizeof(CacheFileHeader) % 8 == 0 && sizeof(CacheFileBundle) % 8 == 0 && sizeof(CacheFileEntry) % 8 == 0,
+              "Records must stay aligned");
+
+/// Deduplicates strings; bundle paths and types repeat a lot.
+class CacheFileStringTable
+{
+public:
+    CacheFileString Add(std::string const& str)
+    {
+        auto itor = m_lookup.find(str);
+        if (itor != m_lookup.end())
+        {
+            return itor->second;
+        }
+        CacheFileString out;
+        out.offset = static_cast<uint32_t>(m_data.size());
+        out.length = static_cast<uint32_t>(str.size());
+        m_data.insert(m_data.end(), str.begin(), str.end());
+        m_lookup.insert(std::make_pair(str, out));
+        return out;
+    }
+
+    std::vector<char> const& GetData() const { return m_data; }
+
+private:
+    std::vector<char>                                m_data;
+    std::unordered_map<std::string, CacheFileString> m_lookup;
+};
+
+/// Reads a binary cache file in place, e.g. from a `MappedFile`.
+class CacheFileView
+{
+public:
+    /// @return False if the data isn't a complete cache file of the current format
+    bool Open(const char* data, size_t size)
+    {
+        if (size < sizeof(CacheFileHeader))
+            return false;
+
+        m_header = reinterpret_cast<const CacheFileHeader*>(data);
+        if (std::memcmp(m_header->magic, CACHE_FILE_MAGIC, sizeof(CACHE_FILE_MAGIC)) != 0 ||
+            m_header->format_version != CACHE_FILE_FORMAT)
+            return false;
+
+        const uint64_t bundles_pos        = sizeof(CacheFileHeader);
+        const uint64_t entries_pos        = bundles_pos + uint64_t(m_header->num_bundles) * sizeof(CacheFileBundle);
+        const uint64_t authors_pos        = entries_pos + uint64_t(m_header->num_entries) * sizeof(CacheFileEntry);
+        const uint64_t sectionconfigs_pos = authors_pos + uint64_t(m_header->num_authors) * sizeof(CacheFileAuthor);
+        const uint64_t strings_pos        = sectionconfigs_pos + uint64_t(m_header->num_sectionconfigs) * sizeof(CacheFileString);
+        if (strings_pos + m_header->strings_size != size)
+            return false;
+
+        m_bundles        = reinterpret_cast<const CacheFileBundle*>(data + bundles_pos);
+        m_entries        = reinterpret_cast<const CacheFileEntry*>(data + entries_pos);
+        m_authors        = reinterpret_cast<const CacheFileAuthor*>(data + authors_pos);
+        m_sectionconfigs = reinterpret_cast<const CacheFileString*>(data + sectionconfigs_pos);
+        m_strings        = data + strings_pos;
+
+        for (uint32_t i = 0; i < m_header->num_entries; i++)
+        {
+            const CacheFileEntry& entry = m_entries[i];
+            if (uint64_t(entry.first_author) + entry.num_authors > m_header->num_authors ||
+                uint64_t(entry.first_sectionconfig) + entry.num_sectionconfigs > m_header->num_sectionconfigs)
+                return false;
+        }
+        return true;
+    }
+
+    const CacheFileHeader& GetHeader() const                { return *m_header; }
+    const CacheFileBundle& GetBundle(uint32_t i) const      { return m_bundles[i]; }
+    const CacheFileEntry&  GetEntry(uint32_t i) const       { return m_entries[i]; }
+    const CacheFileAuthor& GetAuthor(uint32_t i) const      { return m_authors[i]; }
+    const CacheFileString& GetSectionConfig(uint32_t i) const { return m_sectionconfigs[i]; }
+
+    std::string GetString(CacheFileString const& str) const //!< Empty if out of range
+    {
+        if (str.offset > m_header->strings_size || str.length > m_header->strings_size - str.offset)
+            return std::string();
+        return std::string(m_strings + str.offset, str.length);
+    }
+
+private:
+    const CacheFileHeader* m_header = nullptr;
+    const CacheFileBundle* m_bundles = nullptr;
+    const CacheFileEntry*  m_entries = nullptr;
+    const CacheFileAuthor* m_authors = nullptr;
+    const CacheFileString* m_sectionconfigs = nullptr;
+    const char*            m_strings = nullptr;
+};
+
+std::string GetCacheFilePath()
+{
+    return PathCombine(App::sys_cache_dir->GetStr(), CACHE_FILE);
+}
+
+void ImportBundlesFromView(CacheFileView const& view, std::vector<CacheBundleInfo>& out_bundles)
+{
+    out_bundles.resize(view.GetHeader().num_bundles);
+    for (uint32_t i = 0; i < view.GetHeader().num_bundles; i++)
+    {
+        const CacheFileBundle& rec = view.GetBundle(i);
+        out_bundles[i].path =         view.GetString(rec.path);
+        out_bundles[i].type =         view.GetString(rec.type);
+        out_bundles[i].size =         rec.size;
+        out_bundles[i].mtime =        static_cast<std::time_t>(rec.mtime);
+        out_bundles[i].content_hash = rec.content_hash;
+    }
+}
+
+} // anonymous namespace
+
+bool CacheSystem::LoadBundleIndex(std::vector<CacheBundleInfo>& out_bundles)
+{
+    if (App::diag_cache_json->GetBool())
+    {
+        rapidjson::Document j_doc;
+        if (!App::GetContentManager()->LoadAndParseJson(CACHE_FILE_JSON, RGN_CACHE, j_doc))
+        {
+            RoR::Log("[RoR|ModCache] Invalid or missing cache file");
+            return false;
+        }
+
+        if (!j_doc.IsObject() || !j_doc.HasMember("format_version") || j_doc["format_version"].GetInt() != CACHE_FILE_FORMAT ||
+            !j_doc.HasMember("bundles") || !j_doc["bundles"].IsArray())
+        {
+            RoR::Log("[RoR|ModCache] Invalid cache file format");
+            return false;
+        }
+
+        ImportBundlesFromJson(j_doc["bundles"], out_bundles);
+        return true;
+    }
+
+    MappedFile file;
+    CacheFileView view;
+    if (!file.Open(GetCacheFilePath().c_str()))
+    {
+        RoR::Log("[RoR|ModCache] Invalid or missing cache file");
+        return false;
+    }
+
+    if (!view.Open(file.GetData(), file.GetSize()))
+    {
+        RoR::Log("[RoR|ModCache] Invalid cache file format");
+        return false;
+    }
+
+    ImportBundlesFromView(view, out_bundles);
+    return true;
+}
+
+void CacheSystem::WriteCacheFileBinary()
+{
+    CacheFileStringTable strings;
+    std::vector<CacheFileBundle> bundles;
+    std::vector<CacheFileEntry> entries;
+    std::vector<CacheFileAuthor> authors;
+    std::vector<CacheFileString> sectionconfigs;
+
+    for (CacheBundleInfo const& bundle : m_bundles)
+    {
+        CacheFileBundle rec = {};
+        rec.path =         strings.Add(bundle.path);
+        rec.type =         strings.Add(bundle.type);
+        rec.size =         bundle.size;
+        rec.mtime =        static_cast<int64_t>(bundle.mtime);
+        rec.content_hash = bundle.content_hash;
+        bundles.push_back(rec);
+    }
+
+    for (CacheEntry const& entry : m_entries)
+    {
+        if (entry.deleted)
+            continue;
+
+        CacheFileEntry rec = {}; // Zeroed padding, for reproducible files
+
+        // Common details
+        rec.addtimestamp =         static_cast<int64_t>(entry.addtimestamp);
+        rec.filetime =             static_cast<int64_t>(entry.filetime);
+        rec.resource_bundle_type = strings.Add(entry.resource_bundle_type);
+        rec.resource_bundle_path = strings.Add(entry.resource_bundle_path);
+        rec.fpath =                strings.Add(entry.fpath);
+        rec.fname =                strings.Add(entry.fname);
+        rec.fname_without_uid =    strings.Add(entry.fname_without_uid);
+        rec.fext =                 strings.Add(entry.fext);
+        rec.dname =                strings.Add(entry.dname);
+        rec.uniqueid =             strings.Add(entry.uniqueid);
+        rec.guid =                 strings.Add(entry.guid);
+        rec.filecachename =        strings.Add(entry.filecachename);
+        rec.usagecounter =         entry.usagecounter;
+        rec.version =              entry.version;
+        rec.categoryid =           entry.categoryid;
+
+        // Common - Authors
+        rec.first_author = static_cast<uint32_t>(authors.size());
+        rec.num_authors =  static_cast<uint32_t>(entry.authors.size());
+        for (AuthorInfo const& author: entry.authors)
+        {
+            CacheFileAuthor a = {};
+            a.id =    author.id;
+            a.type =  strings.Add(author.type);
+            a.name =  strings.Add(author.name);
+            a.email = strings.Add(author.email);
+            authors.push_back(a);
+        }
+
+        // Vehicle details
+        rec.description =       strings.Add(entry.description);
+        rec.tags =              strings.Add(entry.tags);
+        rec.fileformatversion = entry.fileformatversion;
+        rec.nodecount =         entry.nodecount;
+        rec.beamcount =         entry.beamcount;
+        rec.shockcount =        entry.shockcount;
+        rec.fixescount =        entry.fixescount;
+        rec.hydroscount =       entry.hydroscount;
+        rec.wheelcount =        entry.wheelcount;
+        rec.propwheelcount =    entry.propwheelcount;
+        rec.commandscount =     entry.commandscount;
+        rec.flarescount =       entry.flarescount;
+        rec.propscount =        entry.propscount;
+        rec.wingscount =        entry.wingscount;
+        rec.turbopropscount =   entry.turbopropscount;
+        rec.turbojetcount =     entry.turbojetcount;
+        rec.rotatorscount =     entry.rotatorscount;
+        rec.exhaustscount =     entry.exhaustscount;
+        rec.flexbodiescount =   entry.flexbodiescount;
+        rec.soundsourcescount = entry.soundsourcescount;
+        rec.truckmass =         entry.truckmass;
+        rec.loadmass =          entry.loadmass;
+        rec.minrpm =            entry.minrpm;
+        rec.maxrpm =            entry.maxrpm;
+        rec.torque =            entry.torque;
+        rec.hasSubmeshs =       entry.hasSubmeshs;
+        rec.customtach =        entry.customtach;
+        rec.custom_particles =  entry.custom_particles;
+        rec.forwardcommands =   entry.forwardcommands;
+        rec.importcommands =    entry.importcommands;
+        rec.rescuer =           entry.rescuer;
+        rec.driveable =         static_cast<int32_t>(entry.driveable);
+        rec.numgears =          entry.numgears;
+        rec.enginetype =        entry.enginetype;
+
+        // Vehicle 'section-configs' (aka Modules in RigDef namespace)
+        rec.first_sectionconfig = static_cast<uint32_t>(sectionconfigs.size());
+        rec.num_sectionconfigs =  static_cast<uint32_t>(entry.sectionconfigs.size());
+        for (Ogre::String const& module_name: entry.sectionconfigs)
+        {
+            sectionconfigs.push_back(strings.Add(module_name));
+        }
+
+        entries.push_back(rec);
+    }
+
+    CacheFileHeader header = {};
+    std::memcpy(header.magic, CACHE_FILE_MAGIC, sizeof(CACHE_FILE_MAGIC));
+    header.format_version =     CACHE_FILE_FORMAT;
+    header.num_bundles =        static_cast<uint32_t>(bundles.size());
+    header.num_entries =        static_cast<uint32_t>(entries.size());
+    header.num_authors =        static_cast<uint32_t>(authors.size());
+    header.num_sectionconfigs = static_cast<uint32_t>(sectionconfigs.size());
+    header.strings_size =       static_cast<uint32_t>(strings.GetData().size());
+
+    std::vector<char> buf;
+    auto append = [&buf](const void* data, size_t size)
+    {
+        buf.insert(buf.end(), static_cast<const char*>(data), static_cast<const char*>(data) + size);
+    };
+    append(&header, sizeof(header));
+    append(bundles.data(), bundles.size() * sizeof(CacheFileBundle));
+    append(entries.data(), entries.size() * sizeof(CacheFileEntry));
+    append(authors.data(), authors.size() * sizeof(CacheFileAuthor));
+    append(sectionconfigs.data(), sectionconfigs.size() * sizeof(CacheFileString));
+    append(strings.GetData().data(), strings.GetData().size());
+
+    // Written aside and renamed over the cache file, so a crash while writing leaves the previous cache intact
+    const std::string tmp_filename = std::string(CACHE_FILE) + ".tmp";
+    try
+    {
+        DataStreamPtr stream = ResourceGroupManager::getSingleton().createResource(tmp_filename, RGN_CACHE, /*overwrite=*/true);
+        size_t written = stream->write(buf.data(), buf.size());
+        stream->close();
+        if (written < buf.size())
+        {
+            RoR::LogFormat("[RoR|ModCache] Error writing file '%s', only written %u out of %u bytes!",
+                           tmp_filename.c_str(), static_cast<unsigned>(written), static_cast<unsigned>(buf.size()));
+            App::GetContentManager()->DeleteDiskFile(tmp_filename, RGN_CACHE);
+            return;
+        }
+    }
+    catch (std::exception& e)
+    {
+        RoR::LogFormat("[RoR|ModCache] Error writing file '%s', message: '%s'", tmp_filename.c_str(), e.what());
+        return;
+    }
+
+    if (!RoR::RenameFile(PathCombine(App::sys_cache_dir->GetStr(), tmp_filename), GetCacheFilePath()))
+    {
+        RoR::LogFormat("[RoR|ModCache] Error replacing file '%s' with '%s'", CACHE_FILE, tmp_filename.c_str());
+        App::GetContentManager()->DeleteDiskFile(tmp_filename, RGN_CACHE);
+        return;
+    }
+    RoR::LogFormat("[RoR|ModCache] File '%s' written OK", CACHE_FILE);
+}
+
+void CacheSystem::LoadCacheFileBinary()
+{
+    // Clear existing entries
+    m_entries.clear();
+    m_bundles.clear();
+    this->ClearIndex();
+
+    MappedFile file;
+    CacheFileView view;
+    if (!file.Open(GetCacheFilePath().c_str()) || !view.Open(file.GetData(), file.GetSize()))
     {
-        RoR::LogFormat("[RoR|ModCache] File '%s' written OK", CACHE_FILE);
+        RoR::Log("[RoR|ModCache] Error, cache file still invalid after check/update, content selector will be empty.");
+        return;
+    }
+
+    ImportBundlesFromView(view, m_bundles);
+
+    // Copied out of the mapping; it's closed once we return
+    m_entries.resize(view.GetHeader().num_entries);
+    for (uint32_t i = 0; i < view.GetHeader().num_entries; i++)
+    {
+        const CacheFileEntry& rec = view.GetEntry(i);
+        CacheEntry& entry = m_entries[i];
+
+        // Common details
+        entry.usagecounter =         rec.usagecounter;
+        entry.addtimestamp =         static_cast<std::time_t>(rec.addtimestamp);
+        entry.resource_bundle_type = view.GetString(rec.resource_bundle_type);
+        entry.resource_bundle_path = view.GetString(rec.resource_bundle_path);
+        entry.fpath =                view.GetString(rec.fpath);
+        entry.fname =                view.GetString(rec.fname);
+        entry.fname_without_uid =    view.GetString(rec.fname_without_uid);
+        entry.fext =                 view.GetString(rec.fext);
+        entry.filetime =             static_cast<std::time_t>(rec.filetime);
+        entry.dname =                view.GetString(rec.dname);
+        entry.uniqueid =             view.GetString(rec.uniqueid);
+        entry.version =              rec.version;
+        entry.filecachename =        view.GetString(rec.filecachename);
+        entry.guid =                 view.GetString(rec.guid);
+        Ogre::StringUtil::trim(entry.guid);
+        this->SetEntryCategory(entry, rec.categoryid);
+
+        // Common - Authors
+        entry.authors.resize(rec.num_authors);
+        for (uint32_t a = 0; a < rec.num_authors; a++)
+        {
+            const CacheFileAuthor& author = view.GetAuthor(rec.first_author + a);
+            entry.authors[a].type =  view.GetString(author.type);
+            entry.authors[a].name =  view.GetString(author.name);
+            entry.authors[a].email = view.GetString(author.email);
+            entry.authors[a].id =    author.id;
+        }
+
+        // Vehicle details
+        entry.description =       view.GetString(rec.description);
+        entry.tags =              view.GetString(rec.tags);
+        entry.fileformatversion = rec.fileformatversion;
+        entry.hasSubmeshs =       rec.hasSubmeshs != 0;
+        entry.nodecount =         rec.nodecount;
+        entry.beamcount =         rec.beamcount;
+        entry.shockcount =        rec.shockcount;
+        entry.fixescount =        rec.fixescount;
+        entry.hydroscount =       rec.hydroscount;
+        entry.wheelcount =        rec.wheelcount;
+        entry.propwheelcount =    rec.propwheelcount;
+        entry.commandscount =     rec.commandscount;
+        entry.flarescount =       rec.flarescount;
+        entry.propscount =        rec.propscount;
+        entry.wingscount =        rec.wingscount;
+        entry.turbopropscount =   rec.turbopropscount;
+        entry.turbojetcount =     rec.turbojetcount;
+        entry.rotatorscount =     rec.rotatorscount;
+        entry.exhaustscount =     rec.exhaustscount;
+        entry.flexbodiescount =   rec.flexbodiescount;
+        entry.soundsourcescount = rec.soundsourcescount;
+        entry.truckmass =         rec.truckmass;
+        entry.loadmass =          rec.loadmass;
+        entry.minrpm =            rec.minrpm;
+        entry.maxrpm =            rec.maxrpm;
+        entry.torque =            rec.torque;
+        entry.customtach =        rec.customtach != 0;
+        entry.custom_particles =  rec.custom_particles != 0;
+        entry.forwardcommands =   rec.forwardcommands != 0;
+        entry.importcommands =    rec.importcommands != 0;
+        entry.rescuer =           rec.rescuer != 0;
+        entry.driveable =         ActorType(rec.driveable);
+        entry.numgears =          rec.numgears;
+        entry.enginetype =        rec.enginetype;
+
+        // Vehicle 'section-configs' (aka Modules in RigDef namespace)
+        entry.sectionconfigs.resize(rec.num_sectionconfigs);
+        for (uint32_t s = 0; s < rec.num_sectionconfigs; s++)
+        {
+            entry.sectionconfigs[s] = view.GetString(view.GetSectionConfig(rec.first_sectionconfig + s));
+        }
+
+        entry.number = static_cast<int>(i + 1); // Let's number mods from 1
+        this->AddToIndex(i);
     }
 }
 
 void CacheSystem::ClearCache()
 {
     App::GetContentManager()->DeleteDiskFile(CACHE_FILE, RGN_CACHE);
+    if (App::diag_cache_json->GetBool())
+    {
+        App::GetContentManager()->DeleteDiskFile(CACHE_FILE_JSON, RGN_CACHE);
+    }
     for (auto& entry : m_entries)
     {
         String group = entry.resource_group;
@@ -583,6 +1423,8 @@ void CacheSystem::ClearCache()
         this->RemoveFileCache(entry);
     }
     m_entries.clear();
+    m_bundles.clear();
+    this->ClearIndex();
 }
 
 Ogre::String CacheSystem::StripUIDfromString(Ogre::String uidstr)
@@ -603,11 +1445,9 @@ Ogre::String CacheSystem::StripSHA1fromString(Ogre::String sha1str)
 
 void CacheSystem::AddFile(String group, Ogre::FileInfo f, String ext)
 {
-    String type = f.archive ? f.archive->getType() : "FileSystem";
     String path = f.archive ? f.archive->getName() : "";
 
-    if (std::find_if(m_entries.begin(), m_entries.end(), [&](CacheEntry& e)
-                { return !e.deleted && e.fname == f.filename && e.resource_bundle_path == path; }) != m_entries.end())
+    if (this->HasEntry(f.filename, path))
         return;
 
     RoR::LogFormat("[RoR|CacheSystem] Preparing to add file '%f'", f.filename.c_str());
@@ -618,61 +1458,13 @@ void CacheSystem::AddFile(String group, Ogre::FileInfo f, String ext)
         // ds closes automatically, so do _not_ close it explicitly below
 
         std::vector<CacheEntry> new_entries;
-        if (ext == "terrn2")
-        {
-            new_entries.resize(1);
-            FillTerrainDetailInfo(new_entries.back(), ds, f.filename);
-        }
-        else if (ext == "skin")
-        {
-            auto new_skins = RoR::SkinParser::ParseSkins(ds);
-            for (auto skin_def: new_skins)
-            {
-                CacheEntry entry;
-                if (!skin_def->author_name.empty())
-                {
-                    AuthorInfo a;
-                    a.id = skin_def->author_id;
-                    a.name = skin_def->author_name;
-                    entry.authors.push_back(a);
-                }
-
-                entry.dname       = skin_def->name;
-                entry.guid        = skin_def->guid;
-                entry.description = skin_def->description;
-                entry.categoryid  = -1;
-                entry.skin_def    = skin_def; // Needed to generate preview image
-
-                new_entries.push_back(entry);
-            }
-        }
-        else
-        {
-            new_entries.resize(1);
-            FillTruckDetailInfo(new_entries.back(), ds, f.filename, group);
-        }
-
+        this->ParseFile(new_entries, ds, f, ext, group);
         for (auto& entry: new_entries)
         {
-            Ogre::StringUtil::toLowerCase(entry.guid); // Important for comparsion
-            entry.fpath = f.path;
-            entry.fname = f.filename;
-            entry.fname_without_uid = StripUIDfromString(f.filename);
-            entry.fext = ext;
-            if (type == "Zip")
-            {
-                entry.filetime = RoR::GetFileLastModifiedTime(path);
-            }
-            else
-            {
-                entry.filetime = RoR::GetFileLastModifiedTime(PathCombine(path, f.filename));
-            }
-            entry.resource_bundle_type = type;
-            entry.resource_bundle_path = path;
             entry.number = static_cast<int>(m_entries.size() + 1); // Let's number mods from 1
-            entry.addtimestamp = m_update_time;
             this->GenerateFileCache(entry, group);
             m_entries.push_back(entry);
+            this->AddToIndex(m_entries.size() - 1);
         }
     }
     catch (Ogre::Exception& e)
@@ -682,7 +1474,79 @@ void CacheSystem::AddFile(String group, Ogre::FileInfo f, String ext)
     }
 }
 
-void CacheSystem::FillTruckDetailInfo(CacheEntry& entry, Ogre::DataStreamPtr stream, String file_name, String group)
+bool CacheSystem::HasEntry(std::string const& fname, std::string const& bundle_path) const
+{
+    String fname_lower = fname;
+    StringUtil::toLowerCase(fname_lower);
+    auto range = m_index_fname.equal_range(fname_lower);
+    return std::find_if(range.first, range.second, [&](std::pair<const std::string, size_t> const& item)
+                {
+                    CacheEntry const& e = m_entries[item.second];
+                    return !e.deleted && e.fname == fname && e.resource_bundle_path == bundle_path;
+                }) != range.second;
+}
+
+void CacheSystem::ParseFile(std::vector<CacheEntry>& new_entries, DataStreamPtr ds, Ogre::FileInfo const& f, String const& ext, String const& group) const
+{
+    String type = f.archive ? f.archive->getType() : "FileSystem";
+    String path = f.archive ? f.archive->getName() : "";
+
+    if (ext == "terrn2")
+    {
+        new_entries.resize(1);
+        FillTerrainDetailInfo(new_entries.back(), ds, f.filename);
+    }
+    else if (ext == "skin")
+    {
+        auto new_skins = RoR::SkinParser::ParseSkins(ds);
+        for (auto skin_def: new_skins)
+        {
+            CacheEntry entry;
+            if (!skin_def->author_name.empty())
+            {
+                AuthorInfo a;
+                a.id = skin_def->author_id;
+                a.name = skin_def->author_name;
+                entry.authors.push_back(a);
+            }
+
+            entry.dname       = skin_def->name;
+            entry.guid        = skin_def->guid;
+            entry.description = skin_def->description;
+            entry.categoryid  = -1;
+            entry.skin_def    = skin_def; // Needed to generate preview image
+
+            new_entries.push_back(entry);
+        }
+    }
+    else
+    {
+        new_entries.resize(1);
+        FillTruckDetailInfo(new_entries.back(), ds, f.filename, group);
+    }
+
+    for (auto& entry: new_entries)
+    {
+        Ogre::StringUtil::toLowerCase(entry.guid); // Important for comparsion
+        entry.fpath = f.path;
+        entry.fname = f.filename;
+        entry.fname_without_uid = StripUIDfromString(f.filename);
+        entry.fext = ext;
+        if (type == "Zip")
+        {
+            entry.filetime = RoR::GetFileLastModifiedTime(path);
+        }
+        else
+        {
+            entry.filetime = RoR::GetFileLastModifiedTime(PathCombine(path, f.filename));
+        }
+        entry.resource_bundle_type = type;
+        entry.resource_bundle_path = path;
+        entry.addtimestamp = m_update_time;
+    }
+}
+
+void CacheSystem::FillTruckDetailInfo(CacheEntry& entry, Ogre::DataStreamPtr stream, String file_name, String group) const
 {
     /* LOAD AND PARSE THE VEHICLE */
     RigDef::Parser parser;
@@ -865,18 +1729,38 @@ void CacheSystem::FillTruckDetailInfo(CacheEntry& entry, Ogre::DataStreamPtr str
     /* NOTE: std::shared_ptr cleans everything up. */
 }
 
-Ogre::String detectMiniType(String filename, String group)
+/// Finds the preview image of the entry in its bundle and names its copy in RGN_CACHE.
+/// @param exists Checks if the bundle contains a file
+/// @return False if there's no preview image
+static bool FindPreviewImage(CacheEntry const& entry, std::function<bool(String const&)> const& exists, String& out_src_path, String& out_dst_path)
 {
-    if (ResourceGroupManager::getSingleton().resourceExists(group, filename + "dds"))
-        return "dds";
-
-    if (ResourceGroupManager::getSingleton().resourceExists(group, filename + "png"))
-        return "png";
+    String bundle_basename, bundle_path;
+    StringUtil::splitFilename(entry.resource_bundle_path, bundle_basename, bundle_path);
 
-    if (ResourceGroupManager::getSingleton().resourceExists(group, filename + "jpg"))
-        return "jpg";
+    if (entry.fext == "skin")
+    {
+        if (entry.skin_def->thumbnail.empty())
+            return false;
+        out_src_path = entry.skin_def->thumbnail;
+        String mini_fbase, minitype;
+        StringUtil::splitBaseFilename(entry.skin_def->thumbnail, mini_fbase, minitype);
+        out_dst_path = bundle_basename + "_" + mini_fbase + ".mini." + minitype;
+        return true;
+    }
 
-    return "";
+    String fbase, fext;
+    StringUtil::splitBaseFilename(entry.fname, fbase, fext);
+    String minifn = fbase + "-mini.";
+    for (const char* minitype: {"dds", "png", "jpg"})
+    {
+        if (exists(minifn + minitype))
+        {
+            out_src_path = minifn + minitype;
+            out_dst_path = bundle_basename + "_" + entry.fname + ".mini." + minitype;
+            return true;
+        }
+    }
+    return false;
 }
 
 void CacheSystem::RemoveFileCache(CacheEntry& entry)
@@ -892,31 +1776,11 @@ void CacheSystem::GenerateFileCache(CacheEntry& entry, String group)
     if (entry.fname.empty())
         return;
 
-    String bundle_basename, bundle_path;
-    StringUtil::splitFilename(entry.resource_bundle_path, bundle_basename, bundle_path);
-
     String src_path;
     String dst_path;
-    if (entry.fext == "skin")
-    {
-        if (entry.skin_def->thumbnail.empty())
-            return;
-        src_path = entry.skin_def->thumbnail;
-        String mini_fbase, minitype;
-        StringUtil::splitBaseFilename(entry.skin_def->thumbnail, mini_fbase, minitype);
-        dst_path = bundle_basename + "_" + mini_fbase + ".mini." + minitype;
-    }
-    else
-    {
-        String fbase, fext;
-        StringUtil::splitBaseFilename(entry.fname, fbase, fext);
-        String minifn = fbase + "-mini.";
-        String minitype = detectMiniType(minifn, group);
-        if (minitype.empty())
-            return;
-        src_path = minifn + minitype;
-        dst_path = bundle_basename + "_" + entry.fname + ".mini." + minitype;
-    }
+    auto exists = [&group](String const& filename) { return ResourceGroupManager::getSingleton().resourceExists(group, filename); };
+    if (!FindPreviewImage(entry, exists, src_path, dst_path))
+        return;
 
     try
     {
@@ -945,43 +1809,153 @@ void CacheSystem::ParseZipArchives(String group)
     for (const auto& skinzip : *skinzips)
         files->push_back(skinzip);
 
-    int i = 0, count = static_cast<int>(files->size());
+    std::vector<String> paths;
+    std::unordered_set<String> listed;
     for (const auto& file : *files)
     {
-        int progress = ((float)i++ / (float)count) * 100;
+        String path = PathCombine(file.archive->getName(), file.filename);
+        if (m_resource_paths.find(path) == m_resource_paths.end() &&
+            listed.insert(path).second)
+        {
+            paths.push_back(path);
+        }
+    }
+
+    // Scan the archives on the thread pool; the main thread keeps the loading window alive meanwhile
+    const int count = static_cast<int>(paths.size());
+    std::vector<ZipScanResult> results(paths.size());
+    std::vector<std::shared_ptr<Task>> tasks;
+    std::atomic<int> num_done(0);
+    for (int i = 0; i < count; i++)
+    {
+        tasks.push_back(App::GetThreadPool()->RunTask([this, &paths, &results, &num_done, i]()
+        {
+            this->ScanZipArchive(paths[i], results[i]);
+            num_done++;
+        }));
+    }
+
+    for (int done = num_done.load(); done < count; done = num_done.load())
+    {
+        int progress = ((float)done / (float)count) * 100;
         UTFString tmp = _L("Loading zips in group ") + ANSI_TO_UTF(group) + L"\n" +
-            ANSI_TO_UTF(file.filename) + L"\n" + ANSI_TO_UTF(TOSTRING(i)) + L"/" + ANSI_TO_UTF(TOSTRING(count));
+            ANSI_TO_UTF(TOSTRING(done)) + L"/" + ANSI_TO_UTF(TOSTRING(count));
         RoR::App::GetGuiManager()->GetLoadingWindow()->SetProgress(progress, tmp);
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
 
-        String path = PathCombine(file.archive->getName(), file.filename);
-        this->ParseSingleZip(path);
+    // Merge in the order of enumeration, so mod numbers don't depend on thread timing
+    for (int i = 0; i < count; i++)
+    {
+        tasks[i]->join();
+        this->MergeZipScanResult(paths[i], results[i]);
     }
 
     RoR::App::GetGuiManager()->SetVisible_LoadingWindow(false);
     App::GetGuiManager()->GetMainMenu()->CacheUpdatedNotice();
 }
 
-void CacheSystem::ParseSingleZip(String path)
+void CacheSystem::ScanZipArchive(std::string const& path, ZipScanResult& out) const
 {
-    if (std::find(m_resource_paths.begin(), m_resource_paths.end(), path) == m_resource_paths.end())
+    // The parsers log and put console messages directly; hold them back until the merge
+    struct OutputCapture
+    {
+        OutputCapture(ZipScanResult& out) { RoR::SetLogCapture(&out.log); Console::SetMessageCapture(&out.messages); }
+        ~OutputCapture()                  { RoR::SetLogCapture(nullptr);  Console::SetMessageCapture(nullptr); }
+    } capture(out);
+
+    try
     {
-        RoR::LogFormat("[RoR|ModCache] Adding archive '%s'", path.c_str());
-        ResourceGroupManager::getSingleton().createResourceGroup(RGN_TEMP, false);
-        try
+        // A resource group can't be used here: OGRE's resource group manager isn't thread-safe
+        Ogre::ZipArchive archive(path, "Zip");
+        archive.load();
+
+        auto exists = [&archive](String const& filename) { return archive.exists(filename); };
+        for (auto ext : m_known_extensions)
         {
-            ResourceGroupManager::getSingleton().addResourceLocation(path, "Zip", RGN_TEMP);
-            if (ParseKnownFiles(RGN_TEMP))
+            auto files = archive.findFileInfo("*." + ext, false);
+            for (const auto& file : *files)
             {
-                LOG("No usable content in: '" + path + "'");
+                out.empty = false;
+                if (this->HasEntry(file.filename, path))
+                    continue;
+
+                out.log.push_back(fmt::format("[RoR|CacheSystem] Preparing to add file '{}'", file.filename));
+                std::vector<CacheEntry> new_entries;
+                try
+                {
+                    this->ParseFile(new_entries, archive.open(file.filename), file, ext, /*group:*/"");
+                }
+                catch (Ogre::Exception& e)
+                {
+                    out.log.push_back(fmt::format("[RoR|CacheSystem] Error processing file '{}', message :{}",
+                        file.filename, e.getFullDescription()));
+                    continue;
+                }
+
+                for (CacheEntry& entry: new_entries)
+                {
+                    ZipScanResult::Item item;
+                    String src_path;
+                    if (FindPreviewImage(entry, exists, src_path, item.thumbnail_name))
+                    {
+                        try
+                        {
+                            DataStreamPtr src_ds = archive.open(src_path);
+                            item.thumbnail_data.resize(src_ds->size());
+                            item.thumbnail_data.resize(src_ds->read(item.thumbnail_data.data(), item.thumbnail_data.size()));
+                        }
+                        catch (Ogre::Exception& e)
+                        {
+                            out.log.push_back("error while generating file cache: " + e.getFullDescription());
+                            item.thumbnail_data.clear();
+                        }
+                    }
+                    item.entry = entry;
+                    out.items.push_back(item);
+                }
             }
         }
-        catch (Ogre::Exception& e)
+    }
+    catch (Ogre::Exception& e)
+    {
+        out.log.push_back("Error while opening archive: '" + path + "': " + e.getFullDescription());
+    }
+}
+
+void CacheSystem::MergeZipScanResult(std::string const& path, ZipScanResult& result)
+{
+    RoR::LogFormat("[RoR|ModCache] Adding archive '%s'", path.c_str());
+    for (std::string const& line: result.log)
+    {
+        LOG(line);
+    }
+    App::GetConsole()->PutCapturedMessages(result.messages);
+    if (result.empty)
+    {
+        LOG("No usable content in: '" + path + "'");
+    }
+
+    for (ZipScanResult::Item& item: result.items)
+    {
+        item.entry.number = static_cast<int>(m_entries.size() + 1); // Let's number mods from 1
+        if (!item.thumbnail_data.empty())
         {
-            LOG("Error while opening archive: '" + path + "': " + e.getFullDescription());
+            try
+            {
+                DataStreamPtr dst_ds = ResourceGroupManager::getSingleton().createResource(item.thumbnail_name, RGN_CACHE, true);
+                dst_ds->write(item.thumbnail_data.data(), item.thumbnail_data.size());
+                item.entry.filecachename = item.thumbnail_name;
+            }
+            catch (Ogre::Exception& e)
+            {
+                LOG("error while generating file cache: " + e.getFullDescription());
+            }
         }
-        ResourceGroupManager::getSingleton().destroyResourceGroup(RGN_TEMP);
-        m_resource_paths.insert(path);
+        m_entries.push_back(item.entry);
+        this->AddToIndex(m_entries.size() - 1);
     }
+    m_resource_paths.insert(path);
 }
 
 bool CacheSystem::ParseKnownFiles(Ogre::String group)
@@ -999,13 +1973,7 @@ bool CacheSystem::ParseKnownFiles(Ogre::String group)
     return empty;
 }
 
-void CacheSystem::GenerateHashFromFilenames()
-{
-    std::string filenames = App::GetContentManager()->ListAllUserContent();
-    m_filenames_hash = HashData(filenames.c_str(), static_cast<int>(filenames.size()));
-}
-
-void CacheSystem::FillTerrainDetailInfo(CacheEntry& entry, Ogre::DataStreamPtr ds, Ogre::String fname)
+void CacheSystem::FillTerrainDetailInfo(CacheEntry& entry, Ogre::DataStreamPtr ds, Ogre::String fname) const
 {
     Terrn2Def def;
     Terrn2Parser parser;
@@ -1043,22 +2011,16 @@ bool CacheSystem::CheckResourceLoaded(Ogre::String & filename, Ogre::String& gro
             return true;
         }
 
-        for (auto& entry : m_entries)
+        // case insensitive comparison
+        StringUtil::toLowerCase(filename);
+        CacheEntry* entry = this->FindEntryByLowercaseFilename(filename, LT_None, /*match_type=*/false);
+        if (entry)
         {
-            // case insensitive comparison
-            String fname = entry.fname;
-            String fname_without_uid = entry.fname_without_uid;
-            StringUtil::toLowerCase(fname);
-            StringUtil::toLowerCase(filename);
-            StringUtil::toLowerCase(fname_without_uid);
-            if (fname == filename || fname_without_uid == filename)
-            {
-                // we found the file, load it
-                LoadResource(entry);
-                filename = entry.fname;
-                group = entry.resource_group;
-                return !group.empty() && ResourceGroupManager::getSingleton().resourceExists(group, filename);
-            }
+            // we found the file, load it
+            LoadResource(*entry);
+            filename = entry->fname;
+            group = entry->resource_group;
+            return !group.empty() && ResourceGroupManager::getSingleton().resourceExists(group, filename);
         }
     }
     catch (Ogre::Exception) {} // Already logged by OGRE
@@ -1165,11 +2127,16 @@ void CacheSystem::UnLoadResource(CacheEntry& t)
 
 CacheEntry* CacheSystem::FetchSkinByName(std::string const & skin_name)
 {
-    for (CacheEntry & entry: m_entries)
+    auto found = m_index_ext.find("skin");
+    if (found == m_index_ext.end())
     {
-        if (entry.dname == skin_name && entry.fext == "skin")
+        return nullptr;
+    }
+    for (size_t pos: found->second.entries)
+    {
+        if (m_entries[pos].dname == skin_name)
         {
-            return &entry;
+            return &m_entries[pos];
         }
     }
     return nullptr;
@@ -1219,45 +2186,185 @@ std::shared_ptr<SkinDef> CacheSystem::FetchSkinDef(CacheEntry* cache_entry)
     }
 }
 
+// -------------------------- Index --------------------------
+
+void CacheSystem::AddToIndex(size_t pos)
+{
+    CacheEntry& entry = m_entries[pos];
+    entry.fname_lower = entry.fname;
+    entry.fname_without_uid_lower = entry.fname_without_uid;
+    entry.dname_lower = entry.dname;
+    entry.description_lower = entry.description;
+    entry.guid_lower = entry.guid;
+    StringUtil::toLowerCase(entry.fname_lower);
+    StringUtil::toLowerCase(entry.fname_without_uid_lower);
+    StringUtil::toLowerCase(entry.dname_lower);
+    StringUtil::toLowerCase(entry.description_lower);
+    StringUtil::toLowerCase(entry.guid_lower);
+    for (AuthorInfo& author: entry.authors)
+    {
+        author.name_lower = author.name;
+        author.email_lower = author.email;
+        StringUtil::toLowerCase(author.name_lower);
+        StringUtil::toLowerCase(author.email_lower);
+    }
+
+    m_index_fname.emplace(entry.fname_lower, pos);
+    if (entry.fname_without_uid_lower != entry.fname_lower)
+    {
+        m_index_fname.emplace(entry.fname_without_uid_lower, pos);
+    }
+    if (!entry.guid.empty())
+    {
+        m_index_guid.emplace(entry.guid, pos);
+    }
+
+    IndexBucket& bucket = m_index_ext[entry.fext];
+    bucket.entries.push_back(pos);
+    bucket.category_usage[entry.categoryid]++;
+
+    // Positions only grow, so the lists stay sorted
+    std::vector<uint32_t> trigrams;
+    CollectTrigrams(entry.dname_lower, trigrams);
+    CollectTrigrams(entry.fname_lower, trigrams);
+    CollectTrigrams(entry.description_lower, trigrams);
+    for (AuthorInfo const& author: entry.authors)
+    {
+        CollectTrigrams(author.name_lower, trigrams);
+        CollectTrigrams(author.email_lower, trigrams);
+    }
+    SortUnique(trigrams);
+    for (uint32_t trigram: trigrams)
+    {
+        m_index_trigrams[trigram].push_back(pos);
+    }
+}
+
+void CacheSystem::ClearIndex()
+{
+    m_index_fname.clear();
+    m_index_guid.clear();
+    m_index_ext.clear();
+    m_index_trigrams.clear();
+}
+
+CacheEntry* CacheSystem::FindEntryByLowercaseFilename(std::string const& filename, LoaderType type, bool match_type)
+{
+    size_t first = std::numeric_limits<size_t>::max();
+    auto range = m_index_fname.equal_range(filename);
+    for (auto itor = range.first; itor != range.second; ++itor)
+    {
+        if (!match_type || IsTerrainFilterMatched(m_entries[itor->second], type))
+        {
+            first = std::min(first, itor->second);
+        }
+    }
+    return (first < m_entries.size()) ? &m_entries[first] : nullptr;
+}
+
+bool CacheSystem::FindTrigramCandidates(std::string const& lowercase_str, std::vector<size_t>& out_positions) const
+{
+    std::vector<uint32_t> trigrams;
+    CollectTrigrams(lowercase_str, trigrams);
+    if (trigrams.empty())
+    {
+        return false;
+    }
+    SortUnique(trigrams);
+
+    // An entry can only contain the string if it has all its trigrams; intersect the lists, shortest first
+    std::vector<const std::vector<size_t>*> lists;
+    for (uint32_t trigram: trigrams)
+    {
+        auto found = m_index_trigrams.find(trigram);
+        if (found == m_index_trigrams.end())
+        {
+            out_positions.clear();
+            return true;
+        }
+        lists.push_back(&found->second);
+    }
+    std::sort(lists.begin(), lists.end(),
+        [](const std::vector<size_t>* a, const std::vector<size_t>* b) { return a->size() < b->size(); });
+
+    out_positions = *lists[0];
+    std::vector<size_t> intersection;
+    for (size_t i = 1; i < lists.size() && !out_positions.empty(); i++)
+    {
+        intersection.clear();
+        std::set_intersection(out_positions.begin(), out_positions.end(),
+            lists[i]->begin(), lists[i]->end(), std::back_inserter(intersection));
+        out_positions.swap(intersection);
+    }
+    return true;
+}
+
 size_t CacheSystem::Query(CacheQuery& query)
 {
     Ogre::StringUtil::toLowerCase(query.cqy_search_string);
-    for (CacheEntry& entry: m_entries)
+
+    // Entries to check: by GUID, by the trigram index, or whole type buckets
+    std::vector<size_t> positions;
+    bool filter_type = true;
+    const bool search_indexed =
+        query.cqy_search_method == CacheSearchMethod::FULLTEXT ||
+        query.cqy_search_method == CacheSearchMethod::AUTHORS ||
+        query.cqy_search_method == CacheSearchMethod::FILENAME;
+    if (!query.cqy_filter_guid.empty())
+    {
+        auto range = m_index_guid.equal_range(query.cqy_filter_guid);
+        for (auto itor = range.first; itor != range.second; ++itor)
+        {
+            positions.push_back(itor->second);
+        }
+        std::sort(positions.begin(), positions.end());
+    }
+    else if (!search_indexed || !this->FindTrigramCandidates(query.cqy_search_string, positions))
     {
-        // Filter by GUID
-        if (!query.cqy_filter_guid.empty() && entry.guid != query.cqy_filter_guid)
+        for (auto& ext_bucket: m_index_ext)
         {
-            continue;
+            if (IsExtensionOfType(ext_bucket.first, query.cqy_filter_type))
+            {
+                positions.insert(positions.end(), ext_bucket.second.entries.begin(), ext_bucket.second.entries.end());
+            }
         }
+        filter_type = false;
+    }
 
-        // Filter by entry type
-        bool add = false;
-        if (entry.fext == "terrn2")
-            add = (query.cqy_filter_type == LT_Terrain);
-        if (entry.fext == "skin")
-            add = (query.cqy_filter_type == LT_Skin);
-        else if (entry.fext == "truck")
-            add = (query.cqy_filter_type == LT_AllBeam || query.cqy_filter_type == LT_Vehicle || query.cqy_filter_type == LT_Truck);
-        else if (entry.fext == "car")
-            add = (query.cqy_filter_type == LT_AllBeam || query.cqy_filter_type == LT_Vehicle || query.cqy_filter_type == LT_Truck || query.cqy_filter_type == LT_Car);
-        else if (entry.fext == "boat")
-            add = (query.cqy_filter_type == LT_AllBeam || query.cqy_filter_type == LT_Boat);
-        else if (entry.fext == "airplane")
-            add = (query.cqy_filter_type == LT_AllBeam || query.cqy_filter_type == LT_Airplane);
-        else if (entry.fext == "trailer")
-            add = (query.cqy_filter_type == LT_AllBeam || query.cqy_filter_type == LT_Trailer || query.cqy_filter_type == LT_Extension);
-        else if (entry.fext == "train")
-            add = (query.cqy_filter_type == LT_AllBeam || query.cqy_filter_type == LT_Train);
-        else if (entry.fext == "load")
-            add = (query.cqy_filter_type == LT_AllBeam || query.cqy_filter_type == LT_Load || query.cqy_filter_type == LT_Extension);
-
-        if (!add)
+    if (filter_type)
+    {
+        positions.erase(std::remove_if(positions.begin(), positions.end(),
+            [&](size_t pos) { return !IsExtensionOfType(m_entries[pos].fext, query.cqy_filter_type); }),
+            positions.end());
+    }
+
+    // Total usage per category; ignores search and category filter
+    if (!query.cqy_filter_guid.empty())
+    {
+        for (size_t pos: positions)
         {
-            continue;
+            query.cqy_res_category_usage[m_entries[pos].categoryid]++;
+            query.cqy_res_category_usage[CacheCategoryId::CID_All]++;
         }
+    }
+    else
+    {
+        for (auto& ext_bucket: m_index_ext)
+        {
+            if (IsExtensionOfType(ext_bucket.first, query.cqy_filter_type))
+            {
+                for (auto& usage: ext_bucket.second.category_usage)
+                {
+                    query.cqy_res_category_usage[usage.first] += usage.second;
+                }
+                query.cqy_res_category_usage[CacheCategoryId::CID_All] += ext_bucket.second.entries.size();
+            }
+        }
+    }
 
-        query.cqy_res_category_usage[entry.categoryid]++;
-        query.cqy_res_category_usage[CacheCategoryId::CID_All]++;
+    for (size_t pos: positions)
+    {
+        CacheEntry& entry = m_entries[pos];
 
         // Filter by category
         if (query.cqy_filter_category_id < CacheCategoryId::CID_Max &&
@@ -1273,25 +2380,25 @@ size_t CacheSystem::Query(CacheQuery& query)
         switch (query.cqy_search_method)
         {
         case CacheSearchMethod::FULLTEXT:
-            if (match = this->Match(score, entry.dname,       query.cqy_search_string, 0))   { break; }
-            if (match = this->Match(score, entry.fname,       query.cqy_search_string, 100)) { break; }
-            if (match = this->Match(score, entry.description, query.cqy_search_string, 200)) { break; }
+            if (match = this->Match(score, entry.dname_lower,       query.cqy_search_string, 0))   { break; }
+            if (match = this->Match(score, entry.fname_lower,       query.cqy_search_string, 100)) { break; }
+            if (match = this->Match(score, entry.description_lower, query.cqy_search_string, 200)) { break; }
             for (AuthorInfo const& author: entry.authors)
             {
-                if (match = this->Match(score, author.name,  query.cqy_search_string, 300)) { break; }
-                if (match = this->Match(score, author.email, query.cqy_search_string, 400)) { break; }
+                if (match = this->Match(score, author.name_lower,  query.cqy_search_string, 300)) { break; }
+                if (match = this->Match(score, author.email_lower, query.cqy_search_string, 400)) { break; }
             }
             break;
 
         case CacheSearchMethod::GUID:
-            match = this->Match(score, entry.guid, query.cqy_search_string, 0);
+            match = this->Match(score, entry.guid_lower, query.cqy_search_string, 0);
             break;
 
         case CacheSearchMethod::AUTHORS:
             for (AuthorInfo const& author: entry.authors)
             {
-                if (match = this->Match(score, author.name,  query.cqy_search_string, 0)) { break; }
-                if (match = this->Match(score, author.email, query.cqy_search_string, 0)) { break; }
+                if (match = this->Match(score, author.name_lower,  query.cqy_search_string, 0)) { break; }
+                if (match = this->Match(score, author.email_lower, query.cqy_search_string, 0)) { break; }
             }
             break;
 
@@ -1301,7 +2408,7 @@ size_t CacheSystem::Query(CacheQuery& query)
             break;
 
         case CacheSearchMethod::FILENAME:
-            match = this->Match(score, entry.fname, query.cqy_search_string, 100);
+            match = this->Match(score, entry.fname_lower, query.cqy_search_string, 100);
             break;
 
         default: // CacheSearchMethod::NONE
@@ -1320,9 +2427,8 @@ size_t CacheSystem::Query(CacheQuery& query)
     return query.cqy_results.size();
 }
 
-bool CacheSystem::Match(size_t& out_score, std::string data, std::string const& query, size_t score)
+bool CacheSystem::Match(size_t& out_score, std::string const& data, std::string const& query, size_t score)
 {
-    Ogre::StringUtil::toLowerCase(data);
     size_t pos = data.find(query);
     if (pos != std::string::npos)
     {
@@ -1339,11 +2445,7 @@ bool CacheQueryResult::operator<(CacheQueryResult const& other)
 {
     if (cqr_score == other.cqr_score)
     {
-        Ogre::String first = this->cqr_entry->dname;
-        Ogre::String second = other.cqr_entry->dname;
-        Ogre::StringUtil::toLowerCase(first);
-        Ogre::StringUtil::toLowerCase(second);
-        return first < second;
+        return this->cqr_entry->dname_lower < other.cqr_entry->dname_lower;
     }
 
     return cqr_score < other.cqr_score;
@@ -27,6 +27,7 @@
 #pragma once
 
 #include "Application.h"
+#include "Console.h"
 #include "Language.h"
 #include "RigDef_File.h"
 #include "SimData.h"
@@ -34,9 +35,11 @@
 #include <Ogre.h>
 #include <rapidjson/document.h>
 #include <string>
+#include <unordered_map>
 
 #define CACHE_FILE "mods.cache"
-#define CACHE_FILE_FORMAT 11
+#define CACHE_FILE_JSON "mods.cache.json" // Debug alternative, see `App::diag_cache_json`
+#define CACHE_FILE_FORMAT 13
 
 namespace RoR {
 
@@ -46,6 +49,8 @@ struct AuthorInfo
     Ogre::String type;
     Ogre::String name;
     Ogre::String email;
+    Ogre::String name_lower;            //!< For searching, filled by `CacheSystem::AddToIndex()`
+    Ogre::String email_lower;           //!< For searching, filled by `CacheSystem::AddToIndex()`
 };
 
 class CacheEntry
@@ -122,6 +127,13 @@ public:
     int numgears;
     char enginetype;
     std::vector<Ogre::String> sectionconfigs;
+
+    // Lowercase copies for case-insensitive lookups, filled by `CacheSystem::AddToIndex()`
+    Ogre::String fname_lower;
+    Ogre::String fname_without_uid_lower;
+    Ogre::String dname_lower;
+    Ogre::String description_lower;
+    Ogre::String guid_lower;
 };
 
 enum CacheCategoryId
@@ -169,6 +181,29 @@ struct CacheQuery
     std::time_t                    cqy_res_last_update = std::time_t();
 };
 
+/// A file which provides cache entries: ZIP archive, or a loose file in a directory.
+/// The cache keeps an index of them to detect what changed since it was written.
+struct CacheBundleInfo
+{
+    std::string  path;              //!< Like `CacheEntry::resource_bundle_path`, plus filename for loose files
+    std::string  type;              //!< Like `CacheEntry::resource_bundle_type`
+    uint64_t     size = 0;
+    std::time_t  mtime = 0;
+    uint64_t     content_hash = 0;  //!< ZIP: central directory (names, sizes and CRCs of all files); loose file: whole file
+};
+
+/// Result of comparing the bundle index with the files on disk, see `CacheSystem::ScanBundles()`.
+struct CacheChangeReport
+{
+    std::vector<std::string> added;
+    std::vector<std::string> removed;
+    std::vector<std::string> modified;
+    std::vector<std::string> touched;   //!< New time or size, but same content; needs no parsing
+    size_t                   num_unchanged = 0;
+
+    bool HasChanges() const { return !added.empty() || !removed.empty() || !modified.empty() || !touched.empty(); }
+};
+
 enum class CacheValidity
 {
     UNKNOWN,
@@ -182,7 +217,9 @@ enum class CacheValidity
 ///    RoR users usually have A LOT of content installed. Traversing it all on every game startup would be a pain.
 /// HOW IT WORKS:
 ///    For each recognized resource type (vehicle, terrain, skin...) an instance of 'CacheEntry' is created.
-///       These entries are persisted in file CACHE_FILE (see above)
+///       These entries are persisted in file CACHE_FILE (see above); binary. The validity check reads the mapped file in place,
+///       loading decodes every record into a `CacheEntry` (strings included), which is what the rest of the game works with.
+///       With `App::diag_cache_json`, they're also written to CACHE_FILE_JSON and loaded from there.
 ///    Associated media live in a "resource bundle" (ZIP archive or subdirectory) in content directory (ROR_HOME/mods) and subdirectories.
 ///       If multiple CacheEntries share a bundle, the bundle is loaded only once. Each bundle has dedicated OGRE resource group.
 class CacheSystem : public ZeroedMemoryAllocator
@@ -215,38 +252,87 @@ public:
 
 private:
 
+    void WriteCacheFile();
+    void LoadCacheFile();
+    bool LoadBundleIndex(std::vector<CacheBundleInfo>& out_bundles); //!< Only the index, without the entries; false if the file is missing or invalid
+    void WriteCacheFileBinary();
+    void LoadCacheFileBinary();
     void WriteCacheFileJson();
     void ExportEntryToJson(rapidjson::Value& j_entries, rapidjson::Document& j_doc, CacheEntry const & entry);
     void LoadCacheFileJson();
     void ImportEntryFromJson(rapidjson::Value& j_entry, CacheEntry & out_entry);
+    void SetEntryCategory(CacheEntry& entry, int category_id) const; //!< Unknown categories become 'Unsorted'
 
     static Ogre::String StripUIDfromString(Ogre::String uidstr); 
     static Ogre::String StripSHA1fromString(Ogre::String sha1str);
 
-    void ParseZipArchives(Ogre::String group);
+    /// Output of `ScanZipArchive()`; filled on a worker thread, merged into the cache on the main thread.
+    struct ZipScanResult
+    {
+        struct Item
+        {
+            CacheEntry        entry;
+            std::string       thumbnail_name;   //!< Destination in RGN_CACHE, empty if there's no preview image
+            std::vector<char> thumbnail_data;
+        };
+
+        std::vector<Item>        items;
+        std::vector<std::string> log;           //!< Written on merge, so the log doesn't interleave; includes the parsers' lines
+        std::vector<Console::Message> messages; //!< Console messages of the parsers, put on merge
+        bool                     empty = true;  //!< No known files found
+    };
+
+    void ParseZipArchives(Ogre::String group); //!< Scans the archives in parallel, see `ScanZipArchive()`
     bool ParseKnownFiles(Ogre::String group); // returns true if no known files are found
-    void ParseSingleZip(Ogre::String path);
+    void ScanZipArchive(std::string const& path, ZipScanResult& out) const; //!< Thread-safe; opens the archive with its own reader, without a resource group
+    void MergeZipScanResult(std::string const& path, ZipScanResult& result);
 
     void ClearCache(); // removes                   all files from the cache
     void PruneCache(); // removes modified (or deleted) files from the cache
 
+    /// Lists the bundles in RGN_CONTENT and compares them with the index, which is then updated.
+    /// Content hashes are only computed for bundles which are new or have a different size or time.
+    CacheChangeReport ScanBundles(std::vector<CacheBundleInfo>& in_out_bundles) const;
+    void LogChangeReport(CacheChangeReport const& report);
+
     void AddFile(Ogre::String group, Ogre::FileInfo f, Ogre::String ext);
+    bool HasEntry(std::string const& fname, std::string const& bundle_path) const;
+    void ParseFile(std::vector<CacheEntry>& out_entries, Ogre::DataStreamPtr ds, Ogre::FileInfo const& f, Ogre::String const& ext, Ogre::String const& group) const; //!< Thread-safe
 
     void DetectDuplicates();
 
-    void FillTerrainDetailInfo(CacheEntry &entry, Ogre::DataStreamPtr ds, Ogre::String fname);
-    void FillTruckDetailInfo(CacheEntry &entry, Ogre::DataStreamPtr ds, Ogre::String fname, Ogre::String group);
+    /// Type bucket of the index: all entries with one file extension.
+    struct IndexBucket
+    {
+        std::vector<size_t>      entries;
+        std::map<int, size_t>    category_usage;
+    };
+
+    void AddToIndex(size_t pos); //!< Fills the lowercase fields of the entry and adds it to the lookup tables; call in order of positions
+    void ClearIndex();
+    CacheEntry* FindEntryByLowercaseFilename(std::string const& filename, LoaderType type, bool match_type); //!< Exact match of `fname` or `fname_without_uid`; first entry wins
+    bool FindTrigramCandidates(std::string const& lowercase_str, std::vector<size_t>& out_positions) const; //!< Sorted; false if the string is too short to use the index
 
-    void GenerateHashFromFilenames();         //!< For quick detection of added/removed content
+    void FillTerrainDetailInfo(CacheEntry &entry, Ogre::DataStreamPtr ds, Ogre::String fname) const;
+    void FillTruckDetailInfo(CacheEntry &entry, Ogre::DataStreamPtr ds, Ogre::String fname, Ogre::String group) const; //!< Empty group = don't look up textures
 
     void GenerateFileCache(CacheEntry &entry, Ogre::String group);
     void RemoveFileCache(CacheEntry &entry);
 
-    bool Match(size_t& out_score, std::string data, std::string const& query, size_t );
+    bool Match(size_t& out_score, std::string const& data, std::string const& query, size_t ); //!< Both strings lowercase
 
     std::time_t                          m_update_time;      //!< Ensures that all inserted files share the same timestamp
-    std::string                          m_filenames_hash;   //!< stores hash over the content, for quick update detection
     std::vector<CacheEntry>              m_entries;
+
+    // Lookup tables over `m_entries`; positions rather than pointers, because the vector grows while updating the cache.
+    std::unordered_multimap<std::string, size_t>        m_index_fname;      //!< Lowercase `fname` and `fname_without_uid`
+    std::unordered_multimap<std::string, size_t>        m_index_guid;
+    std::map<std::string, IndexBucket>                  m_index_ext;        //!< Type buckets by `fext`
+    std::unordered_map<uint32_t, std::vector<size_t>>   m_index_trigrams;   //!< Entries whose searchable fields (see `CacheSearchMethod::FULLTEXT`) contain the trigram, sorted
+    std::vector<CacheBundleInfo>         m_bundles;          //!< Index of the bundles the entries come from, sorted by path
+    CacheChangeReport                    m_validity_report;  //!< Scan done by `EvaluateCacheValidity()`; reused by `PruneCache()` during the next `LoadModCache()`
+    std::vector<CacheBundleInfo>         m_validity_bundles; //!< The bundle index updated by that scan
+    bool                                 m_has_validity_report = false;
     std::vector<Ogre::String>            m_known_extensions; //!< the extensions we track in the cache system
     std::set<Ogre::String>               m_resource_paths;   //!< A temporary list of existing resource paths
     std::map<int, Ogre::String>          m_categories = {
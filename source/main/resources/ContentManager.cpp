@@ -52,7 +52,6 @@
 #include "Utils.h"
 
 #include <OgreFileSystem.h>
-#include <regex>
 #include <rapidjson/stringbuffer.h>
 #include <rapidjson/writer.h>
 #include <sstream>
@@ -403,31 +402,6 @@ void ContentManager::LoadGameplayResources()
         this->AddResourcePack(ContentManager::ResourcePack::PAGED);
 }
 
-std::string ContentManager::ListAllUserContent()
-{
-    std::stringstream buf;
-
-    auto dir_list = Ogre::ResourceGroupManager::getSingleton().listResourceFileInfo(RGN_CONTENT, true);
-    for (auto dir: *dir_list)
-    {
-        buf << dir.filename << std::endl;
-    }
-
-    // Any filename + listed extensions, ignore case
-    std::regex file_whitelist("^.\\.(airplane|boat|car|fixed|load|machine|skin|terrn2|train|truck)$", std::regex::icase);
-
-    auto file_list = Ogre::ResourceGroupManager::getSingleton().listResourceFileInfo(RGN_CONTENT, false);
-    for (auto file: *file_list)
-    {
-        if ((file.archive != nullptr) || std::regex_match(file.filename, file_whitelist))
-        {
-            buf << file.filename << std::endl;
-        }
-    }
-
-    return buf.str();
-}
-
 bool ContentManager::LoadAndParseJson(std::string const& filename, std::string const& rg_name, rapidjson::Document& j_doc)
 {
     try
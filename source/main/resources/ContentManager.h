@@ -87,7 +87,6 @@ public:
     void               InitContentManager();
     void               InitModCache(CacheValidity validity);
     void               LoadGameplayResources();  //!< Checks GVar settings and loads required resources.
-    std::string        ListAllUserContent(); //!< Used by ModCache for quick detection of added/removed content
     bool               DeleteDiskFile(std::string const& filename, std::string const& rg_name);
 
     // JSON:
@@ -38,6 +38,10 @@
 #include <OgreStringVector.h>
 #include <OgreStringConverter.h>
 
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
 using namespace RoR;
 
 namespace RigDef
@@ -2951,6 +2955,12 @@ void Parser::ParseManagedMaterials()
         return;
     }
 
+    if (m_resource_group.empty()) // No resource group to look the textures up (mod cache scan)
+    {
+        m_current_module->managed_materials.push_back(managed_mat);
+        return;
+    }
+
     Ogre::ResourceGroupManager& rgm = Ogre::ResourceGroupManager::getSingleton();
 
     if (!rgm.resourceExists(m_resource_group, managed_mat.diffuse_map))
@@ -3224,6 +3234,207 @@ void Parser::AddMessage(std::string const & line, Message::Type type, std::strin
     RoR::App::GetConsole()->putMessage(RoR::Console::CONSOLE_MSGTYPE_ACTOR, cm_type, txt.ToCStr());
 }
 
+namespace {
+
+/// What may follow a keyword on its line.
+enum class KeywordForm
+{
+    BLOCK,           //!< Nothing but blanks
+    INLINE,          //!< Blanks, then values
+    INLINE_TOLERANT  //!< Blanks or commas, then values
+};
+
+struct KeywordDef
+{
+    const char*   name;
+    File::Keyword keyword;
+    KeywordForm   form;
+};
+
+/// IMPORTANT! If you add a value to File::Keyword, you must also add it here.
+const KeywordDef KEYWORD_TABLE[] =
+{
+    { "add_animation",                File::KEYWORD_ADD_ANIMATION,             KeywordForm::INLINE_TOLERANT },
+    { "airbrakes",                    File::KEYWORD_AIRBRAKES,                 KeywordForm::BLOCK },
+    { "animators",                    File::KEYWORD_ANIMATORS,                 KeywordForm::BLOCK },
+    { "AntiLockBrakes",               File::KEYWORD_ANTI_LOCK_BRAKES,          KeywordForm::INLINE },
+    { "axles",                        File::KEYWORD_AXLES,                     KeywordForm::BLOCK },
+    { "author",                       File::KEYWORD_AUTHOR,                    KeywordForm::INLINE },
+    { "backmesh",                     File::KEYWORD_BACKMESH,                  KeywordForm::BLOCK },
+    { "beams",                        File::KEYWORD_BEAMS,                     KeywordForm::BLOCK },
+    { "brakes",                       File::KEYWORD_BRAKES,                    KeywordForm::BLOCK },
+    { "cab",                          File::KEYWORD_CAB,                       KeywordForm::BLOCK },
+    { "camerarail",                   File::KEYWORD_CAMERARAIL,                KeywordForm::BLOCK },
+    { "cameras",                      File::KEYWORD_CAMERAS,                   KeywordForm::BLOCK },
+    { "cinecam",                      File::KEYWORD_CINECAM,                   KeywordForm::BLOCK },
+    { "collisionboxes",               File::KEYWORD_COLLISIONBOXES,            KeywordForm::BLOCK },
+    { "commands",                     File::KEYWORD_COMMANDS,                  KeywordForm::BLOCK },
+    { "commands2",                    File::KEYWORD_COMMANDS2,                 KeywordForm::BLOCK },
+    { "contacters",                   File::KEYWORD_CONTACTERS,                KeywordForm::BLOCK },
+    { "cruisecontrol",                File::KEYWORD_CRUISECONTROL,             KeywordForm::INLINE },
+    { "description",                  File::KEYWORD_DESCRIPTION,               KeywordForm::BLOCK },
+    { "detacher_group",               File::KEYWORD_DETACHER_GROUP,            KeywordForm::INLINE },
+    { "disabledefaultsounds",         File::KEYWORD_DISABLEDEFAULTSOUNDS,      KeywordForm::BLOCK },
+    { "enable_advanced_deformation",  File::KEYWORD_ENABLE_ADVANCED_DEFORM,    KeywordForm::BLOCK },
+    { "end",                          File::KEYWORD_END,                       KeywordForm::BLOCK },
+    { "end_section",                  File::KEYWORD_END_SECTION,               KeywordForm::BLOCK },
+    { "engine",                       File::KEYWORD_ENGINE,                    KeywordForm::BLOCK },
+    { "engoption",                    File::KEYWORD_ENGOPTION,                 KeywordForm::BLOCK },
+    { "engturbo",                     File::KEYWORD_ENGTURBO,                  KeywordForm::BLOCK },
+    { "envmap",                       File::KEYWORD_ENVMAP,                    KeywordForm::BLOCK },
+    { "exhausts",                     File::KEYWORD_EXHAUSTS,                  KeywordForm::BLOCK },
+    { "extcamera",                    File::KEYWORD_EXTCAMERA,                 KeywordForm::INLINE },
+    { "fileformatversion",            File::KEYWORD_FILEFORMATVERSION,         KeywordForm::INLINE },
+    { "fileinfo",                     File::KEYWORD_FILEINFO,                  KeywordForm::INLINE },
+    { "fixes",                        File::KEYWORD_FIXES,                     KeywordForm::BLOCK },
+    { "flares",                       File::KEYWORD_FLARES,                    KeywordForm::BLOCK },
+    { "flares2",                      File::KEYWORD_FLARES2,                   KeywordForm::BLOCK },
+    { "flexbodies",                   File::KEYWORD_FLEXBODIES,                KeywordForm::BLOCK },
+    { "flexbody_camera_mode",         File::KEYWORD_FLEXBODY_CAMERA_MODE,      KeywordForm::INLINE },
+    { "flexbodywheels",               File::KEYWORD_FLEXBODYWHEELS,            KeywordForm::BLOCK },
+    { "forwardcommands",              File::KEYWORD_FORWARDCOMMANDS,           KeywordForm::BLOCK },
+    { "fusedrag",                     File::KEYWORD_FUSEDRAG,                  KeywordForm::BLOCK },
+    { "globals",                      File::KEYWORD_GLOBALS,                   KeywordForm::BLOCK },
+    { "guid",                         File::KEYWORD_GUID,                      KeywordForm::INLINE },
+    { "guisettings",                  File::KEYWORD_GUISETTINGS,               KeywordForm::BLOCK },
+    { "help",                         File::KEYWORD_HELP,                      KeywordForm::BLOCK },
+    { "hideInChooser",                File::KEYWORD_HIDE_IN_CHOOSER,           KeywordForm::BLOCK },
+    { "hookgroup",                    File::KEYWORD_HOOKGROUP,                 KeywordForm::BLOCK },
+    { "hooks",                        File::KEYWORD_HOOKS,                     KeywordForm::BLOCK },
+    { "hydros",                       File::KEYWORD_HYDROS,                    KeywordForm::BLOCK },
+    { "importcommands",               File::KEYWORD_IMPORTCOMMANDS,            KeywordForm::BLOCK },
+    { "interaxles",                   File::KEYWORD_INTERAXLES,                KeywordForm::BLOCK },
+    { "lockgroups",                   File::KEYWORD_LOCKGROUPS,                KeywordForm::BLOCK },
+    { "lockgroup_default_nolock",     File::KEYWORD_LOCKGROUP_DEFAULT_NOLOCK,  KeywordForm::BLOCK },
+    { "managedmaterials",             File::KEYWORD_MANAGEDMATERIALS,          KeywordForm::BLOCK },
+    { "materialflarebindings",        File::KEYWORD_MATERIALFLAREBINDINGS,     KeywordForm::BLOCK },
+    { "meshwheels",                   File::KEYWORD_MESHWHEELS,                KeywordForm::BLOCK },
+    { "meshwheels2",                  File::KEYWORD_MESHWHEELS2,               KeywordForm::BLOCK },
+    { "minimass",                     File::KEYWORD_MINIMASS,                  KeywordForm::BLOCK },
+    { "nodecollision",                File::KEYWORD_NODECOLLISION,             KeywordForm::BLOCK },
+    { "nodes",                        File::KEYWORD_NODES,                     KeywordForm::BLOCK },
+    { "nodes2",                       File::KEYWORD_NODES2,                    KeywordForm::BLOCK },
+    { "particles",                    File::KEYWORD_PARTICLES,                 KeywordForm::BLOCK },
+    { "pistonprops",                  File::KEYWORD_PISTONPROPS,               KeywordForm::BLOCK },
+    { "prop_camera_mode",             File::KEYWORD_PROP_CAMERA_MODE,          KeywordForm::INLINE },
+    { "props",                        File::KEYWORD_PROPS,                     KeywordForm::BLOCK },
+    { "railgroups",                   File::KEYWORD_RAILGROUPS,                KeywordForm::BLOCK },
+    { "rescuer",                      File::KEYWORD_RESCUER,                   KeywordForm::BLOCK },
+    { "rigidifiers",                  File::KEYWORD_RIGIDIFIERS,               KeywordForm::BLOCK },
+    { "rollon",                       File::KEYWORD_ROLLON,                    KeywordForm::BLOCK },
+    { "ropables",                     File::KEYWORD_ROPABLES,                  KeywordForm::BLOCK },
+    { "ropes",                        File::KEYWORD_ROPES,                     KeywordForm::BLOCK },
+    { "rotators",                     File::KEYWORD_ROTATORS,                  KeywordForm::BLOCK },
+    { "rotators2",                    File::KEYWORD_ROTATORS2,                 KeywordForm::BLOCK },
+    { "screwprops",                   File::KEYWORD_SCREWPROPS,                KeywordForm::BLOCK },
+    { "section",                      File::KEYWORD_SECTION,                   KeywordForm::INLINE },
+    { "sectionconfig",                File::KEYWORD_SECTIONCONFIG,             KeywordForm::INLINE },
+    { "set_beam_defaults",            File::KEYWORD_SET_BEAM_DEFAULTS,         KeywordForm::INLINE },
+    { "set_beam_defaults_scale",      File::KEYWORD_SET_BEAM_DEFAULTS_SCALE,   KeywordForm::INLINE },
+    { "set_collision_range",          File::KEYWORD_SET_COLLISION_RANGE,       KeywordForm::INLINE },
+    { "set_default_minimass",         File::KEYWORD_SET_DEFAULT_MINIMASS,      KeywordForm::INLINE },
+    { "set_inertia_defaults",         File::KEYWORD_SET_INERTIA_DEFAULTS,      KeywordForm::INLINE },
+    { "set_managedmaterials_options", File::KEYWORD_SET_MANAGEDMATS_OPTIONS,   KeywordForm::INLINE },
+    { "set_node_defaults",            File::KEYWORD_SET_NODE_DEFAULTS,         KeywordForm::INLINE },
+    { "set_shadows",                  File::KEYWORD_SET_SHADOWS,               KeywordForm::BLOCK },
+    { "set_skeleton_settings",        File::KEYWORD_SET_SKELETON_SETTINGS,     KeywordForm::INLINE },
+    { "shocks",                       File::KEYWORD_SHOCKS,                    KeywordForm::BLOCK },
+    { "shocks2",                      File::KEYWORD_SHOCKS2,                   KeywordForm::BLOCK },
+    { "shocks3",                      File::KEYWORD_SHOCKS3,                   KeywordForm::BLOCK },
+    { "slidenode_connect_instantly",  File::KEYWORD_SLIDENODE_CONNECT_INSTANT, KeywordForm::BLOCK },
+    { "slidenodes",                   File::KEYWORD_SLIDENODES,                KeywordForm::BLOCK },
+    { "SlopeBrake",                   File::KEYWORD_SLOPE_BRAKE,               KeywordForm::INLINE },
+    { "soundsources",                 File::KEYWORD_SOUNDSOURCES,              KeywordForm::BLOCK },
+    { "soundsources2",                File::KEYWORD_SOUNDSOURCES2,             KeywordForm::BLOCK },
+    { "speedlimiter",                 File::KEYWORD_SPEEDLIMITER,              KeywordForm::INLINE },
+    { "submesh",                      File::KEYWORD_SUBMESH,                   KeywordForm::BLOCK },
+    { "submesh_groundmodel",          File::KEYWORD_SUBMESH_GROUNDMODEL,       KeywordForm::INLINE },
+    { "texcoords",                    File::KEYWORD_TEXCOORDS,                 KeywordForm::BLOCK },
+    { "ties",                         File::KEYWORD_TIES,                      KeywordForm::BLOCK },
+    { "torquecurve",                  File::KEYWORD_TORQUECURVE,               KeywordForm::BLOCK },
+    { "TractionControl",              File::KEYWORD_TRACTION_CONTROL,          KeywordForm::INLINE },
+    { "transfercase",                 File::KEYWORD_TRANSFER_CASE,             KeywordForm::BLOCK },
+    { "triggers",                     File::KEYWORD_TRIGGERS,                  KeywordForm::BLOCK },
+    { "turbojets",                    File::KEYWORD_TURBOJETS,                 KeywordForm::BLOCK },
+    { "turboprops",                   File::KEYWORD_TURBOPROPS,                KeywordForm::BLOCK },
+    { "turboprops2",                  File::KEYWORD_TURBOPROPS2,               KeywordForm::BLOCK },
+    { "videocamera",                  File::KEYWORD_VIDEOCAMERA,               KeywordForm::BLOCK },
+    { "wheeldetachers",               File::KEYWORD_WHEELDETACHERS,            KeywordForm::BLOCK },
+    { "wheels",                       File::KEYWORD_WHEELS,                    KeywordForm::BLOCK },
+    { "wheels2",                      File::KEYWORD_WHEELS2,                   KeywordForm::BLOCK },
+    { "wings",                        File::KEYWORD_WINGS,                     KeywordForm::BLOCK },
+};
+
+inline char LowerAscii(char c)
+{
+    return (c >= 'A' && c <= 'Z') ? (c + ('a' - 'A')) : c;
+}
+
+/// True if `name` consists of exactly the `len` chars of `word`, ignoring lettercase
+inline bool EqualsNocase(const char* name, const char* word, size_t len)
+{
+    for (size_t i = 0; i < len; i++)
+    {
+        if (name[i] == '\0' || LowerAscii(name[i]) != LowerAscii(word[i]))
+        {
+            return false;
+        }
+    }
+    return name[len] == '\0';
+}
+
+/// Case-insensitive hash table over `KEYWORD_TABLE`; open addressing, built on first use.
+class KeywordLookup
+{
+public:
+    KeywordLookup()
+    {
+        std::fill(m_slots, m_slots + NUM_SLOTS, EMPTY_SLOT);
+        for (size_t i = 0; i < sizeof(KEYWORD_TABLE) / sizeof(KeywordDef); i++)
+        {
+            size_t slot = Hash(KEYWORD_TABLE[i].name, strlen(KEYWORD_TABLE[i].name));
+            while (m_slots[slot] != EMPTY_SLOT)
+            {
+                slot = (slot + 1) & (NUM_SLOTS - 1);
+            }
+            m_slots[slot] = static_cast<uint8_t>(i);
+        }
+    }
+
+    const KeywordDef* Find(const char* word, size_t len) const
+    {
+        for (size_t slot = Hash(word, len); m_slots[slot] != EMPTY_SLOT; slot = (slot + 1) & (NUM_SLOTS - 1))
+        {
+            const KeywordDef& def = KEYWORD_TABLE[m_slots[slot]];
+            if (EqualsNocase(def.name, word, len))
+            {
+                return &def;
+            }
+        }
+        return nullptr;
+    }
+
+private:
+    static const size_t  NUM_SLOTS = 256; // Power of 2, over twice the number of keywords
+    static const uint8_t EMPTY_SLOT = 0xFF;
+
+    static size_t Hash(const char* word, size_t len)
+    {
+        uint32_t hash = 2166136261u; // FNV-1a
+        for (size_t i = 0; i < len; i++)
+        {
+            hash = (hash ^ static_cast<uint8_t>(LowerAscii(word[i]))) * 16777619u;
+        }
+        return hash & (NUM_SLOTS - 1);
+    }
+
+    uint8_t m_slots[NUM_SLOTS];
+};
+
+static_assert(sizeof(KEYWORD_TABLE) / sizeof(KeywordDef) < 0xFF, "KeywordLookup stores table indices as bytes");
+
+} // namespace
+
 File::Keyword Parser::IdentifyKeywordInCurrentLine()
 {
     // Quick check - keyword always starts with ASCII letter
@@ -3233,42 +3444,56 @@ File::Keyword Parser::IdentifyKeywordInCurrentLine()
         return File::KEYWORD_INVALID;
     }
 
-    // Search with correct lettercase
-    std::smatch results;
-    std::string line(m_current_line);
-    std::regex_search(line, results, Regexes::IDENTIFY_KEYWORD_RESPECT_CASE); // Always returns true.
-    File::Keyword keyword = FindKeywordMatch(results);
-    if (keyword != File::KEYWORD_INVALID)
+    // The keyword is everything up to the first blank or comma
+    size_t len = 0;
+    while (m_current_line[len] != '\0' && !IsWhitespace(m_current_line[len]) && m_current_line[len] != ',')
     {
-        return keyword;
+        len++;
     }
 
-    // Search and ignore lettercase
-    std::regex_search(line, results, Regexes::IDENTIFY_KEYWORD_IGNORE_CASE); // Always returns true.
-    keyword = FindKeywordMatch(results);
-    if (keyword != File::KEYWORD_INVALID)
+    static const KeywordLookup lookup;
+    const KeywordDef* def = lookup.Find(m_current_line, len);
+    if (def == nullptr)
     {
-        this->AddMessage(line, Message::TYPE_WARNING,
-            "Keyword has invalid lettercase. Correct form is: " + std::string(File::KeywordToString(keyword)));
+        return File::KEYWORD_INVALID;
     }
-    return keyword;
-}
 
-File::Keyword Parser::FindKeywordMatch(std::smatch& search_results)
-{
-    // The 'results' array contains a complete match at positon [0] and sub-matches starting with [1], 
-    //    so we get exact positions in Regexes::IDENTIFY_KEYWORD, which again match File::Keyword enum members
-
-    for (unsigned int i = 1; i < search_results.size(); i++)
+    // Check the rest of the line
+    const char* rest = m_current_line + len;
+    switch (def->form)
     {
-        std::ssub_match sub  = search_results[i];
-        if (sub.matched)
+    case KeywordForm::BLOCK:
+        while (IsWhitespace(*rest))
+        {
+            rest++;
+        }
+        if (*rest != '\0')
         {
-            // Build enum value directly from result offset
-            return File::Keyword(i);
+            return File::KEYWORD_INVALID;
         }
+        break;
+
+    case KeywordForm::INLINE:
+        if (!IsWhitespace(*rest))
+        {
+            return File::KEYWORD_INVALID;
+        }
+        break;
+
+    case KeywordForm::INLINE_TOLERANT:
+        if (!IsWhitespace(*rest) && *rest != ',')
+        {
+            return File::KEYWORD_INVALID;
+        }
+        break;
+    }
+
+    if (strncmp(def->name, m_current_line, len) != 0)
+    {
+        this->AddMessage(m_current_line, Message::TYPE_WARNING,
+            "Keyword has invalid lettercase. Correct form is: " + std::string(File::KeywordToString(def->keyword)));
     }
-    return File::KEYWORD_INVALID;
+    return def->keyword;
 }
 
 void Parser::Prepare()
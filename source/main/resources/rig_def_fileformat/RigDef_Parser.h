@@ -81,7 +81,7 @@ public:
 
     void Prepare();
     void Finalize();
-    void ProcessOgreStream(Ogre::DataStream* stream, Ogre::String resource_group);
+    void ProcessOgreStream(Ogre::DataStream* stream, Ogre::String resource_group); //!< With empty `resource_group`, textures of managed materials aren't checked
     void ProcessRawLine(const char* line);
 
     std::shared_ptr<RigDef::File> GetFile()
@@ -230,9 +230,6 @@ private:
     /// Keyword scan function. 
     File::Keyword IdentifyKeywordInCurrentLine();
 
-    /// Keyword scan utility function. 
-    File::Keyword FindKeywordMatch(std::smatch& search_results);
-
     /// Adds a message to console
     void AddMessage(std::string const & line, Message::Type type, std::string const & message);
     void AddMessage(Message::Type type, const char* msg)
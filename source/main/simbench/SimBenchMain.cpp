@@ -0,0 +1,312 @@
+/*
+    This source file is part of Rigs of Rods
+    Copyright 2026 Rigs of Rods contributors
+
+    For more information, see http://www.rigsofrods.org/
+
+    Rigs of Rods is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License version 3, as
+    published by the Free Software Foundation.
+
+    Rigs of Rods is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Rigs of Rods. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/// @file
+/// @brief RoR_simbench: Steps the physics of N copies of real truckfiles without a render system.
+///
+/// Usage: RoR_simbench [--steps N] [--count N] [--threads 1,2,4] [--terrain flat|hills] file.truck [file.truck ...]
+///
+/// Prints substeps/sec and the per-phase breakdown of `ActorManager::UpdatePhysicsSimulation()`
+/// for each thread count. Needs the regular 'resources' directory and user directory, like the game.
+
+#include "Actor.h"
+#include "ActorManager.h"
+#include "AppContext.h"
+#include "Application.h"
+#include "Collisions.h"
+#include "Console.h"
+#include "ContentManager.h"
+#include "GameContext.h"
+#include "GfxScene.h"
+#include "PlatformUtils.h"
+#include "RigDef_Parser.h"
+#include "RigDef_Validator.h"
+#include "TerrainManager.h"
+#include "Utils.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+using namespace RoR;
+
+namespace {
+
+const int   TERRAIN_WORLD_SIZE     = 2048;
+const int   TERRAIN_HEIGHTMAP_SIZE = 513;
+const float SPAWN_SPACING          = 20.f;
+const int   WARMUP_SUBSTEPS        = 200;
+const int   FRAME_SUBSTEPS         = 33;   //!< What `UpdatePhysicsSimulation()` gets per frame at 60 FPS
+
+struct SimBenchArgs
+{
+    int                      steps = 2000;        //!< Physics substeps per measurement (2000 = 1 simulated second)
+    int                      count = 1;           //!< Copies of each truckfile
+    std::vector<int>         threads;             //!< Worker counts to measure; empty = cvar 'app_num_workers'
+    std::string              terrain = "flat";
+    std::vector<std::string> truckfiles;
+};
+
+bool ParseArgs(int argc, char* argv[], SimBenchArgs& args)
+{
+    for (int i = 1; i < argc; i++)
+    {
+        const bool has_value = (i + 1 < argc);
+        if (!strcmp(argv[i], "--steps") && has_value)
+        {
+            args.steps = std::max(1, atoi(argv[++i]));
+        }
+        else if (!strcmp(argv[i], "--count") && has_value)
+        {
+            args.count = std::max(1, atoi(argv[++i]));
+        }
+        else if (!strcmp(argv[i], "--threads") && has_value)
+        {
+            for (Ogre::String const& token: Ogre::StringUtil::split(argv[++i], ","))
+            {
+                args.threads.push_back(std::max(1, atoi(token.c_str())));
+            }
+        }
+        else if (!strcmp(argv[i], "--terrain") && has_value)
+        {
+            args.terrain = argv[++i];
+        }
+        else if (argv[i][0] == '-')
+        {
+            return false;
+        }
+        else
+        {
+            args.truckfiles.push_back(argv[i]);
+        }
+    }
+    return !args.truckfiles.empty() && (args.terrain == "flat" || args.terrain == "hills");
+}
+
+/// Empty = flat; otherwise rolling hills, steep enough to keep wheels and the ground grid busy
+std::vector<float> GenerateHeightmap(std::string const& terrain)
+{
+    std::vector<float> heights;
+    if (terrain != "hills")
+        return heights;
+
+    heights.resize(TERRAIN_HEIGHTMAP_SIZE * TERRAIN_HEIGHTMAP_SIZE);
+    for (int y = 0; y < TERRAIN_HEIGHTMAP_SIZE; y++)
+    {
+        for (int x = 0; x < TERRAIN_HEIGHTMAP_SIZE; x++)
+        {
+            const float fx = static_cast<float>(x) / (TERRAIN_HEIGHTMAP_SIZE - 1);
+            const float fy = static_cast<float>(y) / (TERRAIN_HEIGHTMAP_SIZE - 1);
+            heights[y * TERRAIN_HEIGHTMAP_SIZE + x] = 20.f
+                + 8.f * std::sin(fx * 31.f) * std::cos(fy * 23.f)
+                + 2.f * std::sin((fx + fy) * 97.f);
+        }
+    }
+    return heights;
+}
+
+std::shared_ptr<RigDef::File> LoadTruckfile(std::string const& path)
+{
+    // Each truckfile gets a resource group for its directory, so that its meshes and materials resolve
+    const size_t slash = path.find_last_of("/\\");
+    const std::string dir = (slash == std::string::npos) ? "." : path.substr(0, slash);
+    const std::string filename = (slash == std::string::npos) ? path : path.substr(slash + 1);
+    const std::string group = "SimBench-" + path;
+
+    try
+    {
+        Ogre::ResourceGroupManager::getSingleton().addResourceLocation(dir, "FileSystem", group);
+        Ogre::ResourceGroupManager::getSingleton().initialiseResourceGroup(group);
+        Ogre::DataStreamPtr stream = Ogre::ResourceGroupManager::getSingleton().openResource(filename, group);
+
+        RigDef::Parser parser;
+        parser.Prepare();
+        parser.ProcessOgreStream(stream.getPointer(), group);
+        parser.Finalize();
+
+        auto def = parser.GetFile();
+        RigDef::Validator validator;
+        validator.Setup(def);
+        validator.Validate(); // Sends messages to console
+        return def;
+    }
+    catch (Ogre::Exception& e)
+    {
+        fprintf(stderr, "Failed to load '%s': %s\n", path.c_str(), e.getFullDescription().c_str());
+        return nullptr;
+    }
+}
+
+std::vector<Actor*> SpawnActors(SimBenchArgs const& args, std::vector<std::shared_ptr<RigDef::File>> const& defs)
+{
+    // Square grid around the terrain center, far enough apart not to collide at rest
+    const int total = static_cast<int>(defs.size()) * args.count;
+    const int columns = static_cast<int>(std::ceil(std::sqrt(static_cast<float>(total))));
+    const float origin = TERRAIN_WORLD_SIZE * 0.5f - (columns - 1) * SPAWN_SPACING * 0.5f;
+
+    std::vector<Actor*> actors;
+    for (int i = 0; i < total; i++)
+    {
+        ActorSpawnRequest rq;
+        rq.asr_filename = args.truckfiles[i % defs.size()];
+        rq.asr_origin = ActorSpawnRequest::Origin::CONFIG_FILE;
+        rq.asr_position = Ogre::Vector3(origin + (i % columns) * SPAWN_SPACING, 0.f, origin + (i / columns) * SPAWN_SPACING);
+        rq.asr_rotation = Ogre::Quaternion::IDENTITY;
+        actors.push_back(App::GetGameContext()->GetActorManager()->CreateActorInstance(rq, defs[i % defs.size()]));
+    }
+    return actors;
+}
+
+void RunBenchmark(SimBenchArgs const& args, std::vector<std::shared_ptr<RigDef::File>> const& defs, int num_workers)
+{
+    ActorManager* actor_manager = App::GetGameContext()->GetActorManager();
+
+    // Actors size their task partitions by the worker count when spawned, so respawn for each pool
+    App::app_num_workers->SetVal(num_workers);
+    App::CreateThreadPool();
+    num_workers = App::app_num_workers->GetInt(); // Clamped to the CPU
+    std::vector<Actor*> actors = SpawnActors(args, defs);
+    int num_nodes = 0, num_beams = 0;
+    for (Actor* actor: actors)
+    {
+        num_nodes += actor->ar_num_nodes;
+        num_beams += actor->ar_num_beams;
+    }
+
+    actor_manager->SetTrucksForcedAwake(true);
+    actor_manager->WakeUpAllActors();
+
+    // Warm-up: the first call after spawning clears `m_ongoing_reset` and settles the actors
+    actor_manager->SetPhysicsSteps(WARMUP_SUBSTEPS);
+    actor_manager->UpdatePhysicsSimulation();
+    actor_manager->ResetPhysicsPhaseTimes();
+
+    // Measure; stepped in frame-sized batches like the game does
+    const auto start = std::chrono::steady_clock::now();
+    for (int done = 0; done < args.steps; )
+    {
+        const int batch = std::min(args.steps - done, FRAME_SUBSTEPS);
+        actor_manager->SetPhysicsSteps(batch);
+        actor_manager->UpdatePhysicsSimulation();
+        done += batch;
+    }
+    const double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    ActorManager::PhysicsPhaseTimes const& phases = actor_manager->GetPhysicsPhaseTimes();
+    const double to_ms = 1000.0 / std::max(1L, phases.num_substeps);
+    printf("%7d  %7d  %8d  %8d  %12.0f  %8.4f  %8.4f  %8.4f  %8.4f\n",
+        num_workers, static_cast<int>(actors.size()), num_nodes, num_beams, args.steps / elapsed,
+        phases.prepare_sec * to_ms, phases.compute_sec * to_ms, phases.inter_beams_sec * to_ms, phases.collisions_sec * to_ms);
+    fflush(stdout);
+
+    for (Actor* actor: actors)
+    {
+        actor_manager->DeleteActorInternal(actor);
+    }
+    App::DestroyThreadPool();
+}
+
+} // namespace
+
+int main(int argc, char *argv[])
+{
+    SimBenchArgs args;
+    if (!ParseArgs(argc, argv, args))
+    {
+        printf("Usage: RoR_simbench [--steps N] [--count N] [--threads 1,2,4] [--terrain flat|hills] file.truck [file.truck ...]\n");
+        return 1;
+    }
+
+    try
+    {
+        // Same startup as the game, minus rendering, input, GUI and networking
+        App::GetConsole()->CVarSetupBuiltins();
+        if (!App::GetAppContext()->SetUpProgramPaths())
+        {
+            return -1; // Error already displayed
+        }
+        App::GetAppContext()->SetUpLogging();
+        App::sys_config_dir->SetStr(PathCombine(App::sys_user_dir->GetStr(), "config"));
+        App::sys_cache_dir ->SetStr(PathCombine(App::sys_user_dir->GetStr(), "cache"));
+        App::sys_savegames_dir->SetStr(PathCombine(App::sys_user_dir->GetStr(), "savegames"));
+        App::GetConsole()->LoadConfig();
+        if (!App::GetAppContext()->SetUpResourcesDir())
+        {
+            return -1; // Error already displayed
+        }
+        App::GetAppContext()->SetUpHeadless();
+
+        // Keep visuals as cheap as possible; they're created at spawn, never updated
+        App::diag_simple_materials->SetVal(true);
+        App::gfx_particles_mode->SetVal(0);
+        App::gfx_enable_videocams->SetVal(false);
+
+        App::GetContentManager()->AddResourcePack(ContentManager::ResourcePack::OGRE_CORE);
+        App::GetContentManager()->InitContentManager();
+        App::CreateGfxScene();
+        App::GetGameContext()->GetActorManager()->GetInertiaConfig().LoadDefaultInertiaModels();
+
+        App::SetSimTerrain(TerrainManager::CreateHeadless(TERRAIN_WORLD_SIZE, GenerateHeightmap(args.terrain)));
+        if (!App::GetSimTerrain())
+        {
+            return -1; // Error already logged
+        }
+
+        std::vector<std::shared_ptr<RigDef::File>> defs;
+        for (std::string const& path: args.truckfiles)
+        {
+            auto def = LoadTruckfile(path);
+            if (!def)
+            {
+                return -1;
+            }
+            defs.push_back(def);
+        }
+
+        if (args.threads.empty())
+        {
+            args.threads.push_back(App::app_num_workers->GetInt());
+        }
+
+        printf("RoR_simbench: %d substeps, %s terrain\n", args.steps, args.terrain.c_str());
+        printf("%7s  %7s  %8s  %8s  %12s  %8s  %8s  %8s  %8s\n",
+            "workers", "actors", "nodes", "beams", "substeps/s", "prep ms", "calc ms", "link ms", "coll ms");
+        for (int num_workers: args.threads)
+        {
+            RunBenchmark(args, defs, num_workers);
+        }
+    }
+    catch (Ogre::Exception& e)
+    {
+        fprintf(stderr, "RoR_simbench: %s\n", e.getFullDescription().c_str());
+        return -1;
+    }
+    catch (std::exception& e)
+    {
+        fprintf(stderr, "RoR_simbench: %s\n", e.what());
+        return -1;
+    }
+
+    return 0;
+}
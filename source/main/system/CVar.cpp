@@ -33,6 +33,7 @@ void Console::CVarSetupBuiltins()
     App::app_country             = this->CVarCreate("app_country",             "Country",                    CVAR_ARCHIVE,                     "us");
     App::app_skip_main_menu      = this->CVarCreate("app_skip_main_menu",      "SkipMainMenu",               CVAR_ARCHIVE | CVAR_TYPE_BOOL,    "false");
     App::app_async_physics       = this->CVarCreate("app_async_physics",       "AsyncPhysics",               CVAR_ARCHIVE | CVAR_TYPE_BOOL,    "true");
+    App::app_pipelined_physics   = this->CVarCreate("app_pipelined_physics",   "PipelinedPhysics",           CVAR_ARCHIVE | CVAR_TYPE_BOOL,    "false");
     App::app_num_workers         = this->CVarCreate("app_num_workers",         "NumWorkerThreads",           CVAR_ARCHIVE | CVAR_TYPE_INT);
     App::app_screenshot_format   = this->CVarCreate("app_screenshot_format",   "Screenshot Format",          CVAR_ARCHIVE,                     "png");
     App::app_rendersys_override  = this->CVarCreate("app_rendersys_override",  "Render system",              CVAR_ARCHIVE);
@@ -56,6 +57,8 @@ void Console::CVarSetupBuiltins()
     App::sim_gearbox_mode        = this->CVarCreate("sim_gearbox_mode",        "GearboxMode",                CVAR_ARCHIVE | CVAR_TYPE_INT);
     App::sim_soft_reset_mode     = this->CVarCreate("sim_soft_reset_mode",     "",                                          CVAR_TYPE_BOOL,    "false");
     App::sim_quickload_dialog    = this->CVarCreate("sim_quickload_dialog",    "",                           CVAR_ARCHIVE | CVAR_TYPE_BOOL,    "true");
+    App::sim_rng_seed            = this->CVarCreate("sim_rng_seed",            "",                                          CVAR_TYPE_INT,     "0");
+    App::sim_island_dozing       = this->CVarCreate("sim_island_dozing",       "IslandDozing",               CVAR_ARCHIVE | CVAR_TYPE_BOOL,    "false");
 
     App::mp_state                = this->CVarCreate("mp_state",                "",                                          CVAR_TYPE_INT,     "0"/*(int)MpState::DISABLED*/);
     App::mp_join_on_startup      = this->CVarCreate("mp_join_on_startup",      "Auto connect",               CVAR_ARCHIVE | CVAR_TYPE_BOOL,    "false");
@@ -96,6 +99,7 @@ void Console::CVarSetupBuiltins()
     App::diag_hide_wheels        = this->CVarCreate("diag_hide_wheels",        "Hide wheels",                CVAR_ARCHIVE | CVAR_TYPE_BOOL,    "false");
     App::diag_hide_nodes         = this->CVarCreate("diag_hide_nodes",         "Hide nodes",                 CVAR_ARCHIVE | CVAR_TYPE_BOOL,    "false");
     App::diag_terrn_log_roads    = this->CVarCreate("diag_terrn_log_roads",    "",                           CVAR_ARCHIVE | CVAR_TYPE_BOOL,    "false");
+    App::diag_cache_json         = this->CVarCreate("diag_cache_json",         "",                           CVAR_ARCHIVE | CVAR_TYPE_BOOL,    "false");
 
     App::sys_process_dir         = this->CVarCreate("sys_process_dir",         "",                           0);
     App::sys_user_dir            = this->CVarCreate("sys_user_dir",            "",                           0);
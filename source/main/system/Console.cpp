@@ -29,6 +29,8 @@
 using namespace RoR;
 using namespace Ogre;
 
+static thread_local std::vector<Console::Message>* t_message_capture = nullptr;
+
 void Console::messageLogged(const Ogre::String& message, Ogre::LogMessageLevel lml, bool maskDebug, const Ogre::String& logName, bool& skipThisMessage)
 {
     if (App::diag_log_console_echo->GetBool())
@@ -89,6 +91,12 @@ void Console::HandleMessage(MessageArea area, MessageType type, std::string cons
         Log(txt.ToCStr());
     }
 
+    if (t_message_capture)
+    {
+        t_message_capture->emplace_back(area, type, msg, 0, net_userid);
+        return;
+    }
+
     // Lock and update message list
     std::lock_guard<std::mutex> lock(m_messages_mutex); // Scoped lock
     m_messages.emplace_back(area, type, msg, this->QueryMessageTimer(), net_userid);
@@ -100,6 +108,20 @@ void Console::putMessage(MessageArea area, MessageType type, std::string const&
     this->HandleMessage(area, type, msg);
 }
 
+void Console::SetMessageCapture(std::vector<Message>* messages)
+{
+    t_message_capture = messages;
+}
+
+void Console::PutCapturedMessages(std::vector<Message> const& messages)
+{
+    std::lock_guard<std::mutex> lock(m_messages_mutex); // Scoped lock
+    for (Message const& msg: messages)
+    {
+        m_messages.emplace_back(msg.cm_area, msg.cm_type, msg.cm_text, this->QueryMessageTimer(), msg.cm_net_userid);
+    }
+}
+
 void Console::putNetMessage(int user_id, MessageType type, const char* text)
 {
     this->HandleMessage(CONSOLE_MSGTYPE_INFO, type, text, user_id);
@@ -94,6 +94,11 @@ public:
     void ForwardLogMessage(MessageArea area, std::string const& msg, Ogre::LogMessageLevel lml);
     unsigned long QueryMessageTimer() { return m_msg_timer.getMilliseconds(); }
 
+    /// Messages put by the calling thread go to `messages` instead of the list until reset with nullptr.
+    /// Their log lines are still written, see `RoR::SetLogCapture()`.
+    static void SetMessageCapture(std::vector<Message>* messages);
+    void PutCapturedMessages(std::vector<Message> const& messages); //!< Adds them to the list, stamped with the current time
+
     // ----------------------------
     // Commands (defined in ConsoleCmd.cpp):
 
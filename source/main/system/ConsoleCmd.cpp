@@ -32,6 +32,8 @@
 #include "Language.h"
 #include "Network.h"
 #include "OverlayWrapper.h"
+#include "PlatformUtils.h"
+#include "Profiler.h"
 #include "RoRnet.h"
 #include "RoRVersion.h"
 #include "ScriptEngine.h"
@@ -40,6 +42,7 @@
 #include "Utils.h"
 
 #include <algorithm>
+#include <ctime>
 #include <Ogre.h>
 #include <fmt/core.h>
 
@@ -583,6 +586,84 @@ public:
     }
 };
 
+class ProfilerCmd: public ConsoleCmd
+{
+public:
+    ProfilerCmd(): ConsoleCmd("profiler", "[csv/json/start/stop]", _L("Save the phase profiler history (last frames) or capture a timeline of all threads; files go to the profiler directory")) {}
+
+    void Run(Ogre::StringVector const& args) override
+    {
+        Str<500> reply;
+        reply << m_name << ": ";
+        Console::MessageType reply_type = Console::CONSOLE_SYSTEM_REPLY;
+
+#ifdef ROR_PROFILER
+        const std::string mode = (args.size() > 1) ? args[1] : "csv";
+        std::string dir = App::sys_profiler_dir->GetStr();
+        if (dir.empty())
+        {
+            dir = App::sys_logs_dir->GetStr();
+        }
+
+        if (mode == "start")
+        {
+            Profiler::StartCapture();
+            reply << _L("capture started, use 'profiler stop' to save it");
+        }
+        else if (mode == "stop")
+        {
+            if (!Profiler::IsCapturing())
+            {
+                reply_type = Console::CONSOLE_SYSTEM_ERROR;
+                reply << _L("no capture running, use 'profiler start'");
+            }
+            else
+            {
+                const std::string path = PathCombine(dir, fmt::format("trace_{}.json", std::time(nullptr)));
+                size_t num_events = 0, num_dropped = 0;
+                if (Profiler::StopCapture(path, num_events, num_dropped))
+                {
+                    reply << fmt::format(_L("{} events saved to '{}' (open in chrome://tracing or ui.perfetto.dev)"), num_events, path);
+                    if (num_dropped > 0)
+                    {
+                        reply << fmt::format(_L(", {} events dropped - shorter captures fit"), num_dropped);
+                    }
+                }
+                else
+                {
+                    reply_type = Console::CONSOLE_SYSTEM_ERROR;
+                    reply << fmt::format(_L("could not write '{}'"), path);
+                }
+            }
+        }
+        else if (mode != "csv" && mode != "json")
+        {
+            reply_type = Console::CONSOLE_SYSTEM_ERROR;
+            reply << _L("unknown mode, use 'csv', 'json', 'start' or 'stop'");
+        }
+        else
+        {
+            const std::string path = PathCombine(dir, fmt::format("profiler_{}.{}", std::time(nullptr), mode));
+            const bool ok = (mode == "csv") ? Profiler::WriteCsv(path) : Profiler::WriteChromeTrace(path);
+            if (ok)
+            {
+                reply << fmt::format(_L("{} frames saved to '{}'"), Profiler::GetNumFrames(), path);
+            }
+            else
+            {
+                reply_type = Console::CONSOLE_SYSTEM_ERROR;
+                reply << fmt::format(_L("could not write '{}'"), path);
+            }
+        }
+#else
+        reply_type = Console::CONSOLE_SYSTEM_ERROR;
+        reply << _L("the profiler is not compiled in (CMake option USE_PROFILER)");
+#endif
+
+        App::GetConsole()->putMessage(Console::CONSOLE_MSGTYPE_INFO, reply_type, reply.ToCStr());
+    }
+};
+
 // -------------------------------------------------------------------------------------
 // Console integration
 
@@ -604,6 +685,7 @@ void Console::RegBuiltinCommands()
     cmd = new HelpCmd();                  m_commands.insert(std::make_pair(cmd->GetName(), cmd));
     // Additions
     cmd = new ClearCmd();                 m_commands.insert(std::make_pair(cmd->GetName(), cmd));
+    cmd = new ProfilerCmd();              m_commands.insert(std::make_pair(cmd->GetName(), cmd));
     // CVars
     cmd = new SetCmd();                   m_commands.insert(std::make_pair(cmd->GetName(), cmd));
     cmd = new SetstringCmd();             m_commands.insert(std::make_pair(cmd->GetName(), cmd));
@@ -35,6 +35,11 @@
 #include <OgreLight.h>
 #include <Terrain/OgreTerrainGroup.h>
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define ROR_TERRAIN_SSE2
+    #include <emmintrin.h>
+#endif
+
 using namespace Ogre;
 using namespace RoR;
 
@@ -226,6 +231,107 @@ float TerrainGeometryManager::getHeightAtTerrainPosition(Real x, Real y)
     return (-normal.x * x - normal.y * y - d) / normal.z;
 }
 
+#ifdef ROR_TERRAIN_SSE2
+
+namespace {
+
+inline __m128 Select(__m128 mask, __m128 a, __m128 b) { return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b)); }
+
+} // namespace
+
+/// Same math as `getHeightAtTerrainPosition()`, 4 lanes at a time; only the height samples are fetched one by one.
+void TerrainGeometryManager::getHeightsAtTerrainPosition4(const float* x, const float* y, float* out_heights)
+{
+    const Real factor = (Real)mSize - 1.0f;
+    const Real invFactor = 1.0f / factor;
+    const __m128 vx = _mm_loadu_ps(x);
+    const __m128 vy = _mm_loadu_ps(y);
+    const __m128 vinv = _mm_set1_ps(invFactor);
+
+    // get left / bottom points (rounded down)
+    const __m128 fx = _mm_mul_ps(vx, _mm_set1_ps(factor));
+    const __m128 fy = _mm_mul_ps(vy, _mm_set1_ps(factor));
+    const __m128i startX = _mm_cvttps_epi32(fx);
+    const __m128i startY = _mm_cvttps_epi32(fy);
+    const __m128i endX = _mm_add_epi32(startX, _mm_set1_epi32(1));
+    const __m128i endY = _mm_add_epi32(startY, _mm_set1_epi32(1));
+
+    // points in terrain space, and parametric from start coord to next point
+    const __m128 startXTS = _mm_mul_ps(_mm_cvtepi32_ps(startX), vinv);
+    const __m128 startYTS = _mm_mul_ps(_mm_cvtepi32_ps(startY), vinv);
+    const __m128 endXTS = _mm_mul_ps(_mm_cvtepi32_ps(endX), vinv);
+    const __m128 endYTS = _mm_mul_ps(_mm_cvtepi32_ps(endY), vinv);
+    const __m128 xParam = _mm_sub_ps(fx, _mm_cvtepi32_ps(startX));
+    const __m128 yParam = _mm_sub_ps(fy, _mm_cvtepi32_ps(startY));
+
+    // point-sampled heights of the 4 corners
+    int sx[4], sy[4];
+    float h0[4], h1[4], h2[4], h3[4];
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(sx), startX);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(sy), startY);
+    for (int lane = 0; lane < 4; lane++)
+    {
+        const float* row0 = &mHeightData[sy[lane] * mSize];
+        const float* row1 = row0 + mSize;
+        h0[lane] = row0[sx[lane]];
+        h1[lane] = row0[sx[lane] + 1];
+        h2[lane] = row1[sx[lane] + 1];
+        h3[lane] = row1[sx[lane]];
+    }
+    const __m128 v0z = _mm_loadu_ps(h0);
+    const __m128 v1z = _mm_loadu_ps(h1);
+    const __m128 v2z = _mm_loadu_ps(h2);
+    const __m128 v3z = _mm_loadu_ps(h3);
+
+    // pick the triangle; the odd row test is done in double precision like in the scalar code
+    const __m128 odd = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(startY, _mm_set1_epi32(1)), _mm_set1_epi32(1)));
+    const __m128d one = _mm_set1_pd(1.0);
+    const __m128d odd_lo = _mm_cmpgt_pd(_mm_sub_pd(one, _mm_cvtps_pd(yParam)), _mm_cvtps_pd(xParam));
+    const __m128d odd_hi = _mm_cmpgt_pd(_mm_sub_pd(one, _mm_cvtps_pd(_mm_movehl_ps(yParam, yParam))), _mm_cvtps_pd(_mm_movehl_ps(xParam, xParam)));
+    const __m128 second_odd = _mm_shuffle_ps(_mm_castpd_ps(odd_lo), _mm_castpd_ps(odd_hi), _MM_SHUFFLE(2, 0, 2, 0));
+    const __m128 second_even = _mm_cmpgt_ps(yParam, xParam);
+    const __m128 second = Select(odd, second_odd, second_even);
+
+    // plane through corners A, B, C:
+    //   odd + second: v0 v1 v3 | odd: v1 v2 v3 | even + second: v0 v2 v3 | even: v0 v1 v2
+    const __m128 a_is_v1 = _mm_andnot_ps(second, odd);
+    const __m128 b_is_v2 = _mm_xor_ps(odd, second);
+    const __m128 c_is_v2 = _mm_andnot_ps(_mm_or_ps(odd, second), _mm_castsi128_ps(_mm_set1_epi32(-1)));
+    const __m128 ax = Select(a_is_v1, endXTS, startXTS);
+    const __m128 ay = startYTS;
+    const __m128 az = Select(a_is_v1, v1z, v0z);
+    const __m128 bx = endXTS;
+    const __m128 by = Select(b_is_v2, endYTS, startYTS);
+    const __m128 bz = Select(b_is_v2, v2z, v1z);
+    const __m128 cx = Select(c_is_v2, endXTS, startXTS);
+    const __m128 cy = endYTS;
+    const __m128 cz = Select(c_is_v2, v2z, v3z);
+
+    const __m128 e1x = _mm_sub_ps(bx, ax), e1y = _mm_sub_ps(by, ay), e1z = _mm_sub_ps(bz, az);
+    const __m128 e2x = _mm_sub_ps(cx, ax), e2y = _mm_sub_ps(cy, ay), e2z = _mm_sub_ps(cz, az);
+    const __m128 nx = _mm_sub_ps(_mm_mul_ps(e1y, e2z), _mm_mul_ps(e1z, e2y));
+    const __m128 ny = _mm_sub_ps(_mm_mul_ps(e1z, e2x), _mm_mul_ps(e1x, e2z));
+    const __m128 nz = _mm_sub_ps(_mm_mul_ps(e1x, e2y), _mm_mul_ps(e1y, e2x));
+    const __m128 neg_d = _mm_add_ps(_mm_add_ps(_mm_mul_ps(nx, ax), _mm_mul_ps(ny, ay)), _mm_mul_ps(nz, az));
+    const __m128 neg_nx = _mm_xor_ps(nx, _mm_set1_ps(-0.f));
+
+    // Solve plane equation for z
+    const __m128 num = _mm_add_ps(_mm_sub_ps(_mm_mul_ps(neg_nx, vx), _mm_mul_ps(ny, vy)), neg_d);
+    _mm_storeu_ps(out_heights, _mm_div_ps(num, nz));
+}
+
+#else // ROR_TERRAIN_SSE2
+
+void TerrainGeometryManager::getHeightsAtTerrainPosition4(const float* x, const float* y, float* out_heights)
+{
+    for (int lane = 0; lane < 4; lane++)
+    {
+        out_heights[lane] = this->getHeightAtTerrainPosition(x[lane], y[lane]);
+    }
+}
+
+#endif // ROR_TERRAIN_SSE2
+
 float TerrainGeometryManager::getHeightAt(float x, float z)
 {
     if (m_spec->is_flat)
@@ -242,6 +348,48 @@ float TerrainGeometryManager::getHeightAt(float x, float z)
     return getHeightAtTerrainPosition(tx, ty);
 }
 
+void TerrainGeometryManager::getHeightsAt(const float* x, const float* z, float* out_heights, int count)
+{
+    if (m_spec->is_flat)
+    {
+        std::fill(out_heights, out_heights + count, 0.0f);
+        return;
+    }
+
+    int i = 0;
+    if (!mIsFlat)
+    {
+        for (; i + 4 <= count; i += 4)
+        {
+            float tx[4], ty[4];
+            bool inside = true;
+            for (int lane = 0; lane < 4; lane++)
+            {
+                tx[lane] = (x[i + lane] - mBase - mPos.x) / ((mSize - 1) *  mScale);
+                ty[lane] = (z[i + lane] + mBase - mPos.z) / ((mSize - 1) * -mScale);
+                inside = inside && tx[lane] > 0.0f && ty[lane] > 0.0f && tx[lane] < 1.0f && ty[lane] < 1.0f;
+            }
+
+            if (inside)
+            {
+                this->getHeightsAtTerrainPosition4(tx, ty, &out_heights[i]);
+            }
+            else
+            {
+                for (int lane = 0; lane < 4; lane++)
+                {
+                    out_heights[i + lane] = this->getHeightAt(x[i + lane], z[i + lane]);
+                }
+            }
+        }
+    }
+
+    for (; i < count; i++)
+    {
+        out_heights[i] = this->getHeightAt(x[i], z[i]);
+    }
+}
+
 Ogre::Vector3 TerrainGeometryManager::getNormalAt(float x, float y, float z)
 {
     const float precision = 0.1f;
@@ -250,6 +398,38 @@ Ogre::Vector3 TerrainGeometryManager::getNormalAt(float x, float y, float z)
     return normal;
 }
 
+void TerrainGeometryManager::getNormalsAt(const float* x, const float* y, const float* z, Ogre::Vector3* out_normals, int count)
+{
+    const float precision = 0.1f;
+    const int BLOCK_SIZE = 64; // Scratch lives on the stack; may be called from several threads
+    float sample_x[BLOCK_SIZE], sample_z[BLOCK_SIZE], left[BLOCK_SIZE], front[BLOCK_SIZE];
+
+    for (int begin = 0; begin < count; begin += BLOCK_SIZE)
+    {
+        const int n = std::min(BLOCK_SIZE, count - begin);
+        for (int i = 0; i < n; i++)
+        {
+            sample_x[i] = x[begin + i] - precision;
+            sample_z[i] = z[begin + i];
+        }
+        this->getHeightsAt(sample_x, sample_z, left, n);
+
+        for (int i = 0; i < n; i++)
+        {
+            sample_x[i] = x[begin + i];
+            sample_z[i] = z[begin + i] + precision;
+        }
+        this->getHeightsAt(sample_x, sample_z, front, n);
+
+        for (int i = 0; i < n; i++)
+        {
+            Vector3 normal(left[i] - y[begin + i], precision, y[begin + i] - front[i]);
+            normal.normalise();
+            out_normals[begin + i] = normal;
+        }
+    }
+}
+
 bool TerrainGeometryManager::InitTerrain(std::string otc_filename)
 {
     OTCParser otc_parser;
@@ -677,6 +857,38 @@ void TerrainGeometryManager::SetupGeometry(RoR::OTCPage& page, bool flat)
     }
 }
 
+bool TerrainGeometryManager::InitHeadless(int world_size, std::vector<float> heights)
+{
+    m_spec = std::make_shared<OTCFile>();
+    m_spec->world_size = world_size;
+    m_spec->world_size_x = world_size;
+    m_spec->world_size_z = world_size;
+    m_spec->is_flat = heights.empty();
+    if (m_spec->is_flat)
+    {
+        mMaxHeight = 0.0f;
+        return true;
+    }
+
+    // Same layout as `Ogre::Terrain::getHeightData()`: row-major, square, row 0 at the far (+Z) edge
+    mSize = static_cast<Ogre::uint16>(std::sqrt(static_cast<double>(heights.size())));
+    if (mSize < 2 || static_cast<size_t>(mSize) * mSize != heights.size())
+    {
+        RoR::LogFormat("[RoR|Terrain] Headless heightmap must be square, got %d samples", static_cast<int>(heights.size()));
+        return false;
+    }
+    m_headless_heights = std::move(heights);
+    mHeightData = m_headless_heights.data();
+    mBase = -world_size * 0.5f;
+    mScale = world_size / (Real)(mSize - 1);
+    mPos = Vector3(world_size * 0.5f, 0.0f, world_size * 0.5f);
+
+    mMinHeight = *std::min_element(m_headless_heights.begin(), m_headless_heights.end());
+    mMaxHeight = *std::max_element(m_headless_heights.begin(), m_headless_heights.end());
+    mIsFlat = std::abs(mMaxHeight - mMinHeight) < std::numeric_limits<float>::epsilon();
+    return true;
+}
+
 Ogre::Vector3 TerrainGeometryManager::getMaxTerrainSize()
 {
     return Vector3(m_spec->world_size_x, mMaxHeight, m_spec->world_size_z);
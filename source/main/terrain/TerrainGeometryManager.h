@@ -39,12 +39,15 @@ public:
     ~TerrainGeometryManager();
 
     bool InitTerrain(std::string otc_filename);
+    bool InitHeadless(int world_size, std::vector<float> heights); //!< Square heightmap without Ogre terrain (RoR_simbench); empty = flat
 
     Ogre::TerrainGroup* getTerrainGroup() { return m_ogre_terrain_group; };
 
     float getHeightAt(float x, float z);
+    void getHeightsAt(const float* x, const float* z, float* out_heights, int count); //!< Batched `getHeightAt()`, same results
 
     Ogre::Vector3 getNormalAt(float x, float y, float z);
+    void getNormalsAt(const float* x, const float* y, const float* z, Ogre::Vector3* out_normals, int count); //!< Batched `getNormalAt()`, same results
 
     Ogre::Vector3 getMaxTerrainSize();
 
@@ -56,6 +59,7 @@ public:
 private:
 
     float getHeightAtTerrainPosition(float x, float z);
+    void getHeightsAtTerrainPosition4(const float* x, const float* z, float* out_heights); //!< 4 positions, all inside the terrain
 
     bool getTerrainImage(int x, int y, Ogre::Image& img);
     bool loadTerrainConfig(Ogre::String filename);
@@ -77,6 +81,7 @@ private:
     Ogre::Real mScale;
     Ogre::uint16 mSize;
     float* mHeightData;
+    std::vector<float> m_headless_heights;
 
     bool  mIsFlat;
     float mMinHeight;
@@ -229,6 +229,25 @@ TerrainManager* TerrainManager::LoadAndPrepareTerrain(CacheEntry* entry)
     return terrn_mgr.release();
 }
 
+TerrainManager* TerrainManager::CreateHeadless(int world_size, std::vector<float> heights)
+{
+    auto terrn_mgr = std::unique_ptr<TerrainManager>(new TerrainManager(nullptr));
+    terrn_mgr->m_def.name = "simbench";
+    terrn_mgr->setGravity(DEFAULT_GRAVITY);
+
+    // No objects, sky, water or scripts - just what the physics queries
+    terrn_mgr->m_geometry_manager = new TerrainGeometryManager(terrn_mgr.get());
+    if (!terrn_mgr->m_geometry_manager->InitHeadless(world_size, std::move(heights)))
+    {
+        return nullptr; // Error already logged
+    }
+
+    terrn_mgr->m_collisions = new Collisions(terrn_mgr->getMaxTerrainSize());
+    terrn_mgr->m_collisions->finishLoadingTerrain();
+
+    return terrn_mgr.release();
+}
+
 void TerrainManager::initCamera()
 {
     App::GetCameraManager()->GetCamera()->getViewport()->setBackgroundColour(m_def.ambient_color);
@@ -508,6 +527,16 @@ Ogre::Vector3 TerrainManager::GetNormalAt(float x, float y, float z)
     return m_geometry_manager->getNormalAt(x, y, z);
 }
 
+void TerrainManager::GetHeightsAt(const float* x, const float* z, float* out_heights, int count)
+{
+    m_geometry_manager->getHeightsAt(x, z, out_heights, count);
+}
+
+void TerrainManager::GetNormalsAt(const float* x, const float* y, const float* z, Ogre::Vector3* out_normals, int count)
+{
+    m_geometry_manager->getNormalsAt(x, y, z, out_normals, count);
+}
+
 SkyManager* TerrainManager::getSkyManager()
 {
     return m_sky_manager;
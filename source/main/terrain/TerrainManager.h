@@ -36,6 +36,7 @@ public:
     static const int UNLIMITED_SIGHTRANGE = 4999;
 
     static TerrainManager* LoadAndPrepareTerrain(CacheEntry* entry); //!< Factory function
+    static TerrainManager* CreateHeadless(int world_size, std::vector<float> heights); //!< Geometry + collisions only, for RoR_simbench
 
     TerrainManager(CacheEntry* entry);
     ~TerrainManager();
@@ -78,7 +79,9 @@ public:
     void                    setGravity(float value);
     float                   getGravity() const            { return m_cur_gravity; }
     float                   GetHeightAt(float x, float z);
+    void                    GetHeightsAt(const float* x, const float* z, float* out_heights, int count);
     Ogre::Vector3           GetNormalAt(float x, float y, float z);
+    void                    GetNormalsAt(const float* x, const float* y, const float* z, Ogre::Vector3* out_normals, int count);
     Ogre::Vector3           getMaxTerrainSize();
     Ogre::AxisAlignedBox    getTerrainCollisionAAB();
 
@@ -19,18 +19,35 @@ along with Rigs of Rods.  If not, see <http://www.gnu.org/licenses/>.
 
 #pragma once
 
-#include "Application.h"
+// NOTE: Only depends on the standard library, so that microbenchmarks can use it directly.
 
+#include <algorithm>
 #include <atomic>
+#include <cassert>
 #include <condition_variable>
 #include <functional>
 #include <memory>
 #include <mutex>
-#include <queue>
+#include <string>
 #include <thread>
-#include <stdexcept>
 #include <vector>
 
+#ifdef ROR_PROFILER
+    #include "Profiler.h" // Timeline capture of workers and jobs
+#elif !defined(ROR_PROFILE_EVENT)
+    #define ROR_PROFILE_EVENT(NAME)
+    #define ROR_PROFILE_THREAD_NAME(NAME)
+#endif
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    #include <intrin.h>
+    #define ROR_CPU_RELAX() _mm_pause()
+#elif defined(__i386__) || defined(__x86_64__)
+    #define ROR_CPU_RELAX() __builtin_ia32_pause()
+#else
+    #define ROR_CPU_RELAX() std::this_thread::yield()
+#endif
+
 namespace RoR {
 
 /** /brief Handle for a task executed by ThreadPool
@@ -66,103 +83,220 @@ class Task
         m_finish_cv.wait(lock, [this]{ return m_is_finished; });
     }
 
-    private:
-    // Only constructable by friend class ThreadPool
-    Task(std::function<void()> task_func) : m_task_func(task_func) {}
+    /// Only obtainable by friend class ThreadPool, which makes Task effectively only constructable by it.
+    class PassKey { friend class ThreadPool; PassKey() {} };
+
+    Task(PassKey, std::function<void()> task_func) : m_task_func(std::move(task_func)) {}
     Task(Task &) = delete;
     Task & operator=(Task &) = delete;
 
+    private:
     bool m_is_finished = false;                   //!< Indicates whether the task execution has finished.
     mutable std::condition_variable m_finish_cv;  //!< Used to signal the current thread when the task has finished.
     mutable std::mutex m_task_mutex;              //!< Mutex which is locked while the task is running.
     const std::function<void()> m_task_func;      //!< Callable object which implements the task to execute.
+    std::shared_ptr<Task> m_self;                 //!< Reference held by the queue until the task ran.
+};
+
+/** \brief Recycles the memory of released Task objects (together with their shared_ptr control block).
+ *
+ * Used with `std::allocate_shared()`, so that ThreadPool::RunTask() doesn't touch the heap once warmed up.
+ * Blocks are kept on a process-wide free list and never returned to the system - their number is bounded
+ * by the most tasks ever alive at once. The list outlives every ThreadPool, so task handles may, too.
+ */
+template <typename T>
+class TaskAllocator
+{
+public:
+    typedef T value_type;
+
+    TaskAllocator() {}
+    template <typename U> TaskAllocator(const TaskAllocator<U>&) {}
+
+    T* allocate(size_t n)
+    {
+        if (n == 1)
+        {
+            std::lock_guard<std::mutex> lock(FreeListMutex());
+            if (Block* block = FreeListHead())
+            {
+                FreeListHead() = block->next;
+                return reinterpret_cast<T*>(block);
+            }
+        }
+        return static_cast<T*>(::operator new(n * sizeof(T)));
+    }
+
+    void deallocate(T* p, size_t n)
+    {
+        if (n == 1)
+        {
+            std::lock_guard<std::mutex> lock(FreeListMutex());
+            Block* block = reinterpret_cast<Block*>(p);
+            block->next = FreeListHead();
+            FreeListHead() = block;
+            return;
+        }
+        ::operator delete(p);
+    }
+
+    template <typename U> bool operator==(const TaskAllocator<U>&) const { return true; }
+    template <typename U> bool operator!=(const TaskAllocator<U>&) const { return false; }
+
+private:
+    struct Block { Block* next; };
+    static_assert(sizeof(T) >= sizeof(Block), "Pooled blocks must be able to hold the free list link");
+
+    // Intentionally leaked, so that handles released during static destruction still find them.
+    static std::mutex& FreeListMutex() { static std::mutex* mutex = new std::mutex(); return *mutex; }
+    static Block*&     FreeListHead()  { static Block* head = nullptr; return head; }
+};
+
+/** \brief Unit of work stored in the scheduler queues.
+ *
+ * Plain data, copied by value into preallocated queue slots, so submitting work never touches the heap.
+ */
+struct Job
+{
+    void              (*func)(void* ctx, int begin, int end); //!< Entry point
+    void*             ctx;                                    //!< Callable object or Task
+    int               begin;                                  //!< Index range for ParallelFor() chunks
+    int               end;
+    std::atomic<int>* pending;                                //!< Counter of the owning batch, decremented when done; may be null.
+};
+
+/** \brief Fixed-size double-ended job queue owned by one worker thread.
+ *
+ * The owner pushes and pops at the back (LIFO, cache-warm), other threads steal from the front (FIFO).
+ * Guarded by a spinlock - critical sections are a few loads and stores, so contention stays negligible.
+ */
+class WorkQueue
+{
+public:
+    static const int CAPACITY = 1024; //!< Power of 2
+
+    bool Push(const Job& job)
+    {
+        this->Lock();
+        const bool ok = (m_back - m_front) < CAPACITY;
+        if (ok)
+        {
+            m_jobs[m_back & (CAPACITY - 1)] = job;
+            m_back++;
+        }
+        this->Unlock();
+        return ok;
+    }
+
+    /// @param only_batch If not null, the newest job belonging to this batch is taken, wherever it is in the queue.
+    bool PopBack(Job& out, const std::atomic<int>* only_batch)
+    {
+        this->Lock();
+        bool ok = false;
+        for (size_t pos = m_back; pos != m_front; --pos)
+        {
+            if (only_batch == nullptr || m_jobs[(pos - 1) & (CAPACITY - 1)].pending == only_batch)
+            {
+                out = m_jobs[(pos - 1) & (CAPACITY - 1)];
+                for (size_t i = pos; i != m_back; ++i) // Close the gap
+                {
+                    m_jobs[(i - 1) & (CAPACITY - 1)] = m_jobs[i & (CAPACITY - 1)];
+                }
+                m_back--;
+                ok = true;
+                break;
+            }
+        }
+        this->Unlock();
+        return ok;
+    }
+
+    /// @param only_batch If not null, the oldest job belonging to this batch is taken, wherever it is in the queue.
+    bool StealFront(Job& out, const std::atomic<int>* only_batch)
+    {
+        this->Lock();
+        bool ok = false;
+        for (size_t pos = m_front; pos != m_back; ++pos)
+        {
+            if (only_batch == nullptr || m_jobs[pos & (CAPACITY - 1)].pending == only_batch)
+            {
+                out = m_jobs[pos & (CAPACITY - 1)];
+                for (size_t i = pos; i != m_front; --i) // Close the gap
+                {
+                    m_jobs[i & (CAPACITY - 1)] = m_jobs[(i - 1) & (CAPACITY - 1)];
+                }
+                m_front++;
+                ok = true;
+                break;
+            }
+        }
+        this->Unlock();
+        return ok;
+    }
+
+private:
+    void Lock()   { while (m_lock.exchange(true, std::memory_order_acquire)) { ROR_CPU_RELAX(); } }
+    void Unlock() { m_lock.store(false, std::memory_order_release); }
+
+    std::atomic<bool> m_lock{false};
+    size_t            m_front = 0;
+    size_t            m_back = 0;
+    Job               m_jobs[CAPACITY];
 };
 
 /** \brief Facilitates execution of (small) tasks on separate threads.
  *
- * Implements a "rent-a-thread" model where each submitted task is assigned to one of several worker threads managed by the thread pool instance.
- * This is especially useful for short running tasks as it avoids the runtime cost of creating and launching a new thread. Notice, there
- * still is a certain overhead present due to the synchronization of threads required in the internal implementation.
+ * Work-stealing scheduler: every worker thread owns a WorkQueue and, when it runs dry, steals from the others.
+ * Idle workers spin briefly, then yield, then park on a condition variable - so back-to-back batches
+ * (i.e. physics substeps) are picked up without a wakeup round-trip, while an idle pool costs no CPU.
+ * Threads which wait for a batch (Parallelize(), ParallelFor()) help executing it instead of blocking.
  *
  * Usage example 1:
  * \code
- *  ThreadPool tp;
+ *  ThreadPool tp(4);
  *  auto task_handle = tp.RunTask([]{ SomeWork() };  // Start asynchronous task
  *  SomeOtherWork();
- *  task_handle.join(); // Wait for async task to finish
+ *  task_handle->join(); // Wait for async task to finish
  * \endcode
  *
  * Usage example 2:
  * \code
- *  ThreadPool tp;
+ *  ThreadPool tp(4);
  *  auto task1 = []{ ... };
  *  auto task2 = std::bind(my_func, arg1, arg2);
  *  tp.Parallelize({task1, task2});  // Run tasks in parallel and wait until all have finished
  * \endcode
  *
+ * Usage example 3:
+ * \code
+ *  ThreadPool tp(4);
+ *  tp.ParallelFor(0, num_items, 16, [&](int i){ Process(items[i]); }); // Chunks of 16 items, waits until all are done
+ * \endcode
+ *
  * \see Task
  */
 class ThreadPool {
 public:
-    static ThreadPool* DetectNumWorkersAndCreate()
-    {
-        // Create general-purpose thread pool
-        int logical_cores = std::thread::hardware_concurrency();
-
-        int num_threads = App::app_num_workers->GetInt();
-        if (num_threads < 1 || num_threads > logical_cores)
-        {
-            num_threads = Ogre::Math::Clamp(logical_cores - 1, 1, 8);
-            App::app_num_workers->SetVal(num_threads);
-        }
-
-        RoR::LogFormat("[RoR|ThreadPool] Found %d logical CPU cores, creating %d worker threads",
-                  logical_cores, num_threads);
-
-        return new ThreadPool(num_threads);
-    }
+    static const int SPIN_COUNT = 256;   //!< Idle worker: busy-wait iterations before yielding
+    static const int YIELD_COUNT = 2000; //!< Idle worker: yield iterations before parking
 
     /** \brief Construct thread pool and launch worker threads.
      *
      * @param num_threads Number of worker threads to use
+     * @param name Of the worker threads, in profiler captures
      */
-    ThreadPool(int num_threads)
-    {
-        ROR_ASSERT(num_threads > 0);
-
-        // Generic function (to be run on a separate thread) within which submitted tasks
-        // are executed. It implements an endless loop (only returning when the ThreadPool
-        // instance itself is destructed) which constantly checks the task queue, grabbing
-        // and executing the frontmost task while the queue is not empty.
-        auto thread_body = [this]{ 
-            while (true) {
-                // Get next task from queue (synchronized access via taskqueue_mutex).
-                // If the queue is empty wait until either
-                //   - being signaled about an available task.
-                //   - the terminate flag is true (i.e. the ThreadPool instance is being destructed).
-                //     In this case return from the running thread.
-                std::unique_lock<std::mutex> queue_lock(m_taskqueue_mutex);
-                while (m_taskqueue.empty()) {
-                    if (m_terminate.load()) { return; }
-                    m_task_available_cv.wait(queue_lock);
-                }
-                const auto current_task = m_taskqueue.front();
-                m_taskqueue.pop();
-                queue_lock.unlock();
+    ThreadPool(int num_threads, const char* name = "Worker")
+        : m_name(name)
+    {
+        assert(num_threads > 0);
 
-                // Execute the actual task and signal the associated Task instance when finished.
-                {
-                    std::lock_guard<std::mutex> task_lock(current_task->m_task_mutex);
-                    current_task->m_task_func();
-                    current_task->m_is_finished = true;
-                }
-                current_task->m_finish_cv.notify_all();
-            }
-        };
+        for (int i = 0; i < num_threads; ++i) {
+            m_queues.emplace_back(new WorkQueue());
+        }
 
         // Launch the specified number of threads
         for (int i = 0; i < num_threads; ++i) {
-            m_threads.emplace_back(thread_body);
+            m_threads.emplace_back([this, i]{ this->WorkerMain(i); });
         }
     }
 
@@ -170,51 +304,219 @@ public:
         // Indicate termination and signal potential waiting threads to wake up.
         // Then wait for all threads to finish their work and return properly.
         m_terminate = true;
-        m_task_available_cv.notify_all();
+        {
+            std::lock_guard<std::mutex> lock(m_park_mutex);
+            m_park_cv.notify_all();
+        }
         for (auto &t : m_threads) { t.join(); }
     }
 
+    int GetNumWorkers() const { return static_cast<int>(m_threads.size()); }
+
+    /// Index of the calling worker thread in [0, GetNumWorkers()), or -1 for threads outside of this pool.
+    int GetCurrentWorker() const { return (TlsPool() == this) ? TlsWorker() : -1; }
+
     /// Submit new asynchronous task to thread pool and return Task handle to allow for synchronization.
-    std::shared_ptr<Task> RunTask(const std::function<void()> &task_func) {
-        // Wrap provided task callable object in task handle. Then append it to the task queue and
-        // notify a waiting worker thread (if any) about the newly available task
-        auto task = std::shared_ptr<Task>(new Task(task_func));
-        {
-            std::lock_guard<std::mutex> lock(m_taskqueue_mutex);
-            m_taskqueue.push(task);
-        }
-        m_task_available_cv.notify_one();
+    std::shared_ptr<Task> RunTask(std::function<void()> task_func) {
+        // Wrap provided task callable object in a pooled task handle; the queue holds a reference until the task ran.
+        auto task = std::allocate_shared<Task>(TaskAllocator<Task>(), Task::PassKey(), std::move(task_func));
+        task->m_self = task;
+
+        Job job;
+        job.func = &ThreadPool::RunTaskJob;
+        job.ctx = task.get();
+        job.begin = 0;
+        job.end = 0;
+        job.pending = nullptr;
+        this->Submit(job);
 
         // Return task handle for later synchronization
         return task;
     }
 
     /// Run collection of tasks in parallel and wait until all have finished.
+    /// The first task runs on the calling thread.
     void Parallelize(const std::vector<std::function<void()>> &task_funcs)
     {
-        if (task_funcs.empty()) return;
+        this->ParallelFor(0, static_cast<int>(task_funcs.size()), 1, [&task_funcs](int i) { task_funcs[i](); });
+    }
+
+    /** \brief Invoke `fn(i)` for every `i` in [begin, end) in parallel and wait until all calls have finished.
+     *
+     * The range is cut into chunks of `grain` indices; the first chunk runs on the calling thread,
+     * which then helps with the remaining ones. Does not allocate.
+     */
+    template <typename F>
+    void ParallelFor(int begin, int end, int grain, const F& fn)
+    {
+        if (end <= begin) return;
+        grain = std::max(grain, 1);
+
+        const int num_chunks = (end - begin + grain - 1) / grain;
+        std::atomic<int> pending(num_chunks - 1);
+        for (int c = 1; c < num_chunks; ++c)
+        {
+            Job job;
+            job.func = &ThreadPool::RunRange<F>;
+            job.ctx = const_cast<void*>(static_cast<const void*>(&fn));
+            job.begin = begin + c * grain;
+            job.end = std::min(end, job.begin + grain);
+            job.pending = &pending;
+            this->Submit(job);
+        }
+
+        // Run the first chunk locally, then help with the rest
+        ThreadPool::RunRange<F>(const_cast<void*>(static_cast<const void*>(&fn)), begin, std::min(end, begin + grain));
+        this->WaitFor(pending);
+    }
+
+private:
+    template <typename F>
+    static void RunRange(void* ctx, int begin, int end)
+    {
+        const F& fn = *static_cast<const F*>(ctx);
+        for (int i = begin; i < end; ++i) { fn(i); }
+    }
+
+    static void RunTaskJob(void* ctx, int, int)
+    {
+        // Execute the actual task and signal the associated Task instance when finished.
+        Task& task = *static_cast<Task*>(ctx);
+        std::shared_ptr<Task> self = std::move(task.m_self); // Released on return
+        {
+            std::lock_guard<std::mutex> task_lock(task.m_task_mutex);
+            task.m_task_func();
+            task.m_is_finished = true;
+        }
+        task.m_finish_cv.notify_all();
+    }
+
+    static void RunJob(const Job& job)
+    {
+        ROR_PROFILE_EVENT("Job");
+        job.func(job.ctx, job.begin, job.end);
+        if (job.pending)
+        {
+            job.pending->fetch_sub(1, std::memory_order_release);
+        }
+    }
+
+    // Per-thread identity, so that workers push to (and pop from) their own queue.
+    static ThreadPool*& TlsPool()   { static thread_local ThreadPool* pool = nullptr; return pool; }
+    static int&         TlsWorker() { static thread_local int worker = -1; return worker; }
+
+    void Submit(const Job& job)
+    {
+        int target = this->GetCurrentWorker();
+        if (target == -1)
+        {
+            target = static_cast<int>(m_next_queue.fetch_add(1, std::memory_order_relaxed) % m_queues.size());
+        }
+
+        if (!m_queues[target]->Push(job))
+        {
+            ThreadPool::RunJob(job); // Queue full - do it right here
+            return;
+        }
 
-        // Launch all provided tasks (except for the first) in parallel and store the associated handles
-        auto it = begin(task_funcs);
-        const auto first_task = it++;
-        std::vector<std::shared_ptr<Task>> handles;
-        for(; it != end(task_funcs); ++it)
-        { 
-            handles.push_back(RunTask(*it));
+        m_num_queued.fetch_add(1);
+        if (m_num_parked.load() > 0)
+        {
+            std::lock_guard<std::mutex> lock(m_park_mutex);
+            m_park_cv.notify_one();
         }
+    }
 
-        // Run the first task locally on the current thread
-        (*first_task)();
+    /// @param only_batch If not null, only jobs belonging to this batch are considered.
+    bool FindJob(Job& out, const std::atomic<int>* only_batch)
+    {
+        const int self = this->GetCurrentWorker();
+        if (self != -1 && m_queues[self]->PopBack(out, only_batch))
+        {
+            m_num_queued.fetch_sub(1);
+            return true;
+        }
 
-        // Synchronize, i.e. wait for all parallelized tasks to complete
-        for(const auto &h : handles) { h->join(); }
+        const int num_queues = static_cast<int>(m_queues.size());
+        const int start = (self != -1) ? (self + 1) : 0;
+        for (int i = 0; i < num_queues; ++i)
+        {
+            const int victim = (start + i) % num_queues;
+            if (victim != self && m_queues[victim]->StealFront(out, only_batch))
+            {
+                m_num_queued.fetch_sub(1);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /// Executes jobs of the given batch until all of them have finished.
+    /// Jobs of the batch are searched in whole queues: other jobs may have been pushed on top of them meanwhile,
+    /// i.e. tasks submitted while a task waits for its nested ParallelFor(). Every unfinished job of the batch
+    /// is either queued (and found here) or running, so the wait always ends; unrelated jobs are left
+    /// to the workers, so the waiter doesn't get stuck in a long task.
+    void WaitFor(std::atomic<int>& pending)
+    {
+        while (pending.load(std::memory_order_acquire) > 0)
+        {
+            Job job;
+            if (this->FindJob(job, &pending))
+                ThreadPool::RunJob(job);
+            else
+                ROR_CPU_RELAX();
+        }
+    }
+
+    void WorkerMain(int index)
+    {
+        TlsPool() = this;
+        TlsWorker() = index;
+        ROR_PROFILE_THREAD_NAME(m_name + " " + std::to_string(index));
+
+        int idle_count = 0;
+        while (true)
+        {
+            Job job;
+            if (this->FindJob(job, nullptr))
+            {
+                ThreadPool::RunJob(job);
+                idle_count = 0;
+                continue;
+            }
+
+            if (m_terminate.load()) { return; }
+
+            // Spin, then yield, then park until something gets submitted
+            ++idle_count;
+            if (idle_count < SPIN_COUNT)
+            {
+                ROR_CPU_RELAX();
+            }
+            else if (idle_count < SPIN_COUNT + YIELD_COUNT)
+            {
+                std::this_thread::yield();
+            }
+            else
+            {
+                std::unique_lock<std::mutex> lock(m_park_mutex);
+                m_num_parked.fetch_add(1);
+                m_park_cv.wait(lock, [this]{ return m_num_queued.load() > 0 || m_terminate.load(); });
+                m_num_parked.fetch_sub(1);
+                idle_count = 0;
+            }
+        }
     }
 
-    std::atomic_bool m_terminate{false};            //!< Indicates destruction of ThreadPool instance to worker threads
-    std::vector<std::thread> m_threads;             //!< Collection of worker threads to run tasks
-    std::queue<std::shared_ptr<Task>> m_taskqueue;  //!< Queue of submitted tasks pending for execution
-    std::mutex m_taskqueue_mutex;                   //!< Protects task queue from concurrent access.
-    std::condition_variable m_task_available_cv;    //!< Used to signal threads that a new task was submitted and is ready to run.
+    std::atomic_bool m_terminate{false};                   //!< Indicates destruction of ThreadPool instance to worker threads
+    std::vector<std::thread> m_threads;                    //!< Collection of worker threads to run tasks
+    std::string              m_name;
+    std::vector<std::unique_ptr<WorkQueue>> m_queues;      //!< One job queue per worker thread
+    std::atomic<unsigned> m_next_queue{0};                 //!< Round-robin target for jobs submitted from outside the pool
+    std::atomic<int> m_num_queued{0};                      //!< Jobs sitting in queues (not yet picked up)
+    std::atomic<int> m_num_parked{0};                      //!< Workers sleeping on `m_park_cv`
+    std::mutex m_park_mutex;                               //!< Guards parking, so that no wakeup gets lost.
+    std::condition_variable m_park_cv;                     //!< Used to wake parked workers when a new job was submitted.
 };
 
-} // namespace RoR
\ No newline at end of file
+} // namespace RoR
@@ -33,7 +33,10 @@
 #else
     #include <sys/types.h>
     #include <sys/stat.h>
+    #include <sys/mman.h> // mmap()
+    #include <fcntl.h> // open()
     #include <unistd.h> // readlink()
+    #include <cstdio> // rename()
 #endif
 
 #include <OgrePlatform.h>
@@ -121,6 +124,13 @@ void CreateFolder(const char* path)
     }
 }
 
+bool RenameFile(const char* from, const char* to)
+{
+    std::wstring wfrom = MSW_Utf8ToWchar(from);
+    std::wstring wto = MSW_Utf8ToWchar(to);
+    return MoveFileExW(wfrom.c_str(), wto.c_str(), MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH) != 0;
+}
+
 std::string GetUserHomeDirectory()
 {
     std::wstring out_wstr(MAX_PATH, 0); // Length limit imposed by the function, see https://msdn.microsoft.com/en-us/library/windows/desktop/bb762181(v=vs.85).aspx
@@ -148,6 +158,68 @@ std::string GetExecutablePath()
     return MSW_WcharToUtf8(out_wstr.c_str());
 }
 
+bool GetFileSizeAndTime(std::string const& path, uint64_t& out_size, std::time_t& out_mtime)
+{
+    if (path.empty())
+    {
+        return false;
+    }
+
+    WIN32_FILE_ATTRIBUTE_DATA data;
+    std::wstring wpath = MSW_Utf8ToWchar(path.c_str());
+    if (!GetFileAttributesExW(wpath.c_str(), GetFileExInfoStandard, &data) || (data.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY))
+    {
+        return false;
+    }
+
+    out_size = (uint64_t(data.nFileSizeHigh) << 32) | data.nFileSizeLow;
+    const uint64_t filetime = (uint64_t(data.ftLastWriteTime.dwHighDateTime) << 32) | data.ftLastWriteTime.dwLowDateTime;
+    out_mtime = static_cast<std::time_t>((filetime - 116444736000000000ull) / 10000000ull); // 100ns ticks since 1601 -> seconds since 1970
+    return true;
+}
+
+bool MappedFile::Open(const char* path)
+{
+    this->Close();
+    std::wstring wpath = MSW_Utf8ToWchar(path);
+    HANDLE file = CreateFileW(wpath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        return false;
+    }
+
+    LARGE_INTEGER size;
+    HANDLE mapping = nullptr;
+    if (GetFileSizeEx(file, &size) && size.QuadPart > 0)
+    {
+        mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    }
+    CloseHandle(file);
+    if (mapping == nullptr)
+    {
+        return false;
+    }
+
+    m_data = static_cast<const char*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+    CloseHandle(mapping); // The view keeps the mapping alive
+    if (m_data == nullptr)
+    {
+        return false;
+    }
+    m_size = static_cast<size_t>(size.QuadPart);
+    return true;
+}
+
+void MappedFile::Close()
+{
+    if (m_data != nullptr)
+    {
+        UnmapViewOfFile(m_data);
+        m_data = nullptr;
+        m_size = 0;
+    }
+}
+
 #else
 
 // -------------------------- File/path utils for Linux/*nix --------------------------
@@ -171,6 +243,11 @@ void CreateFolder(const char* path)
     mkdir(path, S_IRWXU | S_IRWXG | S_IROTH | S_IXOTH);
 }
 
+bool RenameFile(const char* from, const char* to)
+{
+    return rename(from, to) == 0;
+}
+
 std::string GetUserHomeDirectory()
 {
     return getenv("HOME");
@@ -190,6 +267,55 @@ std::string GetExecutablePath()
     return std::move(buf_str);
 }
 
+bool GetFileSizeAndTime(std::string const& path, uint64_t& out_size, std::time_t& out_mtime)
+{
+    struct stat st;
+    if (stat(path.c_str(), &st) != 0 || !S_ISREG(st.st_mode))
+    {
+        return false;
+    }
+
+    out_size = static_cast<uint64_t>(st.st_size);
+    out_mtime = st.st_mtime;
+    return true;
+}
+
+bool MappedFile::Open(const char* path)
+{
+    this->Close();
+    int fd = open(path, O_RDONLY);
+    if (fd == -1)
+    {
+        return false;
+    }
+
+    struct stat st;
+    void* data = MAP_FAILED;
+    if (fstat(fd, &st) == 0 && st.st_size > 0)
+    {
+        data = mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+    }
+    close(fd); // The mapping stays valid
+    if (data == MAP_FAILED)
+    {
+        return false;
+    }
+
+    m_data = static_cast<const char*>(data);
+    m_size = static_cast<size_t>(st.st_size);
+    return true;
+}
+
+void MappedFile::Close()
+{
+    if (m_data != nullptr)
+    {
+        munmap(const_cast<char*>(m_data), m_size);
+        m_data = nullptr;
+        m_size = 0;
+    }
+}
+
 #endif // _MSC_VER
 
 // -------------------------- File/path common utils --------------------------
@@ -30,6 +30,8 @@
 
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
 #include <string>
 #include <ctime>
 
@@ -40,10 +42,12 @@ extern char PATH_SLASH;
 bool FileExists(const char* path);   //!< Path must be UTF-8 encoded.
 bool FolderExists(const char* path); //!< Path must be UTF-8 encoded.
 void CreateFolder(const char* path); //!< Path must be UTF-8 encoded.
+bool RenameFile(const char* from, const char* to); //!< Paths must be UTF-8 encoded. Replaces `to` if it exists, in one step.
 
 inline bool FileExists(std::string const& path)   { return FileExists(path.c_str()); }
 inline bool FolderExists(std::string const& path) { return FolderExists(path.c_str()); }
 inline void CreateFolder(std::string const& path) { CreateFolder(path.c_str()); }
+inline bool RenameFile(std::string const& from, std::string const& to) { return RenameFile(from.c_str(), to.c_str()); }
 
 inline std::string PathCombine(std::string a, std::string b) { return a + PATH_SLASH + b; };
 
@@ -52,5 +56,26 @@ std::string GetExecutablePath(); //!< Returns UTF-8 path or empty string on erro
 std::string GetParentDirectory(const char* path); //!< Returns UTF-8 path without trailing slash.
 
 std::time_t GetFileLastModifiedTime(std::string const & path);
+bool GetFileSizeAndTime(std::string const& path, uint64_t& out_size, std::time_t& out_mtime); //!< Path must be UTF-8 encoded. False if it's not a file.
+
+/// Read-only memory mapping of a whole file; unmapped on destruction.
+class MappedFile
+{
+public:
+    MappedFile() {}
+    ~MappedFile() { this->Close(); }
+
+    bool        Open(const char* path); //!< Path must be UTF-8 encoded. Fails on empty files.
+    void        Close();
+    const char* GetData() const { return m_data; } //!< Null if not open
+    size_t      GetSize() const { return m_size; }
+
+private:
+    MappedFile(MappedFile const&) = delete;
+    MappedFile& operator=(MappedFile const&) = delete;
+
+    const char* m_data = nullptr;
+    size_t      m_size = 0;
+};
 
 } // namespace RoR
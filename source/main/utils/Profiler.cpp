@@ -0,0 +1,423 @@
+/*
+    This source file is part of Rigs of Rods
+    Copyright 2026 Rigs of Rods contributors
+
+    For more information, see http://www.rigsofrods.org/
+
+    Rigs of Rods is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License version 3, as
+    published by the Free Software Foundation.
+
+    Rigs of Rods is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Rigs of Rods. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "Profiler.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+using namespace RoR;
+
+namespace {
+
+struct ZoneDef
+{
+    const char*  name;
+    ProfilerZone parent;
+};
+
+const ZoneDef ZONE_DEFS[] =
+{
+    { "Frame",              ProfilerZone::FRAME            },
+    { "Physics",            ProfilerZone::FRAME            },
+    { "Prepare",            ProfilerZone::PHYSICS          },
+    { "Compute",            ProfilerZone::PHYSICS          },
+    { "CalcNodes",          ProfilerZone::PHYSICS_COMPUTE  },
+    { "CalcBeams",          ProfilerZone::PHYSICS_COMPUTE  },
+    { "CalcWheels",         ProfilerZone::PHYSICS_COMPUTE  },
+    { "CalcHydros",         ProfilerZone::PHYSICS_COMPUTE  },
+    { "CalcCommands",       ProfilerZone::PHYSICS_COMPUTE  },
+    { "Inter-actor coll.",  ProfilerZone::PHYSICS          },
+    { "UpdateSimDataBuffer",ProfilerZone::FRAME            },
+    { "Flexbodies",         ProfilerZone::FRAME            },
+    { "Rendering",          ProfilerZone::FRAME            },
+};
+static_assert(sizeof(ZONE_DEFS) / sizeof(ZONE_DEFS[0]) == Profiler::NUM_ZONES, "ZONE_DEFS must match ProfilerZone");
+
+struct CaptureEvent
+{
+    const char* name;
+    uint64_t    begin;
+    uint64_t    end;
+};
+
+// Only the owning thread writes, so plain load+store is enough; `EndFrame()` may read a value one sample old.
+struct ThreadCounters
+{
+    std::atomic<uint64_t> ticks[Profiler::NUM_ZONES];
+    std::atomic<uint32_t> calls[Profiler::NUM_ZONES];
+
+    char                  name[32];
+    std::atomic<bool>     has_name;
+
+    // Timeline capture; the owner resets its buffer when it sees a new capture ID
+    std::atomic<uint32_t> capture_id;
+    std::atomic<size_t>   num_events;       //!< Events below this index are complete
+    std::atomic<size_t>   num_dropped;
+    std::atomic<CaptureEvent*> events;      //!< Allocated on the first event, see `g_capture_buffers`
+};
+
+// Gives the slot back when its thread exits, so short-lived threads don't use up `MAX_THREADS`.
+// The totals stay in the slot and the next owner adds to them, which keeps `EndFrame()` deltas valid.
+struct ThreadSlotRelease
+{
+    ThreadCounters* counters = nullptr;
+    ~ThreadSlotRelease();
+};
+
+ThreadCounters             g_thread_counters[Profiler::MAX_THREADS]; // Zeroed static storage
+std::atomic<size_t>        g_num_threads(0);                         // Slots ever used
+std::mutex                 g_free_slots_mutex;
+std::vector<size_t>        g_free_slots;                             // Released by exited threads
+thread_local ThreadCounters* t_counters = nullptr;
+thread_local bool          t_registered = false;
+thread_local ThreadSlotRelease t_slot_release;                       // Only touched on registration
+
+std::unique_ptr<CaptureEvent[]> g_capture_buffers[Profiler::MAX_THREADS]; // Owners of `ThreadCounters::events`
+std::atomic<bool>          g_capturing(false);
+std::atomic<uint32_t>      g_capture_id(0);
+uint64_t                   g_capture_start = 0;
+
+// Main thread only
+Profiler::FrameStats       g_history[Profiler::HISTORY_SIZE];
+uint64_t                   g_num_frames = 0;
+uint64_t                   g_prev_ticks[Profiler::NUM_ZONES] = {};
+uint32_t                   g_prev_calls[Profiler::NUM_ZONES] = {};
+const uint64_t             g_start_ticks = Profiler::Now();
+
+const double TICKS_TO_SEC = static_cast<double>(Profiler::Clock::period::num) / Profiler::Clock::period::den;
+
+ThreadCounters* GetThreadCounters()
+{
+    if (!t_registered)
+    {
+        t_registered = true;
+        std::lock_guard<std::mutex> lock(g_free_slots_mutex);
+        if (!g_free_slots.empty())
+        {
+            t_counters = &g_thread_counters[g_free_slots.back()];
+            g_free_slots.pop_back();
+        }
+        else if (g_num_threads.load() < Profiler::MAX_THREADS)
+        {
+            t_counters = &g_thread_counters[g_num_threads.fetch_add(1)];
+        }
+        t_slot_release.counters = t_counters;
+    }
+    return t_counters;
+}
+
+ThreadSlotRelease::~ThreadSlotRelease()
+{
+    if (counters)
+    {
+        counters->has_name.store(false, std::memory_order_release);
+        std::lock_guard<std::mutex> lock(g_free_slots_mutex);
+        g_free_slots.push_back(static_cast<size_t>(counters - g_thread_counters));
+    }
+}
+
+} // namespace
+
+const char* Profiler::GetZoneName(ProfilerZone zone)
+{
+    return ZONE_DEFS[static_cast<size_t>(zone)].name;
+}
+
+ProfilerZone Profiler::GetZoneParent(ProfilerZone zone)
+{
+    return ZONE_DEFS[static_cast<size_t>(zone)].parent;
+}
+
+int Profiler::GetZoneDepth(ProfilerZone zone)
+{
+    int depth = 0;
+    while (zone != ProfilerZone::FRAME)
+    {
+        zone = GetZoneParent(zone);
+        depth++;
+    }
+    return depth;
+}
+
+void Profiler::AddSample(ProfilerZone zone, uint64_t ticks)
+{
+    ThreadCounters* counters = GetThreadCounters();
+    if (counters)
+    {
+        const size_t z = static_cast<size_t>(zone);
+        counters->ticks[z].store(counters->ticks[z].load(std::memory_order_relaxed) + ticks, std::memory_order_relaxed);
+        counters->calls[z].store(counters->calls[z].load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    }
+}
+
+void Profiler::SetThreadName(std::string const& name)
+{
+    ThreadCounters* counters = GetThreadCounters();
+    if (counters)
+    {
+        std::strncpy(counters->name, name.c_str(), sizeof(counters->name) - 1);
+        counters->has_name.store(true, std::memory_order_release);
+    }
+}
+
+bool Profiler::IsCapturing()
+{
+    return g_capturing.load(std::memory_order_relaxed);
+}
+
+void Profiler::AddEvent(const char* name, uint64_t begin, uint64_t end)
+{
+    ThreadCounters* counters = GetThreadCounters();
+    if (!counters || !g_capturing.load(std::memory_order_acquire))
+    {
+        return;
+    }
+
+    const uint32_t capture_id = g_capture_id.load(std::memory_order_relaxed);
+    if (counters->capture_id.load(std::memory_order_relaxed) != capture_id)
+    {
+        counters->num_events.store(0, std::memory_order_relaxed);
+        counters->num_dropped.store(0, std::memory_order_relaxed);
+        counters->capture_id.store(capture_id, std::memory_order_release);
+    }
+
+    CaptureEvent* events = counters->events.load(std::memory_order_relaxed);
+    if (!events)
+    {
+        const size_t index = static_cast<size_t>(counters - g_thread_counters);
+        g_capture_buffers[index].reset(new CaptureEvent[CAPTURE_EVENTS_PER_THREAD]);
+        events = g_capture_buffers[index].get();
+        counters->events.store(events, std::memory_order_release);
+    }
+
+    const size_t num_events = counters->num_events.load(std::memory_order_relaxed);
+    if (num_events == CAPTURE_EVENTS_PER_THREAD)
+    {
+        counters->num_dropped.store(counters->num_dropped.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        return;
+    }
+    events[num_events].name = name;
+    events[num_events].begin = begin;
+    events[num_events].end = end;
+    counters->num_events.store(num_events + 1, std::memory_order_release);
+}
+
+void Profiler::EndFrame()
+{
+    uint64_t ticks[NUM_ZONES] = {};
+    uint32_t calls[NUM_ZONES] = {};
+    const size_t num_threads = std::min(g_num_threads.load(), static_cast<size_t>(MAX_THREADS));
+    for (size_t t = 0; t < num_threads; t++)
+    {
+        for (size_t z = 0; z < NUM_ZONES; z++)
+        {
+            ticks[z] += g_thread_counters[t].ticks[z].load(std::memory_order_relaxed);
+            calls[z] += g_thread_counters[t].calls[z].load(std::memory_order_relaxed);
+        }
+    }
+
+    FrameStats& frame = g_history[g_num_frames % HISTORY_SIZE];
+    frame.frame_number = g_num_frames;
+    frame.end_sec = (Now() - g_start_ticks) * TICKS_TO_SEC;
+    for (size_t z = 0; z < NUM_ZONES; z++)
+    {
+        frame.zone_ms[z] = (ticks[z] - g_prev_ticks[z]) * TICKS_TO_SEC * 1000.0;
+        frame.zone_calls[z] = calls[z] - g_prev_calls[z];
+        g_prev_ticks[z] = ticks[z];
+        g_prev_calls[z] = calls[z];
+    }
+    g_num_frames++;
+}
+
+size_t Profiler::GetNumFrames()
+{
+    return static_cast<size_t>(std::min(g_num_frames, static_cast<uint64_t>(HISTORY_SIZE)));
+}
+
+const Profiler::FrameStats& Profiler::GetFrame(size_t age)
+{
+    return g_history[(g_num_frames - 1 - age) % HISTORY_SIZE];
+}
+
+Profiler::FrameStats Profiler::GetAverage(size_t num_frames)
+{
+    FrameStats avg;
+    num_frames = std::min(num_frames, GetNumFrames());
+    if (num_frames == 0)
+    {
+        return avg;
+    }
+
+    avg.frame_number = GetFrame(0).frame_number;
+    avg.end_sec = GetFrame(0).end_sec;
+    for (size_t age = 0; age < num_frames; age++)
+    {
+        const FrameStats& frame = GetFrame(age);
+        for (size_t z = 0; z < NUM_ZONES; z++)
+        {
+            avg.zone_ms[z] += frame.zone_ms[z];
+            avg.zone_calls[z] += frame.zone_calls[z];
+        }
+    }
+    for (size_t z = 0; z < NUM_ZONES; z++)
+    {
+        avg.zone_ms[z] /= num_frames;
+        avg.zone_calls[z] /= static_cast<uint32_t>(num_frames);
+    }
+    return avg;
+}
+
+bool Profiler::WriteCsv(std::string const& path)
+{
+    std::ofstream file(path);
+    if (!file.is_open())
+    {
+        return false;
+    }
+
+    file << "frame,end_sec";
+    for (size_t z = 0; z < NUM_ZONES; z++)
+    {
+        file << ",\"" << ZONE_DEFS[z].name << " (ms)\"";
+    }
+    file << "\n";
+
+    for (size_t age = GetNumFrames(); age-- > 0; ) // Oldest first
+    {
+        const FrameStats& frame = GetFrame(age);
+        file << frame.frame_number << "," << frame.end_sec;
+        for (size_t z = 0; z < NUM_ZONES; z++)
+        {
+            file << "," << frame.zone_ms[z];
+        }
+        file << "\n";
+    }
+    return file.good();
+}
+
+bool Profiler::WriteChromeTrace(std::string const& path)
+{
+    std::ofstream file(path);
+    if (!file.is_open())
+    {
+        return false;
+    }
+
+    bool has_children[NUM_ZONES] = {};
+    for (size_t z = 1; z < NUM_ZONES; z++)
+    {
+        has_children[static_cast<size_t>(GetZoneParent(static_cast<ProfilerZone>(z)))] = true;
+    }
+
+    // One counter event per frame and parent zone, with a value per child zone and the rest as "self";
+    // the viewer plots each parent as a stacked graph.
+    file << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+    bool first = true;
+    for (size_t age = GetNumFrames(); age-- > 0; )
+    {
+        const FrameStats& frame = GetFrame(age);
+        for (size_t z = 0; z < NUM_ZONES; z++)
+        {
+            if (!has_children[z])
+                continue;
+
+            const ProfilerZone zone = static_cast<ProfilerZone>(z);
+            file << (first ? "" : ",\n")
+                 << "{\"name\":\"" << ZONE_DEFS[z].name << "\",\"ph\":\"C\",\"pid\":1,\"tid\":1,\"ts\":"
+                 << static_cast<uint64_t>(frame.end_sec * 1000000.0) << ",\"args\":{";
+            double children_ms = 0.0;
+            bool first_arg = true;
+            for (size_t c = z + 1; c < NUM_ZONES; c++)
+            {
+                if (GetZoneParent(static_cast<ProfilerZone>(c)) != zone)
+                    continue;
+                file << (first_arg ? "" : ",") << "\"" << ZONE_DEFS[c].name << "\":" << frame.zone_ms[c];
+                children_ms += frame.zone_ms[c];
+                first_arg = false;
+            }
+            file << (first_arg ? "" : ",") << "\"self\":" << std::max(0.0, frame.zone_ms[z] - children_ms) << "}}";
+            first = false;
+        }
+    }
+    file << "\n]}\n";
+    return file.good();
+}
+
+void Profiler::StartCapture()
+{
+    g_capture_start = Now();
+    g_capture_id.fetch_add(1);
+    g_capturing.store(true, std::memory_order_release);
+}
+
+bool Profiler::StopCapture(std::string const& path, size_t& out_num_events, size_t& out_num_dropped)
+{
+    g_capturing.store(false);
+    out_num_events = 0;
+    out_num_dropped = 0;
+
+    std::ofstream file(path);
+    if (!file.is_open())
+    {
+        return false;
+    }
+
+    // Complete ("X") events in microseconds since the start of the capture, one track per thread
+    file << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+    bool first = true;
+    const uint32_t capture_id = g_capture_id.load();
+    const size_t num_threads = std::min(g_num_threads.load(), static_cast<size_t>(MAX_THREADS));
+    for (size_t t = 0; t < num_threads; t++)
+    {
+        ThreadCounters& counters = g_thread_counters[t];
+        if (counters.capture_id.load(std::memory_order_acquire) != capture_id)
+            continue; // Nothing recorded during this capture
+
+        const size_t num_events = counters.num_events.load(std::memory_order_acquire);
+        const CaptureEvent* events = counters.events.load(std::memory_order_acquire);
+        if (counters.has_name.load(std::memory_order_acquire))
+        {
+            file << (first ? "" : ",\n")
+                 << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << t
+                 << ",\"args\":{\"name\":\"" << counters.name << "\"}}";
+            first = false;
+        }
+        for (size_t i = 0; i < num_events; i++)
+        {
+            const CaptureEvent& ev = events[i];
+            if (ev.begin < g_capture_start)
+                continue; // Started before the capture
+            file << (first ? "" : ",\n")
+                 << "{\"name\":\"" << ev.name << "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << t
+                 << ",\"ts\":" << (ev.begin - g_capture_start) * TICKS_TO_SEC * 1000000.0
+                 << ",\"dur\":" << (ev.end - ev.begin) * TICKS_TO_SEC * 1000000.0 << "}";
+            first = false;
+        }
+        out_num_events += num_events;
+        out_num_dropped += counters.num_dropped.load(std::memory_order_relaxed);
+    }
+    file << "\n]}\n";
+    return file.good();
+}
@@ -0,0 +1,156 @@
+/*
+    This source file is part of Rigs of Rods
+    Copyright 2026 Rigs of Rods contributors
+
+    For more information, see http://www.rigsofrods.org/
+
+    Rigs of Rods is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License version 3, as
+    published by the Free Software Foundation.
+
+    Rigs of Rods is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Rigs of Rods. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/// @file
+/// @brief Built-in phase profiler: scoped timers on the hot paths, summed up per frame,
+///        and an on-demand timeline capture of all threads for chrome://tracing or Perfetto.
+///
+/// The probes (`ROR_PROFILE_SCOPE()`, `ROR_PROFILE_EVENT()`) are only compiled in with the CMake option
+/// `USE_PROFILER`; without it, `Profiler` still exists but all frames and captures are empty.
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace RoR {
+
+/// Measured zones, in depth-first order of the flame graph; see `Profiler::GetZoneParent()`.
+enum class ProfilerZone
+{
+    FRAME,              //!< Main loop iteration
+    PHYSICS,            //!< `ActorManager::UpdatePhysicsSimulation()`, all substeps; runs alongside the frame with async physics
+    PHYSICS_PREPARE,    //!< `Actor::CalcForcesEulerPrepare()`
+    PHYSICS_COMPUTE,    //!< `Actor::CalcForcesEulerCompute()`
+    CALC_NODES,         //!< `Actor::CalcNodes()`
+    CALC_BEAMS,         //!< `Actor::CalcBeams()`
+    CALC_WHEELS,        //!< `Actor::CalcWheels()`
+    CALC_HYDROS,        //!< `Actor::CalcHydros()`
+    CALC_COMMANDS,      //!< `Actor::CalcCommands()`
+    INTER_COLLISIONS,   //!< `ResolveInterActorCollisions()` and its point detector update
+    GFX_SIM_DATA,       //!< `GfxActor::UpdateSimDataBuffer()`
+    GFX_FLEXBODIES,     //!< Flexbody tasks started by `GfxActor::UpdateFlexbodies()`
+    RENDERING,          //!< `Ogre::Root::renderOneFrame()`
+
+    NUM_ZONES
+};
+
+/// Sums the time spent in each `ProfilerZone` by all threads, and keeps a history of the last frames.
+///
+/// Every thread adds into its own counters, without locks; `EndFrame()` (main thread) sums them up
+/// and stores the difference to the previous frame into a ring of `FrameStats`. Times of zones which
+/// run on several threads at once are CPU times, so they may exceed the wall time of their parent.
+///
+/// Between `StartCapture()` and `StopCapture()`, every probe also appends a begin/end event to
+/// a buffer of its thread (again without locks); `StopCapture()` writes them all as a Chrome trace.
+class Profiler
+{
+public:
+    static const size_t NUM_ZONES = static_cast<size_t>(ProfilerZone::NUM_ZONES);
+    static const size_t MAX_THREADS = 128;      //!< Threads alive at once beyond this are not measured; slots of exited threads are reused
+    static const size_t HISTORY_SIZE = 512;     //!< Frames kept for the overlay and the CSV dump
+    static const size_t CAPTURE_EVENTS_PER_THREAD = 1 << 19; //!< Buffer of each thread which records during a capture; the rest is dropped
+
+    struct FrameStats
+    {
+        uint64_t        frame_number = 0;
+        double          end_sec = 0.0;              //!< Since profiler start
+        double          zone_ms[NUM_ZONES] = {};
+        uint32_t        zone_calls[NUM_ZONES] = {};
+    };
+
+    typedef std::chrono::steady_clock Clock;
+
+    static const char*  GetZoneName(ProfilerZone zone);
+    static ProfilerZone GetZoneParent(ProfilerZone zone); //!< `FRAME` is its own parent
+    static int          GetZoneDepth(ProfilerZone zone);
+
+    // Any thread
+
+    static uint64_t     Now()                       { return static_cast<uint64_t>(Clock::now().time_since_epoch().count()); }
+    static void         AddSample(ProfilerZone zone, uint64_t ticks);
+    static void         SetThreadName(std::string const& name); //!< Shown in captures; call when the thread starts
+    static bool         IsCapturing();
+    static void         AddEvent(const char* name, uint64_t begin, uint64_t end); //!< `name` must outlive the capture - use literals
+
+    // Main thread
+
+    static void         EndFrame();
+    static size_t       GetNumFrames();                     //!< Frames in history, up to `HISTORY_SIZE`
+    static const FrameStats& GetFrame(size_t age);          //!< 0 = last finished frame
+    static FrameStats   GetAverage(size_t num_frames);      //!< Over the last `num_frames` frames in history
+    static bool         WriteCsv(std::string const& path);  //!< One row per frame in history, milliseconds per zone
+    static bool         WriteChromeTrace(std::string const& path); //!< Frame history as counters, for chrome://tracing or Perfetto
+    static void         StartCapture();
+    /// Writes the events of all threads since `StartCapture()` as a Chrome trace (JSON).
+    /// @return False if the file couldn't be written
+    static bool         StopCapture(std::string const& path, size_t& out_num_events, size_t& out_num_dropped);
+};
+
+/// RAII probe; use `ROR_PROFILE_SCOPE()` so it compiles away without `USE_PROFILER`.
+class ProfilerScope
+{
+public:
+    explicit ProfilerScope(ProfilerZone zone): m_zone(zone), m_start(Profiler::Now()) {}
+    ~ProfilerScope()
+    {
+        const uint64_t end = Profiler::Now();
+        Profiler::AddSample(m_zone, end - m_start);
+        if (Profiler::IsCapturing())
+        {
+            Profiler::AddEvent(Profiler::GetZoneName(m_zone), m_start, end);
+        }
+    }
+
+private:
+    ProfilerZone m_zone;
+    uint64_t     m_start;
+};
+
+/// RAII probe which only shows up in captures; use `ROR_PROFILE_EVENT()`.
+class ProfilerEvent
+{
+public:
+    explicit ProfilerEvent(const char* name): m_name(name), m_start(Profiler::Now()) {}
+    ~ProfilerEvent()
+    {
+        if (Profiler::IsCapturing())
+        {
+            Profiler::AddEvent(m_name, m_start, Profiler::Now());
+        }
+    }
+
+private:
+    const char*  m_name;
+    uint64_t     m_start;
+};
+
+} // namespace RoR
+
+#ifdef ROR_PROFILER
+    #define ROR_PROFILE_SCOPE(ZONE)       RoR::ProfilerScope ror_profile_scope(RoR::ProfilerZone::ZONE)
+    #define ROR_PROFILE_EVENT(NAME)       RoR::ProfilerEvent ror_profile_event(NAME)
+    #define ROR_PROFILE_THREAD_NAME(NAME) RoR::Profiler::SetThreadName(NAME)
+#else
+    #define ROR_PROFILE_SCOPE(ZONE)
+    #define ROR_PROFILE_EVENT(NAME)
+    #define ROR_PROFILE_THREAD_NAME(NAME)
+#endif
@@ -0,0 +1,72 @@
+/*
+    This source file is part of Rigs of Rods
+    Copyright 2026 Rigs of Rods contributors
+
+    For more information, see http://www.rigsofrods.org/
+
+    Rigs of Rods is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License version 3, as
+    published by the Free Software Foundation.
+
+    Rigs of Rods is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Rigs of Rods. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+
+namespace RoR {
+
+/// Fixed-size queue from one producer thread to one consumer thread, without locks.
+///
+/// `Push()` fails when the queue is full instead of waiting - meant for data which may be dropped.
+/// Each index is written by one side only; the counters wrap around, only their difference matters.
+template <class T, size_t CAPACITY>
+class SpscRingBuffer
+{
+    static_assert(CAPACITY > 0 && (CAPACITY & (CAPACITY - 1)) == 0, "Capacity must be a power of 2");
+
+public:
+    // Producer
+
+    bool Push(const T& item)
+    {
+        const size_t head = m_head.load(std::memory_order_relaxed);
+        if (head - m_tail.load(std::memory_order_acquire) == CAPACITY)
+        {
+            return false;
+        }
+        m_items[head & (CAPACITY - 1)] = item;
+        m_head.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Consumer
+
+    bool Pop(T& out_item)
+    {
+        const size_t tail = m_tail.load(std::memory_order_relaxed);
+        if (tail == m_head.load(std::memory_order_acquire))
+        {
+            return false;
+        }
+        out_item = m_items[tail & (CAPACITY - 1)];
+        m_tail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+private:
+    T                   m_items[CAPACITY];
+    std::atomic<size_t> m_head{0};   //!< Next slot to write; owned by the producer
+    char                m_padding[64 - sizeof(std::atomic<size_t>)]; //!< Keeps the two sides off one cache line
+    std::atomic<size_t> m_tail{0};   //!< Next slot to read; owned by the consumer
+};
+
+} // namespace RoR
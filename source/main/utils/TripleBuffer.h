@@ -0,0 +1,74 @@
+/*
+    This source file is part of Rigs of Rods
+    Copyright 2026 Rigs of Rods contributors
+
+    For more information, see http://www.rigsofrods.org/
+
+    Rigs of Rods is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License version 3, as
+    published by the Free Software Foundation.
+
+    Rigs of Rods is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Rigs of Rods. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <atomic>
+
+namespace RoR {
+
+/// Hands the latest version of some data from one writer thread to one reader thread without locks or copies.
+///
+/// The writer fills the back buffer and `Publish()`es it; the reader `Acquire()`s the most recently
+/// published buffer and may use it (even modify it) until its next `Acquire()`. Each side owns one slot,
+/// the third one is in flight; publishing and acquiring only swap slot indices.
+template <class T>
+class TripleBuffer
+{
+public:
+    /// Sets all slots; only call while neither side is using the buffer.
+    void Reset(const T& value)
+    {
+        for (T& slot: m_slots)
+        {
+            slot = value;
+        }
+        m_back = 0;
+        m_ready = 1;
+        m_front = 2;
+    }
+
+    // Writer
+
+    T&   GetBackBuffer()    { return m_slots[m_back]; }
+    void Publish()          { m_back = m_ready.exchange(m_back | FRESH, std::memory_order_acq_rel) & INDEX_MASK; }
+
+    // Reader
+
+    T&   GetFrontBuffer()   { return m_slots[m_front]; }
+    T&   Acquire() //!< Takes the newest published buffer, if any; otherwise keeps the current one
+    {
+        if (m_ready.load(std::memory_order_relaxed) & FRESH)
+        {
+            m_front = m_ready.exchange(m_front, std::memory_order_acq_rel) & INDEX_MASK;
+        }
+        return m_slots[m_front];
+    }
+
+private:
+    static const int INDEX_MASK = 0x3;
+    static const int FRESH = 0x4;   //!< Set on `m_ready` by `Publish()`, cleared by `Acquire()`
+
+    T                m_slots[3];
+    int              m_back = 0;      //!< Owned by the writer
+    std::atomic<int> m_ready{1};      //!< Last published slot (+ `FRESH` flag)
+    int              m_front = 2;     //!< Owned by the reader
+};
+
+} // namespace RoR
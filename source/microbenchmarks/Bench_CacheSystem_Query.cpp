@@ -0,0 +1,256 @@
+// One keystroke in the selector's search box: `CacheSystem::Query()` with FULLTEXT on 30000 mod cache entries
+// (name, filename, description, 2 authors each), filtered to all vehicles.
+// Compares the former scan (fext compared as strings, every field copied and lowercased per entry)
+// with the index (type buckets, precomputed lowercase fields, candidates from a trigram index).
+// Sorting of the results is left out, it's the same for both.
+//
+// Build: g++ -O2 -std=c++11 Bench_CacheSystem_Query.cpp -lbenchmark -lpthread
+
+#include "benchmark/benchmark.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <iterator>
+#include <map>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+static const int NUM_ENTRIES = 30000;
+
+struct Author { std::string name, email, name_lower, email_lower; };
+
+struct Entry
+{
+    std::string fname, dname, description, fext;
+    std::vector<Author> authors;
+    std::string fname_lower, dname_lower, description_lower;
+};
+
+static void ToLower(std::string& s)
+{
+    std::transform(s.begin(), s.end(), s.begin(), [](char c) { return static_cast<char>(::tolower(c)); });
+}
+
+static std::string RandomWord(std::mt19937& rng)
+{
+    static const char* SYLLABLES[] = {"Ka", "ro", "Mi", "tan", "Ber", "go", "lux", "Va", "dex", "Tor", "pe", "Sin", "qua", "Ly", "mon"};
+    std::string word;
+    const int n = 2 + rng() % 3;
+    for (int i = 0; i < n; i++)
+        word += SYLLABLES[rng() % 15];
+    return word;
+}
+
+static std::vector<Entry> MakeEntries()
+{
+    static const char* EXTS[] = {"truck", "truck", "truck", "car", "car", "boat", "airplane", "trailer", "load", "terrn2", "skin"};
+    std::mt19937 rng(42);
+    std::vector<Entry> entries(NUM_ENTRIES);
+    for (Entry& e: entries)
+    {
+        e.fext = EXTS[rng() % 11];
+        e.dname = RandomWord(rng) + " " + RandomWord(rng) + " " + std::to_string(rng() % 1000);
+        e.fname = std::to_string(rng() % 100000) + "UID-" + RandomWord(rng) + "." + e.fext;
+        for (int i = 0; i < 20; i++)
+            e.description += RandomWord(rng) + " ";
+        for (int i = 0; i < 2; i++)
+        {
+            Author a;
+            a.name = RandomWord(rng);
+            a.email = RandomWord(rng) + "@" + RandomWord(rng) + ".com";
+            e.authors.push_back(a);
+        }
+    }
+    return entries;
+}
+
+static bool IsVehicle(std::string const& fext)
+{
+    return fext == "truck" || fext == "car" || fext == "boat" || fext == "airplane" || fext == "trailer" || fext == "train" || fext == "load";
+}
+
+static const std::string SEARCH = "bergo";
+
+// ---- Former implementation ----
+
+static bool MatchCopy(size_t& out_score, std::string data, std::string const& query, size_t score)
+{
+    ToLower(data);
+    size_t pos = data.find(query);
+    if (pos == std::string::npos)
+        return false;
+    out_score = score + pos;
+    return true;
+}
+
+static void BM_Query_Scan(benchmark::State& state)
+{
+    std::vector<Entry> entries = MakeEntries();
+    std::vector<std::pair<const Entry*, size_t>> results;
+    for (auto _: state)
+    {
+        results.clear();
+        std::map<int, size_t> usage;
+        for (Entry const& e: entries)
+        {
+            if (!IsVehicle(e.fext))
+                continue;
+            usage[0]++;
+            size_t score = 0;
+            bool match = false;
+            do
+            {
+                if ((match = MatchCopy(score, e.dname, SEARCH, 0)))         { break; }
+                if ((match = MatchCopy(score, e.fname, SEARCH, 100)))       { break; }
+                if ((match = MatchCopy(score, e.description, SEARCH, 200))) { break; }
+                for (Author const& a: e.authors)
+                {
+                    if ((match = MatchCopy(score, a.name, SEARCH, 300)))  { break; }
+                    if ((match = MatchCopy(score, a.email, SEARCH, 400))) { break; }
+                }
+            } while (false);
+            if (match)
+                results.emplace_back(&e, score);
+        }
+        benchmark::DoNotOptimize(results.data());
+    }
+    state.counters["results"] = static_cast<double>(results.size());
+}
+BENCHMARK(BM_Query_Scan)->Unit(benchmark::kMicrosecond);
+
+// ---- Index ----
+
+struct Index
+{
+    std::map<std::string, std::vector<size_t>>          by_ext;
+    std::unordered_map<uint32_t, std::vector<size_t>>   trigrams;
+};
+
+static void CollectTrigrams(std::string const& str, std::vector<uint32_t>& out)
+{
+    for (size_t i = 0; i + 3 <= str.size(); i++)
+        out.push_back(uint32_t(uint8_t(str[i])) | (uint32_t(uint8_t(str[i + 1])) << 8) | (uint32_t(uint8_t(str[i + 2])) << 16));
+}
+
+static void SortUnique(std::vector<uint32_t>& v)
+{
+    std::sort(v.begin(), v.end());
+    v.erase(std::unique(v.begin(), v.end()), v.end());
+}
+
+static Index MakeIndex(std::vector<Entry>& entries)
+{
+    Index index;
+    for (size_t pos = 0; pos < entries.size(); pos++)
+    {
+        Entry& e = entries[pos];
+        e.fname_lower = e.fname; ToLower(e.fname_lower);
+        e.dname_lower = e.dname; ToLower(e.dname_lower);
+        e.description_lower = e.description; ToLower(e.description_lower);
+        for (Author& a: e.authors)
+        {
+            a.name_lower = a.name; ToLower(a.name_lower);
+            a.email_lower = a.email; ToLower(a.email_lower);
+        }
+        index.by_ext[e.fext].push_back(pos);
+
+        std::vector<uint32_t> trigrams;
+        CollectTrigrams(e.dname_lower, trigrams);
+        CollectTrigrams(e.fname_lower, trigrams);
+        CollectTrigrams(e.description_lower, trigrams);
+        for (Author const& a: e.authors)
+        {
+            CollectTrigrams(a.name_lower, trigrams);
+            CollectTrigrams(a.email_lower, trigrams);
+        }
+        SortUnique(trigrams);
+        for (uint32_t t: trigrams)
+            index.trigrams[t].push_back(pos);
+    }
+    return index;
+}
+
+static void FindCandidates(Index const& index, std::string const& str, std::vector<size_t>& out)
+{
+    std::vector<uint32_t> trigrams;
+    CollectTrigrams(str, trigrams);
+    SortUnique(trigrams);
+    std::vector<const std::vector<size_t>*> lists;
+    for (uint32_t t: trigrams)
+    {
+        auto found = index.trigrams.find(t);
+        if (found == index.trigrams.end())
+        {
+            out.clear();
+            return;
+        }
+        lists.push_back(&found->second);
+    }
+    std::sort(lists.begin(), lists.end(),
+        [](const std::vector<size_t>* a, const std::vector<size_t>* b) { return a->size() < b->size(); });
+    out = *lists[0];
+    std::vector<size_t> intersection;
+    for (size_t i = 1; i < lists.size() && !out.empty(); i++)
+    {
+        intersection.clear();
+        std::set_intersection(out.begin(), out.end(), lists[i]->begin(), lists[i]->end(), std::back_inserter(intersection));
+        out.swap(intersection);
+    }
+}
+
+static bool Match(size_t& out_score, std::string const& data, std::string const& query, size_t score)
+{
+    size_t pos = data.find(query);
+    if (pos == std::string::npos)
+        return false;
+    out_score = score + pos;
+    return true;
+}
+
+static void BM_Query_Index(benchmark::State& state)
+{
+    std::vector<Entry> entries = MakeEntries();
+    Index index = MakeIndex(entries);
+    std::vector<std::pair<const Entry*, size_t>> results;
+    std::vector<size_t> positions;
+    for (auto _: state)
+    {
+        results.clear();
+        std::map<int, size_t> usage;
+        for (auto& bucket: index.by_ext)
+        {
+            if (IsVehicle(bucket.first))
+                usage[0] += bucket.second.size();
+        }
+        FindCandidates(index, SEARCH, positions);
+        positions.erase(std::remove_if(positions.begin(), positions.end(),
+            [&](size_t pos) { return !IsVehicle(entries[pos].fext); }), positions.end());
+        for (size_t pos: positions)
+        {
+            Entry const& e = entries[pos];
+            size_t score = 0;
+            bool match = false;
+            do
+            {
+                if ((match = Match(score, e.dname_lower, SEARCH, 0)))         { break; }
+                if ((match = Match(score, e.fname_lower, SEARCH, 100)))       { break; }
+                if ((match = Match(score, e.description_lower, SEARCH, 200))) { break; }
+                for (Author const& a: e.authors)
+                {
+                    if ((match = Match(score, a.name_lower, SEARCH, 300)))  { break; }
+                    if ((match = Match(score, a.email_lower, SEARCH, 400))) { break; }
+                }
+            } while (false);
+            if (match)
+                results.emplace_back(&e, score);
+        }
+        benchmark::DoNotOptimize(results.data());
+    }
+    state.counters["results"] = static_cast<double>(results.size());
+}
+BENCHMARK(BM_Query_Index)->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_MAIN();
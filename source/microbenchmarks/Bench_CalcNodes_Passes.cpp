@@ -0,0 +1,191 @@
+// Per-node cost of `Actor::CalcNodesRange()` without the collision calls: a 1500-node truck on dry land,
+// on a terrain with calm water. Compares the former fused loop (division by mass, aerodynamics branches
+// and the camera check per node, water heights queried for every node) with the split passes (cached
+// inverse mass, one drag loop per aerodynamics model, water pass skipped when the range is above the water).
+// The node struct mirrors the layout of `node_t`; Ogre math is replaced by a minimal vector type.
+//
+// Build: g++ -O2 -std=c++11 Bench_CalcNodes_Passes.cpp -lbenchmark -lpthread
+
+#include "benchmark/benchmark.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <vector>
+
+struct V3
+{
+    float x, y, z;
+    V3& operator+=(const V3& o)     { x += o.x; y += o.y; z += o.z; return *this; }
+    V3 operator+(const V3& o) const { return {x + o.x, y + o.y, z + o.z}; }
+    V3 operator*(float f) const     { return {x * f, y * f, z * f}; }
+    V3 operator/(float f) const     { return {x / f, y / f, z / f}; }
+    float squaredLength() const     { return x * x + y * y + z * z; }
+};
+static V3 operator*(float f, const V3& v) { return {f * v.x, f * v.y, f * v.z}; }
+
+struct Node
+{
+    V3 RelPosition, AbsPosition, Velocity, Forces;
+    float mass, inv_mass, buoyancy, friction_coef, surface_coef, volume_coef;
+    int16_t pos, nd_coll_bbox_id, nd_lockgroup;
+    bool nd_immovable:1;
+    bool nd_under_water:1;
+    float nd_avg_collision_slip;
+    V3 nd_last_collision_slip, nd_last_collision_force;
+    void* nd_last_collision_gm;
+};
+
+/// Same bit trick as `approx_sqrt()` in ApproxMath.h, punned through `memcpy()`.
+static inline float approx_sqrt(const float y)
+{
+    int32_t i;
+    std::memcpy(&i, &y, sizeof(i));
+    i = ((i - 1065353216) >> 1) + 1065353216;
+    float f;
+    std::memcpy(&f, &i, sizeof(f));
+    return f;
+}
+
+static const int   NUM_NODES = 1500;
+static const float DT = 0.0005f;
+static const float GRAVITY = -9.81f;
+static const float DEFAULT_DRAG = 0.05f;
+static const float WATER_HEIGHT = -10.f;
+
+struct Truck
+{
+    std::vector<Node> nodes;
+    std::vector<float> turbulence;
+    std::vector<float> water_heights;
+    V3 origin = {100.f, 5.f, 100.f};
+    V3 fusedrag = {0.f, 0.f, 0.f};
+    bool fuselage_airfoil = false;
+    bool disable_turbulent_drag = false;
+    int camera_node = 7;
+    V3 camera_gforces_accu = {0.f, 0.f, 0.f};
+};
+
+static Truck MakeTruck()
+{
+    Truck t;
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<float> unit(-1.f, 1.f);
+    t.nodes.resize(NUM_NODES);
+    t.turbulence.resize(3 * NUM_NODES);
+    t.water_heights.resize(NUM_NODES);
+    for (int i = 0; i < NUM_NODES; i++)
+    {
+        Node& n = t.nodes[i];
+        n.RelPosition = {unit(rng) * 3.f, 1.f + unit(rng), unit(rng) * 6.f};
+        n.AbsPosition = t.origin + n.RelPosition;
+        n.Velocity = {10.f + unit(rng), unit(rng), unit(rng)};
+        n.Forces = {unit(rng) * 100.f, unit(rng) * 100.f, unit(rng) * 100.f};
+        n.mass = 5.f + unit(rng);
+        n.inv_mass = 1.f / n.mass;
+    }
+    for (float& f: t.turbulence)
+        f = unit(rng);
+    return t;
+}
+
+// ---- Former implementation ----
+
+static void BM_CalcNodes_Fused(benchmark::State& state)
+{
+    Truck t = MakeTruck();
+    for (auto _: state)
+    {
+        bool exploded = false;
+        for (int i = 0; i < NUM_NODES; i++)
+        {
+            Node& n = t.nodes[i];
+            if (i == t.camera_node)
+                t.camera_gforces_accu += n.Forces / n.mass;
+            if (!n.nd_immovable)
+            {
+                n.Velocity += n.Forces / n.mass * DT;
+                n.RelPosition += n.Velocity * DT;
+                n.AbsPosition = t.origin;
+                n.AbsPosition += n.RelPosition;
+            }
+            n.Forces = V3{0, n.mass * GRAVITY, 0};
+            const float approx_speed = approx_sqrt(n.Velocity.squaredLength());
+            if (approx_speed > 6860)
+                exploded = true;
+            if (t.fuselage_airfoil)
+            {
+                n.Forces += t.fusedrag;
+            }
+            else if (!t.disable_turbulent_drag)
+            {
+                float defdragxspeed = DEFAULT_DRAG * approx_speed;
+                V3 drag = -defdragxspeed * n.Velocity;
+                float maxtur = defdragxspeed * approx_speed * 0.005f;
+                drag += maxtur * V3{t.turbulence[3 * i], t.turbulence[3 * i + 1], t.turbulence[3 * i + 2]};
+                n.Forces += drag;
+            }
+        }
+        // Water: calm sea, every node queried
+        std::fill(t.water_heights.begin(), t.water_heights.end(), WATER_HEIGHT);
+        for (int i = 0; i < NUM_NODES; i++)
+            t.nodes[i].nd_under_water = t.nodes[i].AbsPosition.y < t.water_heights[i];
+        benchmark::DoNotOptimize(exploded);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * NUM_NODES);
+}
+BENCHMARK(BM_CalcNodes_Fused);
+
+// ---- Split passes ----
+
+static void BM_CalcNodes_Passes(benchmark::State& state)
+{
+    Truck t = MakeTruck();
+    for (auto _: state)
+    {
+        t.camera_gforces_accu += t.nodes[t.camera_node].Forces * t.nodes[t.camera_node].inv_mass;
+
+        float min_y = std::numeric_limits<float>::max();
+        for (int i = 0; i < NUM_NODES; i++)
+        {
+            Node& n = t.nodes[i];
+            if (!n.nd_immovable)
+            {
+                n.Velocity += n.Forces * (n.inv_mass * DT);
+                n.RelPosition += n.Velocity * DT;
+                n.AbsPosition = t.origin + n.RelPosition;
+            }
+            n.Forces = V3{0, n.mass * GRAVITY, 0};
+            min_y = std::min(min_y, n.AbsPosition.y);
+        }
+
+        bool exploded = false;
+        for (int i = 0; i < NUM_NODES; i++)
+        {
+            Node& n = t.nodes[i];
+            const float approx_speed = approx_sqrt(n.Velocity.squaredLength());
+            exploded |= approx_speed > 6860;
+            float defdragxspeed = DEFAULT_DRAG * approx_speed;
+            V3 drag = -defdragxspeed * n.Velocity;
+            float maxtur = defdragxspeed * approx_speed * 0.005f;
+            drag += maxtur * V3{t.turbulence[3 * i], t.turbulence[3 * i + 1], t.turbulence[3 * i + 2]};
+            n.Forces += drag;
+        }
+
+        if (min_y > WATER_HEIGHT)
+        {
+            std::fill(t.water_heights.begin(), t.water_heights.end(), WATER_HEIGHT);
+            for (int i = 0; i < NUM_NODES; i++)
+                t.nodes[i].nd_under_water = false;
+        }
+        benchmark::DoNotOptimize(exploded);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * NUM_NODES);
+}
+BENCHMARK(BM_CalcNodes_Passes);
+
+BENCHMARK_MAIN();
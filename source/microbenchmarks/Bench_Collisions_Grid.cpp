@@ -0,0 +1,370 @@
+// Static collision lookup of `Collisions::nodeCollision()` on a big terrain:
+// ~100k collision tris over 3x3km (roughly the scale of Auriga), probed at node positions near the surface.
+// Compares the former fixed 2^20-bucket hashtable (vector per bucket, fat tris) with the packed grid
+// (open-addressing cell table -> contiguous element runs, hot/cold tri split with a plane prefilter).
+// Only the lookup and the tri tests are reproduced; Ogre math is replaced by a minimal vector type.
+//
+// Build: g++ -O2 -std=c++11 Bench_Collisions_Grid.cpp -lbenchmark -lpthread
+
+#include "benchmark/benchmark.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <vector>
+
+struct V3
+{
+    float x, y, z;
+    V3 operator-(const V3& o) const { return {x - o.x, y - o.y, z - o.z}; }
+    float dot(const V3& o) const    { return x * o.x + y * o.y + z * o.z; }
+    V3 cross(const V3& o) const     { return {y * o.z - z * o.y, z * o.x - x * o.z, x * o.y - y * o.x}; }
+};
+
+struct M3
+{
+    float m[3][3];
+    V3 operator*(const V3& v) const
+    {
+        return {m[0][0] * v.x + m[0][1] * v.y + m[0][2] * v.z,
+                m[1][0] * v.x + m[1][1] * v.y + m[1][2] * v.z,
+                m[2][0] * v.x + m[2][1] * v.y + m[2][2] * v.z};
+    }
+};
+
+static M3 InverseOfColumns(V3 a, V3 b, V3 c)
+{
+    // Rows of the inverse are the cross products divided by the determinant
+    const V3 r0 = b.cross(c), r1 = c.cross(a), r2 = a.cross(b);
+    const float inv_det = 1.f / a.dot(r0);
+    M3 out;
+    const V3 rows[3] = {r0, r1, r2};
+    for (int i = 0; i < 3; i++)
+    {
+        out.m[i][0] = rows[i].x * inv_det; out.m[i][1] = rows[i].y * inv_det; out.m[i][2] = rows[i].z * inv_det;
+    }
+    return out;
+}
+
+static const float CELL_SIZE = 2.0f;
+static const int   ELEMENT_TRI_BASE_INDEX = 1000000;
+static const int   HASH_POWER = 20;
+static const int   HASH_SIZE = 1 << HASH_POWER;
+
+struct SourceTri { V3 a, b, c; };
+
+static unsigned int Mix(unsigned int cellid, unsigned int mask)
+{
+    unsigned int h = cellid * 2654435761u;
+    return (h ^ (h >> 16)) & mask;
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+// Former layout
+// --------------------------------------------------------------------------------------------------------------------
+
+struct LegacyGrid
+{
+    struct Element { unsigned int cell_id; int element_index; };
+    struct Tri { V3 a, b, c; V3 aab_min, aab_max; M3 forward, reverse; void* gm; bool enabled; };
+
+    std::vector<float> height;
+    std::vector<std::vector<Element>> table;
+    std::vector<Tri> tris;
+
+    void Build(const std::vector<SourceTri>& src)
+    {
+        height.assign(HASH_SIZE, -std::numeric_limits<float>::max());
+        table.assign(HASH_SIZE, std::vector<Element>());
+        for (const SourceTri& s: src)
+        {
+            Tri t;
+            t.a = s.a; t.b = s.b; t.c = s.c;
+            t.aab_min = {std::min({s.a.x, s.b.x, s.c.x}) - 0.1f, std::min({s.a.y, s.b.y, s.c.y}) - 0.1f, std::min({s.a.z, s.b.z, s.c.z}) - 0.1f};
+            t.aab_max = {std::max({s.a.x, s.b.x, s.c.x}) + 0.1f, std::max({s.a.y, s.b.y, s.c.y}) + 0.1f, std::max({s.a.z, s.b.z, s.c.z}) + 0.1f};
+            V3 bz = (s.b - s.a).cross(s.c - s.a);
+            const float len = std::sqrt(bz.dot(bz));
+            bz = {bz.x / len, bz.y / len, bz.z / len};
+            t.forward = InverseOfColumns(s.b - s.a, s.c - s.a, bz);
+            t.gm = nullptr;
+            t.enabled = true;
+            const int index = static_cast<int>(tris.size());
+            tris.push_back(t);
+            for (int i = (int)(t.aab_min.x / CELL_SIZE); i <= (int)(t.aab_max.x / CELL_SIZE); i++)
+            {
+                for (int j = (int)(t.aab_min.z / CELL_SIZE); j <= (int)(t.aab_max.z / CELL_SIZE); j++)
+                {
+                    const unsigned int cell_id = (i << 16) + j;
+                    const unsigned int pos = Mix(cell_id, HASH_SIZE - 1);
+                    table[pos].push_back({cell_id, index + ELEMENT_TRI_BASE_INDEX});
+                    height[pos] = std::max(height[pos], t.aab_max.y);
+                }
+            }
+        }
+    }
+
+    size_t Bytes() const
+    {
+        size_t bytes = height.size() * sizeof(float) + table.size() * sizeof(std::vector<Element>) + tris.capacity() * sizeof(Tri);
+        for (const auto& bucket: table)
+            bytes += bucket.capacity() * sizeof(Element);
+        return bytes;
+    }
+
+    bool Query(const V3& p) const
+    {
+        const int refx = (int)(p.x / CELL_SIZE);
+        const int refz = (int)(p.z / CELL_SIZE);
+        const unsigned int cell_id = (refx << 16) + refz;
+        const unsigned int pos = Mix(cell_id, HASH_SIZE - 1);
+        if (p.y > height[pos])
+            return false;
+
+        bool hit = false;
+        for (const Element& e: table[pos])
+        {
+            if (e.cell_id != cell_id)
+                continue;
+            const Tri& t = tris[e.element_index - ELEMENT_TRI_BASE_INDEX];
+            if (!t.enabled)
+                continue;
+            if (p.y > t.aab_max.y || p.y < t.aab_min.y || p.x > t.aab_max.x || p.x < t.aab_min.x || p.z > t.aab_max.z || p.z < t.aab_min.z)
+                continue;
+            const V3 point = t.forward * (p - t.a);
+            if (point.x >= 0 && point.y >= 0 && (point.x + point.y) <= 1.0f && point.z < 0 && point.z > -0.1f)
+                hit = true;
+        }
+        return hit;
+    }
+};
+
+// --------------------------------------------------------------------------------------------------------------------
+// Packed layout
+// --------------------------------------------------------------------------------------------------------------------
+
+struct PackedGrid
+{
+    struct Staged { unsigned int cell_id; int element_index; float height; };
+    struct Cell { unsigned int cell_id; int begin; int count; float height; };
+    struct Tri { V3 lo, hi, normal; float plane_d; bool enabled; };
+    struct TriExt { V3 a, b, c; M3 forward, reverse; void* gm; };
+
+    std::vector<Cell> cells;
+    std::vector<int> elements;
+    std::vector<Tri> tris;
+    std::vector<TriExt> tris_ext;
+    unsigned int mask = 0;
+
+    void Build(const std::vector<SourceTri>& src)
+    {
+        std::vector<Staged> staging;
+        for (const SourceTri& s: src)
+        {
+            Tri t;
+            TriExt x;
+            x.a = s.a; x.b = s.b; x.c = s.c;
+            t.lo = {std::min({s.a.x, s.b.x, s.c.x}) - 0.1f, std::min({s.a.y, s.b.y, s.c.y}) - 0.1f, std::min({s.a.z, s.b.z, s.c.z}) - 0.1f};
+            t.hi = {std::max({s.a.x, s.b.x, s.c.x}) + 0.1f, std::max({s.a.y, s.b.y, s.c.y}) + 0.1f, std::max({s.a.z, s.b.z, s.c.z}) + 0.1f};
+            V3 bz = (s.b - s.a).cross(s.c - s.a);
+            const float len = std::sqrt(bz.dot(bz));
+            bz = {bz.x / len, bz.y / len, bz.z / len};
+            x.forward = InverseOfColumns(s.b - s.a, s.c - s.a, bz);
+            x.gm = nullptr;
+            t.normal = bz;
+            t.plane_d = bz.dot(s.a);
+            t.enabled = true;
+            const int index = static_cast<int>(tris.size());
+            tris.push_back(t);
+            tris_ext.push_back(x);
+            for (int i = (int)(t.lo.x / CELL_SIZE); i <= (int)(t.hi.x / CELL_SIZE); i++)
+            {
+                for (int j = (int)(t.lo.z / CELL_SIZE); j <= (int)(t.hi.z / CELL_SIZE); j++)
+                {
+                    staging.push_back({static_cast<unsigned int>((i << 16) + j), index + ELEMENT_TRI_BASE_INDEX, t.hi.y});
+                }
+            }
+        }
+
+        std::stable_sort(staging.begin(), staging.end(), [](const Staged& a, const Staged& b) { return a.cell_id < b.cell_id; });
+        size_t num_cells = 0;
+        for (size_t i = 0; i < staging.size(); i++)
+        {
+            if (i == 0 || staging[i].cell_id != staging[i - 1].cell_id)
+                num_cells++;
+        }
+        size_t table_size = 16;
+        while (table_size < num_cells * 2)
+            table_size <<= 1;
+        mask = static_cast<unsigned int>(table_size - 1);
+        cells.assign(table_size, Cell{0, 0, 0, 0.f});
+        elements.resize(staging.size());
+        size_t i = 0;
+        while (i < staging.size())
+        {
+            Cell cell{staging[i].cell_id, static_cast<int>(i), 0, -std::numeric_limits<float>::max()};
+            for (; i < staging.size() && staging[i].cell_id == cell.cell_id; i++)
+            {
+                elements[i] = staging[i].element_index;
+                cell.height = std::max(cell.height, staging[i].height);
+                cell.count++;
+            }
+            unsigned int pos = Mix(cell.cell_id, mask);
+            while (cells[pos].count != 0)
+                pos = (pos + 1) & mask;
+            cells[pos] = cell;
+        }
+    }
+
+    size_t Bytes() const
+    {
+        return cells.capacity() * sizeof(Cell) + elements.capacity() * sizeof(int) +
+            tris.capacity() * sizeof(Tri) + tris_ext.capacity() * sizeof(TriExt);
+    }
+
+    const Cell* Find(unsigned int cell_id) const
+    {
+        for (unsigned int pos = Mix(cell_id, mask); ; pos = (pos + 1) & mask)
+        {
+            if (cells[pos].count == 0)
+                return nullptr;
+            if (cells[pos].cell_id == cell_id)
+                return &cells[pos];
+        }
+    }
+
+    bool Query(const V3& p) const
+    {
+        const int refx = (int)(p.x / CELL_SIZE);
+        const int refz = (int)(p.z / CELL_SIZE);
+        const Cell* cell = this->Find((refx << 16) + refz);
+        if (cell == nullptr || p.y > cell->height)
+            return false;
+
+        bool hit = false;
+        for (int k = cell->begin; k < cell->begin + cell->count; k++)
+        {
+            const int index = elements[k] - ELEMENT_TRI_BASE_INDEX;
+            const Tri& t = tris[index];
+            if (!t.enabled)
+                continue;
+            if (p.y > t.hi.y || p.y < t.lo.y || p.x > t.hi.x || p.x < t.lo.x || p.z > t.hi.z || p.z < t.lo.z)
+                continue;
+            const float plane_dist = t.normal.dot(p) - t.plane_d;
+            if (plane_dist > 0.001f || plane_dist < -0.101f)
+                continue;
+            const TriExt& x = tris_ext[index];
+            const V3 point = x.forward * (p - x.a);
+            if (point.x >= 0 && point.y >= 0 && (point.x + point.y) <= 1.0f && point.z < 0 && point.z > -0.1f)
+                hit = true;
+        }
+        return hit;
+    }
+};
+
+// --------------------------------------------------------------------------------------------------------------------
+// Scene
+// --------------------------------------------------------------------------------------------------------------------
+
+static const float TERRAIN_SIZE = 3000.f;
+static const int   NUM_QUERIES = 4096;
+
+static float Ground(float x, float z)
+{
+    return 20.f * std::sin(x * 0.01f) * std::cos(z * 0.013f);
+}
+
+static const std::vector<SourceTri>& Scene()
+{
+    // ~100k tris: 150 patches of 26x13 quads (roads, bridges, buildings...) scattered over the terrain
+    static std::vector<SourceTri> tris;
+    if (tris.empty())
+    {
+        std::mt19937 rng(7);
+        std::uniform_real_distribution<float> where(50.f, TERRAIN_SIZE - 100.f);
+        for (int patch = 0; patch < 150; patch++)
+        {
+            const float ox = where(rng), oz = where(rng);
+            for (int i = 0; i < 26; i++)
+            {
+                for (int j = 0; j < 13; j++)
+                {
+                    const float x0 = ox + i * 1.5f, x1 = x0 + 1.5f;
+                    const float z0 = oz + j * 1.5f, z1 = z0 + 1.5f;
+                    const V3 a{x0, Ground(x0, z0), z0}, b{x1, Ground(x1, z0), z0};
+                    const V3 c{x1, Ground(x1, z1), z1}, d{x0, Ground(x0, z1), z1};
+                    tris.push_back({a, d, c});
+                    tris.push_back({a, c, b});
+                }
+            }
+        }
+        tris.resize(std::min<size_t>(tris.size(), 100000));
+    }
+    return tris;
+}
+
+static std::vector<V3> Queries()
+{
+    // Nodes resting on or hovering just above the collision meshes, plus some in empty cells
+    std::vector<V3> out;
+    std::mt19937 rng(11);
+    const std::vector<SourceTri>& tris = Scene();
+    std::uniform_int_distribution<size_t> pick(0, tris.size() - 1);
+    std::uniform_real_distribution<float> unit(0.f, 1.f);
+    for (int i = 0; i < NUM_QUERIES; i++)
+    {
+        if (i % 4 == 3)
+        {
+            out.push_back({unit(rng) * TERRAIN_SIZE, 0.f, unit(rng) * TERRAIN_SIZE});
+            continue;
+        }
+        const SourceTri& t = tris[pick(rng)];
+        const float u = unit(rng) * 0.5f, v = unit(rng) * 0.5f;
+        V3 p{t.a.x + (t.b.x - t.a.x) * u + (t.c.x - t.a.x) * v, 0.f, t.a.z + (t.b.z - t.a.z) * u + (t.c.z - t.a.z) * v};
+        p.y = Ground(p.x, p.z) + unit(rng) * 0.3f - 0.15f;
+        out.push_back(p);
+    }
+    return out;
+}
+
+template <typename GRID>
+static void RunQueries(benchmark::State& state)
+{
+    GRID grid;
+    grid.Build(Scene());
+    const std::vector<V3> queries = Queries();
+    int hits = 0;
+    for (auto _ : state)
+    {
+        for (const V3& q: queries)
+            hits += grid.Query(q) ? 1 : 0;
+    }
+    benchmark::DoNotOptimize(hits);
+    state.SetItemsProcessed(state.iterations() * queries.size());
+    state.counters["MB"] = grid.Bytes() / (1024.0 * 1024.0);
+    state.counters["tris"] = static_cast<double>(grid.tris.size());
+}
+
+template <typename GRID>
+static void RunBuild(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        GRID grid;
+        grid.Build(Scene());
+        benchmark::DoNotOptimize(grid.tris.data());
+    }
+}
+
+static void BM_Query_Legacy(benchmark::State& state) { RunQueries<LegacyGrid>(state); }
+static void BM_Query_Packed(benchmark::State& state) { RunQueries<PackedGrid>(state); }
+static void BM_Build_Legacy(benchmark::State& state) { RunBuild<LegacyGrid>(state); }
+static void BM_Build_Packed(benchmark::State& state) { RunBuild<PackedGrid>(state); }
+
+BENCHMARK(BM_Query_Legacy);
+BENCHMARK(BM_Query_Packed);
+BENCHMARK(BM_Build_Legacy)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_Build_Packed)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,227 @@
+// Narrow phase of `ResolveInterActorCollisions()` in a pileup: 600 collcabs, each with a hit list of 24 nodes
+// of other actors from the `PointColDetector` (roughly 1/3 of them inside the triangle).
+// Compares the former per-hit `CartesianToTriangleTransform` + `InsideTriangleTest` (pointer chasing through
+// the hit list for every node) with gathering the hit list into SoA and testing 4 nodes at a time (SSE2).
+// Only the transform and the inside test are reproduced; Ogre math is replaced by a minimal vector type.
+//
+// Build: g++ -O2 -std=c++11 Bench_Collisions_InterActor.cpp -lbenchmark -lpthread
+
+#include "benchmark/benchmark.h"
+
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include <emmintrin.h>
+
+struct V3
+{
+    float x, y, z;
+    V3 operator-(const V3& o) const { return {x - o.x, y - o.y, z - o.z}; }
+    V3 operator+(const V3& o) const { return {x + o.x, y + o.y, z + o.z}; }
+    V3 operator*(float f) const     { return {x * f, y * f, z * f}; }
+    float dot(const V3& o) const    { return x * o.x + y * o.y + z * o.z; }
+    V3 cross(const V3& o) const     { return {y * o.z - z * o.y, z * o.x - x * o.z, x * o.y - y * o.x}; }
+};
+
+struct M3
+{
+    float m[3][3];
+    V3 operator*(const V3& v) const
+    {
+        return {m[0][0] * v.x + m[0][1] * v.y + m[0][2] * v.z,
+                m[1][0] * v.x + m[1][1] * v.y + m[1][2] * v.z,
+                m[2][0] * v.x + m[2][1] * v.y + m[2][2] * v.z};
+    }
+};
+
+static M3 InverseOfColumns(V3 a, V3 b, V3 c)
+{
+    // Rows of the inverse are the cross products divided by the determinant
+    const V3 r0 = b.cross(c), r1 = c.cross(a), r2 = a.cross(b);
+    const float inv_det = 1.f / a.dot(r0);
+    M3 out;
+    const V3 rows[3] = {r0, r1, r2};
+    for (int i = 0; i < 3; i++)
+    {
+        out.m[i][0] = rows[i].x * inv_det; out.m[i][1] = rows[i].y * inv_det; out.m[i][2] = rows[i].z * inv_det;
+    }
+    return out;
+}
+
+static const int   NUM_ACTORS = 8;
+static const int   NODES_PER_ACTOR = 2000;
+static const int   NUM_CABS = 600;
+static const int   HITS_PER_CAB = 24;
+static const float COLLRANGE = 0.02f;
+
+struct Node { V3 pos; V3 velocity; V3 forces; float mass; char other[64]; }; // Roughly the size of `node_t`
+struct PointId { int actor; short node_id; };
+
+struct Cab
+{
+    V3 a, b, c;
+    M3 transform;
+    std::vector<PointId*> hit_list;
+};
+
+struct Scene
+{
+    std::vector<std::vector<Node>> actors;
+    std::vector<PointId> pointids;
+    std::vector<Cab> cabs;
+};
+
+static Scene MakeScene()
+{
+    Scene s;
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<float> unit(0.f, 1.f);
+    s.actors.assign(NUM_ACTORS, std::vector<Node>(NODES_PER_ACTOR));
+    s.pointids.resize(NUM_CABS * HITS_PER_CAB);
+    s.cabs.resize(NUM_CABS);
+    for (int i = 0; i < NUM_CABS; i++)
+    {
+        Cab& cab = s.cabs[i];
+        const V3 base = {unit(rng) * 20.f, unit(rng) * 2.f, unit(rng) * 20.f};
+        cab.a = base + V3{0.5f, 0.f, 0.f};
+        cab.b = base + V3{0.f, 0.f, 0.5f};
+        cab.c = base;
+        const V3 u = cab.a - cab.c, v = cab.b - cab.c;
+        V3 n = u.cross(v);
+        n = n * (1.f / std::sqrt(n.dot(n)));
+        cab.transform = InverseOfColumns(u, v, n);
+
+        for (int k = 0; k < HITS_PER_CAB; k++)
+        {
+            // Hits come from the kd-tree query of the triangle's bounding box; spread them around the triangle
+            PointId& pid = s.pointids[i * HITS_PER_CAB + k];
+            pid.actor = rng() % NUM_ACTORS;
+            pid.node_id = static_cast<short>(rng() % NODES_PER_ACTOR);
+            s.actors[pid.actor][pid.node_id].pos = cab.c + u * (unit(rng) * 1.2f - 0.1f) + v * (unit(rng) * 1.2f - 0.1f)
+                + n * ((unit(rng) * 2.f - 1.f) * COLLRANGE * 1.5f);
+            cab.hit_list.push_back(&pid);
+        }
+    }
+    return s;
+}
+
+// ---- Former implementation ----
+
+static void BM_InterActor_PerHit(benchmark::State& state)
+{
+    Scene s = MakeScene();
+    int num_inside = 0;
+    for (auto _: state)
+    {
+        num_inside = 0;
+        for (const Cab& cab: s.cabs)
+        {
+            for (PointId* h: cab.hit_list)
+            {
+                const V3 local = cab.transform * (s.actors[h->actor][h->node_id].pos - cab.c);
+                const float gamma = 1.f - local.x - local.y;
+                if (local.x >= 0 && local.y >= 0 && gamma >= 0 && std::abs(local.z) <= COLLRANGE)
+                {
+                    num_inside++;
+                    benchmark::DoNotOptimize(local);
+                }
+            }
+        }
+        benchmark::DoNotOptimize(num_inside);
+    }
+    state.counters["inside"] = num_inside;
+    state.SetItemsProcessed(state.iterations() * NUM_CABS * HITS_PER_CAB);
+}
+BENCHMARK(BM_InterActor_PerHit);
+
+// ---- SoA batches ----
+
+struct Buffer
+{
+    std::vector<float> hit_x, hit_y, hit_z, hit_alpha, hit_beta, hit_distance;
+    std::vector<int> inside;
+};
+
+static void Gather(const Scene& s, const std::vector<PointId*>& hit_list, Buffer& buf)
+{
+    const size_t num_hits = hit_list.size();
+    const size_t padded = (num_hits + 3) & ~size_t(3);
+    if (buf.hit_x.size() < padded)
+    {
+        for (std::vector<float>* v: {&buf.hit_x, &buf.hit_y, &buf.hit_z, &buf.hit_alpha, &buf.hit_beta, &buf.hit_distance})
+            v->resize(padded);
+    }
+    for (size_t i = 0; i < num_hits; i++)
+    {
+        const V3& pos = s.actors[hit_list[i]->actor][hit_list[i]->node_id].pos;
+        buf.hit_x[i] = pos.x;
+        buf.hit_y[i] = pos.y;
+        buf.hit_z[i] = pos.z;
+    }
+    for (size_t i = num_hits; i < padded; i++)
+        buf.hit_x[i] = buf.hit_y[i] = buf.hit_z[i] = std::numeric_limits<float>::quiet_NaN();
+}
+
+static void TestBatch(const M3& m, const V3& c, int num_points, Buffer& buf)
+{
+    buf.inside.clear();
+    const __m128 m00 = _mm_set1_ps(m.m[0][0]), m01 = _mm_set1_ps(m.m[0][1]), m02 = _mm_set1_ps(m.m[0][2]);
+    const __m128 m10 = _mm_set1_ps(m.m[1][0]), m11 = _mm_set1_ps(m.m[1][1]), m12 = _mm_set1_ps(m.m[1][2]);
+    const __m128 m20 = _mm_set1_ps(m.m[2][0]), m21 = _mm_set1_ps(m.m[2][1]), m22 = _mm_set1_ps(m.m[2][2]);
+    const __m128 cx = _mm_set1_ps(c.x), cy = _mm_set1_ps(c.y), cz = _mm_set1_ps(c.z);
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 one = _mm_set1_ps(1.f);
+    const __m128 abs_mask = _mm_castsi128_ps(_mm_set1_epi32(0x7fffffff));
+    const __m128 margin4 = _mm_set1_ps(COLLRANGE);
+    for (int i = 0; i < num_points; i += 4)
+    {
+        const __m128 dx = _mm_sub_ps(_mm_loadu_ps(&buf.hit_x[i]), cx);
+        const __m128 dy = _mm_sub_ps(_mm_loadu_ps(&buf.hit_y[i]), cy);
+        const __m128 dz = _mm_sub_ps(_mm_loadu_ps(&buf.hit_z[i]), cz);
+        const __m128 alpha    = _mm_add_ps(_mm_add_ps(_mm_mul_ps(m00, dx), _mm_mul_ps(m01, dy)), _mm_mul_ps(m02, dz));
+        const __m128 beta     = _mm_add_ps(_mm_add_ps(_mm_mul_ps(m10, dx), _mm_mul_ps(m11, dy)), _mm_mul_ps(m12, dz));
+        const __m128 distance = _mm_add_ps(_mm_add_ps(_mm_mul_ps(m20, dx), _mm_mul_ps(m21, dy)), _mm_mul_ps(m22, dz));
+        const __m128 gamma    = _mm_sub_ps(_mm_sub_ps(one, alpha), beta);
+        __m128 inside = _mm_and_ps(_mm_cmpge_ps(alpha, zero), _mm_cmpge_ps(beta, zero));
+        inside = _mm_and_ps(inside, _mm_cmpge_ps(gamma, zero));
+        inside = _mm_and_ps(inside, _mm_cmple_ps(_mm_and_ps(distance, abs_mask), margin4));
+        int mask = _mm_movemask_ps(inside);
+        if (mask != 0)
+        {
+            _mm_storeu_ps(&buf.hit_alpha[i], alpha);
+            _mm_storeu_ps(&buf.hit_beta[i], beta);
+            _mm_storeu_ps(&buf.hit_distance[i], distance);
+            for (int lane = 0; mask != 0; lane++, mask >>= 1)
+            {
+                if (mask & 1)
+                    buf.inside.push_back(i + lane);
+            }
+        }
+    }
+}
+
+static void BM_InterActor_Batch(benchmark::State& state)
+{
+    Scene s = MakeScene();
+    Buffer buf;
+    int num_inside = 0;
+    for (auto _: state)
+    {
+        num_inside = 0;
+        for (const Cab& cab: s.cabs)
+        {
+            Gather(s, cab.hit_list, buf);
+            TestBatch(cab.transform, cab.c, static_cast<int>(cab.hit_list.size()), buf);
+            num_inside += static_cast<int>(buf.inside.size());
+            benchmark::DoNotOptimize(buf.hit_alpha.data());
+        }
+        benchmark::DoNotOptimize(num_inside);
+    }
+    state.counters["inside"] = num_inside;
+    state.SetItemsProcessed(state.iterations() * NUM_CABS * HITS_PER_CAB);
+}
+BENCHMARK(BM_InterActor_Batch);
+
+BENCHMARK_MAIN();
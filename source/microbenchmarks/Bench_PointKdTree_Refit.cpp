@@ -0,0 +1,102 @@
+// Compares the two update modes of `PointKdTree` (used by `PointColDetector`):
+// lazy rebuild on every substep vs. refit of a persistent topology.
+// A recording of node positions (a softbody lattice driving, bouncing and deforming) is captured first
+// and then replayed substep by substep: update the tree, run N box queries like `ResolveIntraActorCollisions()`.
+//
+// Build: g++ -O2 -std=c++11 -I../main/physics/collision Bench_PointKdTree_Refit.cpp ../main/physics/collision/PointKdTree.cpp -lbenchmark -lpthread
+
+#include "benchmark/benchmark.h"
+#include "PointKdTree.h"
+
+#include <cmath>
+#include <cstdlib>
+#include <vector>
+
+using namespace RoR;
+
+static const int NUM_FRAMES = 200;    // 0.1 s of simulation at PHYSICS_DT
+static const float PHYSICS_DT = 0.0005f;
+
+struct Recording
+{
+    int                num_nodes = 0;
+    std::vector<float> frames;        // NUM_FRAMES * num_nodes * 3
+};
+
+// 10 x 10 x N lattice with 0.25m spacing, moving at 20 m/s, rolling and buckling over time
+static Recording Record(int num_nodes)
+{
+    Recording rec;
+    rec.num_nodes = num_nodes;
+    rec.frames.resize(NUM_FRAMES * num_nodes * 3);
+    std::srand(1);
+    std::vector<float> jitter(num_nodes * 3);
+    for (float& j: jitter)
+    {
+        j = (std::rand() / static_cast<float>(RAND_MAX) - 0.5f) * 0.05f;
+    }
+    for (int f = 0; f < NUM_FRAMES; f++)
+    {
+        const float t = f * PHYSICS_DT;
+        float* pos = &rec.frames[f * num_nodes * 3];
+        for (int i = 0; i < num_nodes; i++)
+        {
+            const float x = (i % 10) * 0.25f;
+            const float y = ((i / 10) % 10) * 0.25f;
+            const float z = (i / 100) * 0.25f;
+            const float buckle = std::sin(z * 0.7f + t * 40.f) * t * 2.f; // grows over the recording
+            pos[i * 3 + 0] = x + buckle + jitter[i * 3 + 0];
+            pos[i * 3 + 1] = y + std::sin(t * 60.f + x) * 0.02f + jitter[i * 3 + 1];
+            pos[i * 3 + 2] = z + 20.f * t + jitter[i * 3 + 2];
+        }
+    }
+    return rec;
+}
+
+static void Replay(benchmark::State& state, PointKdTree::Mode mode)
+{
+    const int num_nodes = static_cast<int>(state.range(0));
+    const int num_queries = static_cast<int>(state.range(1));
+    const Recording rec = Record(num_nodes);
+
+    std::vector<float> live(num_nodes * 3);
+    PointKdTree tree;
+    tree.Reset(num_nodes);
+    for (int i = 0; i < num_nodes; i++)
+    {
+        tree.SetPoint(i, &live[i * 3]);
+    }
+
+    std::vector<int> hits;
+    size_t num_hits = 0;
+    int frame = 0;
+    for (auto _ : state)
+    {
+        std::copy(rec.frames.begin() + frame * num_nodes * 3, rec.frames.begin() + (frame + 1) * num_nodes * 3, live.begin());
+        frame = (frame + 1) % NUM_FRAMES;
+
+        tree.Update(mode);
+        for (int q = 0; q < num_queries; q++)
+        {
+            // Box around a node, like a collision triangle enlarged by `ar_collision_range`
+            const float* p = &live[((q * 7919) % num_nodes) * 3];
+            const float bbmin[3] = { p[0] - 0.3f, p[1] - 0.3f, p[2] - 0.3f };
+            const float bbmax[3] = { p[0] + 0.3f, p[1] + 0.3f, p[2] + 0.3f };
+            hits.clear();
+            tree.Query(bbmin, bbmax, hits);
+            num_hits += hits.size();
+        }
+    }
+    benchmark::DoNotOptimize(num_hits);
+    state.counters["rebuilds"] = tree.GetNumRebuilds();
+    state.SetItemsProcessed(state.iterations());
+}
+
+static void BM_PointKdTree_Rebuild(benchmark::State& state) { Replay(state, PointKdTree::Mode::REBUILD); }
+static void BM_PointKdTree_Refit(benchmark::State& state)   { Replay(state, PointKdTree::Mode::REFIT); }
+
+// {nodes, queries per substep}
+BENCHMARK(BM_PointKdTree_Rebuild)->Args({1000, 16})->Args({1000, 500})->Args({5000, 16})->Args({5000, 2000});
+BENCHMARK(BM_PointKdTree_Refit)  ->Args({1000, 16})->Args({1000, 500})->Args({5000, 16})->Args({5000, 2000});
+
+BENCHMARK_MAIN();
@@ -0,0 +1,177 @@
+// Measures the fork/join (barrier) overhead of one physics substep:
+// 2 phases x 8 actors, like `ActorManager::UpdatePhysicsSimulation()`.
+// Compares the former mutex/condvar ThreadPool (copied below) with the work-stealing one.
+//
+// Build: g++ -O2 -std=c++11 Bench_ThreadPool_Barrier.cpp -lbenchmark -lpthread
+
+#include "benchmark/benchmark.h"
+#include "../main/threadpool/ThreadPool.h"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+// --------------------------------------------------------------------------------------------------------------------
+// The original ThreadPool: global queue, mutex + condvar, heap-allocated handle per task
+// --------------------------------------------------------------------------------------------------------------------
+
+class LegacyTask
+{
+public:
+    explicit LegacyTask(std::function<void()> f): func(f) {}
+    void join() const
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        cv.wait(lock, [this]{ return finished; });
+    }
+
+    bool finished = false;
+    mutable std::condition_variable cv;
+    mutable std::mutex mutex;
+    const std::function<void()> func;
+};
+
+class LegacyThreadPool
+{
+public:
+    explicit LegacyThreadPool(int num_threads)
+    {
+        for (int i = 0; i < num_threads; ++i)
+        {
+            m_threads.emplace_back([this]{
+                while (true)
+                {
+                    std::unique_lock<std::mutex> queue_lock(m_mutex);
+                    while (m_queue.empty())
+                    {
+                        if (m_terminate.load()) { return; }
+                        m_cv.wait(queue_lock);
+                    }
+                    auto task = m_queue.front();
+                    m_queue.pop();
+                    queue_lock.unlock();
+                    {
+                        std::lock_guard<std::mutex> task_lock(task->mutex);
+                        task->func();
+                        task->finished = true;
+                    }
+                    task->cv.notify_all();
+                }
+            });
+        }
+    }
+
+    ~LegacyThreadPool()
+    {
+        m_terminate = true;
+        m_cv.notify_all();
+        for (auto& t: m_threads) { t.join(); }
+    }
+
+    void Parallelize(const std::vector<std::function<void()>>& funcs)
+    {
+        std::vector<std::shared_ptr<LegacyTask>> handles;
+        for (size_t i = 1; i < funcs.size(); ++i)
+        {
+            auto task = std::make_shared<LegacyTask>(funcs[i]);
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_queue.push(task);
+            }
+            m_cv.notify_one();
+            handles.push_back(task);
+        }
+        funcs[0]();
+        for (auto& h: handles) { h->join(); }
+    }
+
+private:
+    std::atomic_bool m_terminate{false};
+    std::vector<std::thread> m_threads;
+    std::queue<std::shared_ptr<LegacyTask>> m_queue;
+    std::mutex m_mutex;
+    std::condition_variable m_cv;
+};
+
+// --------------------------------------------------------------------------------------------------------------------
+// Benchmarks
+// --------------------------------------------------------------------------------------------------------------------
+
+static const int NUM_ACTORS = 8;
+
+static int NumWorkers()
+{
+    // Same as `App::CreateThreadPool()`
+    const int logical_cores = static_cast<int>(std::thread::hardware_concurrency());
+    return std::min(std::max(logical_cores - 1, 1), 8);
+}
+
+// Tiny per-actor payload, so that the measurement is dominated by scheduling
+static void ActorWork(std::atomic<int>& counter)
+{
+    counter.fetch_add(1, std::memory_order_relaxed);
+}
+
+static void BM_Substep_Legacy_Parallelize(benchmark::State& state)
+{
+    LegacyThreadPool pool(NumWorkers());
+    std::atomic<int> counter(0);
+    for (auto _ : state)
+    {
+        for (int phase = 0; phase < 2; ++phase)
+        {
+            std::vector<std::function<void()>> tasks;
+            for (int i = 0; i < NUM_ACTORS; ++i)
+            {
+                tasks.push_back([&counter]{ ActorWork(counter); });
+            }
+            pool.Parallelize(tasks);
+        }
+    }
+    benchmark::DoNotOptimize(counter.load());
+}
+
+static void BM_Substep_WorkStealing_Parallelize(benchmark::State& state)
+{
+    RoR::ThreadPool pool(NumWorkers());
+    std::atomic<int> counter(0);
+    for (auto _ : state)
+    {
+        for (int phase = 0; phase < 2; ++phase)
+        {
+            std::vector<std::function<void()>> tasks;
+            for (int i = 0; i < NUM_ACTORS; ++i)
+            {
+                tasks.push_back([&counter]{ ActorWork(counter); });
+            }
+            pool.Parallelize(tasks);
+        }
+    }
+    benchmark::DoNotOptimize(counter.load());
+}
+
+static void BM_Substep_WorkStealing_ParallelFor(benchmark::State& state)
+{
+    RoR::ThreadPool pool(NumWorkers());
+    std::atomic<int> counter(0);
+    for (auto _ : state)
+    {
+        for (int phase = 0; phase < 2; ++phase)
+        {
+            pool.ParallelFor(0, NUM_ACTORS, 1, [&counter](int) { ActorWork(counter); });
+        }
+    }
+    benchmark::DoNotOptimize(counter.load());
+}
+
+BENCHMARK(BM_Substep_Legacy_Parallelize)->UseRealTime();
+BENCHMARK(BM_Substep_WorkStealing_Parallelize)->UseRealTime();
+BENCHMARK(BM_Substep_WorkStealing_ParallelFor)->UseRealTime();
+
+BENCHMARK_MAIN();
@@ -0,0 +1,119 @@
+// Nested `ParallelFor()` inside `RunTask()` jobs, like flexbody tasks started by `GfxActor::UpdateFlexbodies()`
+// which split their work again, and inside `ParallelFor()` chunks, like split actors. Doubles as a regression test: with 1 worker, tasks submitted while another task
+// waits for its nested chunks end up on top of them in the worker's queue; the waiter must still find its chunks.
+// A watchdog aborts the process if an iteration hangs.
+//
+// Build: g++ -O2 -std=c++11 Bench_ThreadPool_Nested.cpp -lbenchmark -lpthread
+
+#include "benchmark/benchmark.h"
+#include "../main/threadpool/ThreadPool.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <thread>
+#include <vector>
+
+static const int NUM_TASKS = 8;
+static const int NUM_ITEMS = 256;
+static const int GRAIN = 16;
+
+static std::atomic<unsigned> g_progress{0};
+
+/// Aborts if `g_progress` doesn't change for 10 seconds.
+static void StartWatchdog()
+{
+    static bool started = false;
+    if (started)
+        return;
+    started = true;
+    std::thread([]{
+        unsigned last = g_progress.load();
+        while (true)
+        {
+            std::this_thread::sleep_for(std::chrono::seconds(10));
+            const unsigned now = g_progress.load();
+            if (now == last)
+            {
+                std::fprintf(stderr, "Deadlock: no progress in 10 seconds\n");
+                std::abort();
+            }
+            last = now;
+        }
+    }).detach();
+}
+
+static void RunNested(RoR::ThreadPool& tp, std::atomic<int>& sum, std::chrono::milliseconds first_chunk_delay)
+{
+    std::vector<std::shared_ptr<RoR::Task>> tasks;
+    for (int t = 0; t < NUM_TASKS; t++)
+    {
+        tasks.push_back(tp.RunTask([&tp, &sum, t, first_chunk_delay]{
+            tp.ParallelFor(0, NUM_ITEMS, GRAIN, [&sum, t, first_chunk_delay](int i){
+                if (t == 0 && i == 0)
+                    std::this_thread::sleep_for(first_chunk_delay);
+                sum.fetch_add(1, std::memory_order_relaxed);
+            });
+        }));
+        if (t == 0 && first_chunk_delay.count() > 0)
+            std::this_thread::sleep_for(first_chunk_delay / 4); // Let the task start, then submit more on top of its chunks
+    }
+    for (auto& task: tasks)
+        task->join();
+}
+
+static void BM_Nested_RunTaskParallelFor(benchmark::State& state)
+{
+    StartWatchdog();
+    RoR::ThreadPool tp(static_cast<int>(state.range(0)));
+    for (auto _: state)
+    {
+        std::atomic<int> sum(0);
+        RunNested(tp, sum, std::chrono::milliseconds(0));
+        if (sum.load() != NUM_TASKS * NUM_ITEMS)
+            state.SkipWithError("Not all items processed");
+        g_progress++;
+    }
+    state.SetItemsProcessed(state.iterations() * NUM_TASKS * NUM_ITEMS);
+}
+BENCHMARK(BM_Nested_RunTaskParallelFor)->Arg(1)->Arg(2)->Arg(4)->UseRealTime();
+
+/// Per-actor `ParallelFor()` in `ActorManager::UpdatePhysicsSimulation()` with split actors inside,
+/// which run their own `ParallelFor()` (see `Actor::m_split_physics`).
+static void BM_Nested_ParallelForParallelFor(benchmark::State& state)
+{
+    StartWatchdog();
+    RoR::ThreadPool tp(static_cast<int>(state.range(0)));
+    for (auto _: state)
+    {
+        std::atomic<int> sum(0);
+        tp.ParallelFor(0, NUM_TASKS, 1, [&tp, &sum](int){
+            tp.ParallelFor(0, NUM_ITEMS, GRAIN, [&sum](int){ sum.fetch_add(1, std::memory_order_relaxed); });
+        });
+        if (sum.load() != NUM_TASKS * NUM_ITEMS)
+            state.SkipWithError("Not all items processed");
+        g_progress++;
+    }
+    state.SetItemsProcessed(state.iterations() * NUM_TASKS * NUM_ITEMS);
+}
+BENCHMARK(BM_Nested_ParallelForParallelFor)->Arg(1)->Arg(2)->Arg(4)->UseRealTime();
+
+/// The scenario which used to deadlock: one task's chunk is slow, more tasks arrive meanwhile.
+static void BM_Nested_DelayedChunk(benchmark::State& state)
+{
+    StartWatchdog();
+    RoR::ThreadPool tp(static_cast<int>(state.range(0)));
+    for (auto _: state)
+    {
+        std::atomic<int> sum(0);
+        RunNested(tp, sum, std::chrono::milliseconds(200));
+        if (sum.load() != NUM_TASKS * NUM_ITEMS)
+            state.SkipWithError("Not all items processed");
+        g_progress++;
+    }
+}
+BENCHMARK(BM_Nested_DelayedChunk)->Arg(1)->Arg(4)->Iterations(3)->UseRealTime()->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
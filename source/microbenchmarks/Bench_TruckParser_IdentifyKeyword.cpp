@@ -2,6 +2,13 @@
 #include "benchmark/benchmark.h"
 #include <regex>
 #include <iostream>
+#include <algorithm>
+#include <climits>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <vector>
 
     enum Keyword
     {
@@ -1532,7 +1539,7 @@ void PrepareBench_sol1()
     int count = sizeof(trucklines)/sizeof(const char*);
     for (int i = 0; i < count; ++i)
     {
-        lines_vec.emplace_back(std::string(trucklines[0]));
+        lines_vec.emplace_back(std::string(trucklines[i]));
     }
 }
 
@@ -1841,6 +1848,378 @@ static void Bench_sol2b_SwitchPreCond(benchmark::State& state)
 }
 BENCHMARK(Bench_sol2b_SwitchPreCond);
 
+// ############################ Solution 3 - keyword table + hash ##############################
+// What `RigDef::Parser::IdentifyKeywordInCurrentLine()` does: look up the first word (up to a blank
+// or comma) in a case-insensitive hash table over the keyword table, then check what follows it.
+
+enum class KeywordForm
+{
+    BLOCK,           //!< Nothing but blanks
+    INLINE,          //!< Blanks, then values
+    INLINE_TOLERANT  //!< Blanks or commas, then values
+};
+
+struct KeywordDef
+{
+    const char*   name;
+    Keyword       keyword;
+    KeywordForm   form;
+};
+
+const KeywordDef KEYWORD_TABLE[] =
+{
+    { "add_animation",                KEYWORD_ADD_ANIMATION,                KeywordForm::INLINE_TOLERANT },
+    { "airbrakes",                    KEYWORD_AIRBRAKES,                    KeywordForm::BLOCK },
+    { "animators",                    KEYWORD_ANIMATORS,                    KeywordForm::BLOCK },
+    { "AntiLockBrakes",               KEYWORD_ANTI_LOCK_BRAKES,             KeywordForm::INLINE },
+    { "axles",                        KEYWORD_AXLES,                        KeywordForm::BLOCK },
+    { "author",                       KEYWORD_AUTHOR,                       KeywordForm::INLINE },
+    { "backmesh",                     KEYWORD_BACKMESH,                     KeywordForm::BLOCK },
+    { "beams",                        KEYWORD_BEAMS,                        KeywordForm::BLOCK },
+    { "brakes",                       KEYWORD_BRAKES,                       KeywordForm::BLOCK },
+    { "cab",                          KEYWORD_CAB,                          KeywordForm::BLOCK },
+    { "camerarail",                   KEYWORD_CAMERARAIL,                   KeywordForm::BLOCK },
+    { "cameras",                      KEYWORD_CAMERAS,                      KeywordForm::BLOCK },
+    { "cinecam",                      KEYWORD_CINECAM,                      KeywordForm::BLOCK },
+    { "collisionboxes",               KEYWORD_COLLISIONBOXES,               KeywordForm::BLOCK },
+    { "commands",                     KEYWORD_COMMANDS,                     KeywordForm::BLOCK },
+    { "commands2",                    KEYWORD_COMMANDS2,                    KeywordForm::BLOCK },
+    { "contacters",                   KEYWORD_CONTACTERS,                   KeywordForm::BLOCK },
+    { "cruisecontrol",                KEYWORD_CRUISECONTROL,                KeywordForm::INLINE },
+    { "description",                  KEYWORD_DESCRIPTION,                  KeywordForm::BLOCK },
+    { "detacher_group",               KEYWORD_DETACHER_GROUP,               KeywordForm::INLINE },
+    { "disabledefaultsounds",         KEYWORD_DISABLEDEFAULTSOUNDS,         KeywordForm::BLOCK },
+    { "enable_advanced_deformation",  KEYWORD_ENABLE_ADVANCED_DEFORMATION,  KeywordForm::BLOCK },
+    { "end",                          KEYWORD_END,                          KeywordForm::BLOCK },
+    { "end_section",                  KEYWORD_END_SECTION,                  KeywordForm::BLOCK },
+    { "engine",                       KEYWORD_ENGINE,                       KeywordForm::BLOCK },
+    { "engoption",                    KEYWORD_ENGOPTION,                    KeywordForm::BLOCK },
+    { "engturbo",                     KEYWORD_ENGTURBO,                     KeywordForm::BLOCK },
+    { "envmap",                       KEYWORD_ENVMAP,                       KeywordForm::BLOCK },
+    { "exhausts",                     KEYWORD_EXHAUSTS,                     KeywordForm::BLOCK },
+    { "extcamera",                    KEYWORD_EXTCAMERA,                    KeywordForm::INLINE },
+    { "fileformatversion",            KEYWORD_FILEFORMATVERSION,            KeywordForm::INLINE },
+    { "fileinfo",                     KEYWORD_FILEINFO,                     KeywordForm::INLINE },
+    { "fixes",                        KEYWORD_FIXES,                        KeywordForm::BLOCK },
+    { "flares",                       KEYWORD_FLARES,                       KeywordForm::BLOCK },
+    { "flares2",                      KEYWORD_FLARES2,                      KeywordForm::BLOCK },
+    { "flexbodies",                   KEYWORD_FLEXBODIES,                   KeywordForm::BLOCK },
+    { "flexbody_camera_mode",         KEYWORD_FLEXBODY_CAMERA_MODE,         KeywordForm::INLINE },
+    { "flexbodywheels",               KEYWORD_FLEXBODYWHEELS,               KeywordForm::BLOCK },
+    { "forwardcommands",              KEYWORD_FORWARDCOMMANDS,              KeywordForm::BLOCK },
+    { "fusedrag",                     KEYWORD_FUSEDRAG,                     KeywordForm::BLOCK },
+    { "globals",                      KEYWORD_GLOBALS,                      KeywordForm::BLOCK },
+    { "guid",                         KEYWORD_GUID,                         KeywordForm::INLINE },
+    { "guisettings",                  KEYWORD_GUISETTINGS,                  KeywordForm::BLOCK },
+    { "help",                         KEYWORD_HELP,                         KeywordForm::BLOCK },
+    { "hideInChooser",                KEYWORD_HIDE_IN_CHOOSER,              KeywordForm::BLOCK },
+    { "hookgroup",                    KEYWORD_HOOKGROUP,                    KeywordForm::BLOCK },
+    { "hooks",                        KEYWORD_HOOKS,                        KeywordForm::BLOCK },
+    { "hydros",                       KEYWORD_HYDROS,                       KeywordForm::BLOCK },
+    { "importcommands",               KEYWORD_IMPORTCOMMANDS,               KeywordForm::BLOCK },
+    { "lockgroups",                   KEYWORD_LOCKGROUPS,                   KeywordForm::BLOCK },
+    { "lockgroup_default_nolock",     KEYWORD_LOCKGROUP_DEFAULT_NOLOCK,     KeywordForm::BLOCK },
+    { "managedmaterials",             KEYWORD_MANAGEDMATERIALS,             KeywordForm::BLOCK },
+    { "materialflarebindings",        KEYWORD_MATERIALFLAREBINDINGS,        KeywordForm::BLOCK },
+    { "meshwheels",                   KEYWORD_MESHWHEELS,                   KeywordForm::BLOCK },
+    { "meshwheels2",                  KEYWORD_MESHWHEELS2,                  KeywordForm::BLOCK },
+    { "minimass",                     KEYWORD_MINIMASS,                     KeywordForm::BLOCK },
+    { "nodecollision",                KEYWORD_NODECOLLISION,                KeywordForm::BLOCK },
+    { "nodes",                        KEYWORD_NODES,                        KeywordForm::BLOCK },
+    { "nodes2",                       KEYWORD_NODES2,                       KeywordForm::BLOCK },
+    { "particles",                    KEYWORD_PARTICLES,                    KeywordForm::BLOCK },
+    { "pistonprops",                  KEYWORD_PISTONPROPS,                  KeywordForm::BLOCK },
+    { "prop_camera_mode",             KEYWORD_PROP_CAMERA_MODE,             KeywordForm::INLINE },
+    { "props",                        KEYWORD_PROPS,                        KeywordForm::BLOCK },
+    { "railgroups",                   KEYWORD_RAILGROUPS,                   KeywordForm::BLOCK },
+    { "rescuer",                      KEYWORD_RESCUER,                      KeywordForm::BLOCK },
+    { "rigidifiers",                  KEYWORD_RIGIDIFIERS,                  KeywordForm::BLOCK },
+    { "rollon",                       KEYWORD_ROLLON,                       KeywordForm::BLOCK },
+    { "ropables",                     KEYWORD_ROPABLES,                     KeywordForm::BLOCK },
+    { "ropes",                        KEYWORD_ROPES,                        KeywordForm::BLOCK },
+    { "rotators",                     KEYWORD_ROTATORS,                     KeywordForm::BLOCK },
+    { "rotators2",                    KEYWORD_ROTATORS2,                    KeywordForm::BLOCK },
+    { "screwprops",                   KEYWORD_SCREWPROPS,                   KeywordForm::BLOCK },
+    { "section",                      KEYWORD_SECTION,                      KeywordForm::INLINE },
+    { "sectionconfig",                KEYWORD_SECTIONCONFIG,                KeywordForm::INLINE },
+    { "set_beam_defaults",            KEYWORD_SET_BEAM_DEFAULTS,            KeywordForm::INLINE },
+    { "set_beam_defaults_scale",      KEYWORD_SET_BEAM_DEFAULTS_SCALE,      KeywordForm::INLINE },
+    { "set_collision_range",          KEYWORD_SET_COLLISION_RANGE,          KeywordForm::INLINE },
+    { "set_inertia_defaults",         KEYWORD_SET_INERTIA_DEFAULTS,         KeywordForm::INLINE },
+    { "set_managedmaterials_options", KEYWORD_SET_MANAGEDMATERIALS_OPTIONS, KeywordForm::INLINE },
+    { "set_node_defaults",            KEYWORD_SET_NODE_DEFAULTS,            KeywordForm::INLINE },
+    { "set_shadows",                  KEYWORD_SET_SHADOWS,                  KeywordForm::BLOCK },
+    { "set_skeleton_settings",        KEYWORD_SET_SKELETON_SETTINGS,        KeywordForm::INLINE },
+    { "shocks",                       KEYWORD_SHOCKS,                       KeywordForm::BLOCK },
+    { "shocks2",                      KEYWORD_SHOCKS2,                      KeywordForm::BLOCK },
+    { "slidenode_connect_instantly",  KEYWORD_SLIDENODE_CONNECT_INSTANTLY,  KeywordForm::BLOCK },
+    { "slidenodes",                   KEYWORD_SLIDENODES,                   KeywordForm::BLOCK },
+    { "SlopeBrake",                   KEYWORD_SLOPE_BRAKE,                  KeywordForm::INLINE },
+    { "soundsources",                 KEYWORD_SOUNDSOURCES,                 KeywordForm::BLOCK },
+    { "soundsources2",                KEYWORD_SOUNDSOURCES2,                KeywordForm::BLOCK },
+    { "speedlimiter",                 KEYWORD_SPEEDLIMITER,                 KeywordForm::INLINE },
+    { "submesh",                      KEYWORD_SUBMESH,                      KeywordForm::BLOCK },
+    { "submesh_groundmodel",          KEYWORD_SUBMESH_GROUNDMODEL,          KeywordForm::INLINE },
+    { "texcoords",                    KEYWORD_TEXCOORDS,                    KeywordForm::BLOCK },
+    { "ties",                         KEYWORD_TIES,                         KeywordForm::BLOCK },
+    { "torquecurve",                  KEYWORD_TORQUECURVE,                  KeywordForm::BLOCK },
+    { "TractionControl",              KEYWORD_TRACTION_CONTROL,             KeywordForm::INLINE },
+    { "triggers",                     KEYWORD_TRIGGERS,                     KeywordForm::BLOCK },
+    { "turbojets",                    KEYWORD_TURBOJETS,                    KeywordForm::BLOCK },
+    { "turboprops",                   KEYWORD_TURBOPROPS,                   KeywordForm::BLOCK },
+    { "turboprops2",                  KEYWORD_TURBOPROPS2,                  KeywordForm::BLOCK },
+    { "videocamera",                  KEYWORD_VIDEOCAMERA,                  KeywordForm::BLOCK },
+    { "wheeldetachers",               KEYWORD_WHEELDETACHERS,               KeywordForm::BLOCK },
+    { "wheels",                       KEYWORD_WHEELS,                       KeywordForm::BLOCK },
+    { "wheels2",                      KEYWORD_WHEELS2,                      KeywordForm::BLOCK },
+    { "wings",                        KEYWORD_WINGS,                        KeywordForm::BLOCK },
+};
+
+inline bool IsWhitespace(char c)
+{
+    return (c == ' ') || (c == '\t');
+}
+
+inline char LowerAscii(char c)
+{
+    return (c >= 'A' && c <= 'Z') ? (c + ('a' - 'A')) : c;
+}
+
+inline bool EqualsNocase(const char* name, const char* word, size_t len)
+{
+    for (size_t i = 0; i < len; i++)
+    {
+        if (name[i] == '\0' || LowerAscii(name[i]) != LowerAscii(word[i]))
+            return false;
+    }
+    return name[len] == '\0';
+}
+
+class KeywordLookup
+{
+public:
+    KeywordLookup()
+    {
+        std::fill(m_slots, m_slots + NUM_SLOTS, EMPTY_SLOT);
+        for (size_t i = 0; i < sizeof(KEYWORD_TABLE) / sizeof(KeywordDef); i++)
+        {
+            size_t slot = Hash(KEYWORD_TABLE[i].name, strlen(KEYWORD_TABLE[i].name));
+            while (m_slots[slot] != EMPTY_SLOT)
+                slot = (slot + 1) & (NUM_SLOTS - 1);
+            m_slots[slot] = static_cast<uint8_t>(i);
+        }
+    }
+
+    const KeywordDef* Find(const char* word, size_t len) const
+    {
+        for (size_t slot = Hash(word, len); m_slots[slot] != EMPTY_SLOT; slot = (slot + 1) & (NUM_SLOTS - 1))
+        {
+            const KeywordDef& def = KEYWORD_TABLE[m_slots[slot]];
+            if (EqualsNocase(def.name, word, len))
+                return &def;
+        }
+        return nullptr;
+    }
+
+private:
+    static const size_t  NUM_SLOTS = 256;
+    static const uint8_t EMPTY_SLOT = 0xFF;
+
+    static size_t Hash(const char* word, size_t len)
+    {
+        uint32_t hash = 2166136261u; // FNV-1a
+        for (size_t i = 0; i < len; i++)
+            hash = (hash ^ static_cast<uint8_t>(LowerAscii(word[i]))) * 16777619u;
+        return hash & (NUM_SLOTS - 1);
+    }
+
+    uint8_t m_slots[NUM_SLOTS];
+};
+
+/// @param out_bad_case Set if the keyword matched only when ignoring lettercase
+Keyword IdentifyKeywordTable(const char* line, bool& out_bad_case)
+{
+    char c = tolower(line[0]);
+    if (c > 'z' || c < 'a')
+        return KEYWORD_INVALID;
+
+    size_t len = 0;
+    while (line[len] != '\0' && !IsWhitespace(line[len]) && line[len] != ',')
+        len++;
+
+    static const KeywordLookup lookup;
+    const KeywordDef* def = lookup.Find(line, len);
+    if (def == nullptr)
+        return KEYWORD_INVALID;
+
+    const char* rest = line + len;
+    switch (def->form)
+    {
+    case KeywordForm::BLOCK:
+        while (IsWhitespace(*rest))
+            rest++;
+        if (*rest != '\0')
+            return KEYWORD_INVALID;
+        break;
+    case KeywordForm::INLINE:
+        if (!IsWhitespace(*rest))
+            return KEYWORD_INVALID;
+        break;
+    case KeywordForm::INLINE_TOLERANT:
+        if (!IsWhitespace(*rest) && *rest != ',')
+            return KEYWORD_INVALID;
+        break;
+    }
+
+    out_bad_case = (strncmp(def->name, line, len) != 0);
+    return def->keyword;
+}
+
+static void Bench_sol3__Table(benchmark::State& state)
+{
+    bool bad_case = false;
+    while (state.KeepRunning()) 
+    {
+        int count = (int) lines_vec.size();
+        for (int i = 0; i < count; ++i)
+        {
+            keyword = (int) IdentifyKeywordTable(lines_vec[i].c_str(), bad_case);
+        }
+    }
+}
+BENCHMARK(Bench_sol3__Table);
+
+// ########################## End to end - whole truckfiles ###################################
+// The per-line work of `RigDef::Parser::ProcessRawLine()` up to the keyword: trim, skip comments,
+// copy to the line buffer, tokenize and identify the keyword (the former parser ran the case-respecting
+// regex and then the case-ignoring one). Runs over the truckfiles given on the command line, or the
+// example truckfile above.
+
+std::vector<std::string> e2e_lines;
+size_t e2e_bytes = 0;
+
+const std::regex IDENTIFY_KEYWORD_RESPECT_CASE = std::regex( IDENTIFY_KEYWORD_REGEX_STRING, std::regex::ECMAScript);
+
+Keyword IdentifyKeywordRegex(const char* line_buf, bool& out_bad_case)
+{
+    char c = tolower(line_buf[0]);
+    if (c > 'z' || c < 'a')
+        return KEYWORD_INVALID;
+
+    std::smatch results;
+    std::string line(line_buf);
+    std::regex_search(line, results, IDENTIFY_KEYWORD_RESPECT_CASE);
+    unsigned match = FindKeywordMatch(results);
+    if (match != INT_MAX)
+        return Keyword(match);
+
+    std::regex_search(line, results, IDENTIFY_KEYWORD_IGNORE_CASE);
+    match = FindKeywordMatch(results);
+    out_bad_case = (match != INT_MAX);
+    return (match != INT_MAX) ? Keyword(match) : KEYWORD_INVALID;
+}
+
+struct LineArg { const char* start; int length; };
+
+template <Keyword (*IDENTIFY)(const char*, bool&)>
+int ProcessLines()
+{
+    static const int LINE_BUFFER_LENGTH = 4000;
+    static const int LINE_MAX_ARGS = 100;
+    char line_buf[LINE_BUFFER_LENGTH];
+    LineArg args[LINE_MAX_ARGS];
+    int num_keywords = 0;
+    for (const std::string& raw: e2e_lines)
+    {
+        const char* start = raw.c_str();
+        const char* end = start + raw.size();
+        while (IsWhitespace(*start) && start != end)
+            ++start;
+        if (start == end || *start == ';' || *start == '/')
+            continue;
+        const size_t len = std::min(static_cast<size_t>(end - start), static_cast<size_t>(LINE_BUFFER_LENGTH - 1));
+        memcpy(line_buf, start, len);
+        line_buf[len] = '\0';
+
+        int num_args = 0, arg_len = 0;
+        for (const char* c = line_buf; *c != '\0' && num_args < LINE_MAX_ARGS; ++c)
+        {
+            const bool is_arg = !(IsWhitespace(*c) || *c == ':' || *c == '|' || *c == ',');
+            if (arg_len == 0 && is_arg)       { args[num_args].start = c; arg_len = 1; }
+            else if (arg_len > 0 && !is_arg)  { args[num_args++].length = arg_len; arg_len = 0; }
+            else if (is_arg)                  { ++arg_len; }
+        }
+        benchmark::DoNotOptimize(args);
+
+        bool bad_case = false;
+        if (IDENTIFY(line_buf, bad_case) != KEYWORD_INVALID)
+            ++num_keywords;
+    }
+    return num_keywords;
+}
+
+static void Bench_e2e_Regex(benchmark::State& state)
+{
+    int num_keywords = 0;
+    for (auto _: state)
+    {
+        num_keywords = ProcessLines<IdentifyKeywordRegex>();
+        benchmark::DoNotOptimize(num_keywords);
+    }
+    state.counters["keywords"] = num_keywords;
+    state.SetItemsProcessed(state.iterations() * e2e_lines.size());
+    state.SetBytesProcessed(state.iterations() * e2e_bytes);
+}
+BENCHMARK(Bench_e2e_Regex);
+
+static void Bench_e2e_Table(benchmark::State& state)
+{
+    int num_keywords = 0;
+    for (auto _: state)
+    {
+        num_keywords = ProcessLines<IdentifyKeywordTable>();
+        benchmark::DoNotOptimize(num_keywords);
+    }
+    state.counters["keywords"] = num_keywords;
+    state.SetItemsProcessed(state.iterations() * e2e_lines.size());
+    state.SetBytesProcessed(state.iterations() * e2e_bytes);
+}
+BENCHMARK(Bench_e2e_Table);
+
+void PrepareBench_e2e(int argc, char** argv)
+{
+    for (int i = 1; i < argc; ++i)
+    {
+        std::ifstream file(argv[i]);
+        std::string line;
+        while (std::getline(file, line))
+        {
+            if (!line.empty() && line.back() == '\r')
+                line.pop_back();
+            e2e_lines.push_back(line);
+        }
+    }
+    if (e2e_lines.empty())
+    {
+        e2e_lines = lines_vec;
+    }
+    for (const std::string& line: e2e_lines)
+    {
+        e2e_bytes += line.size() + 1;
+    }
+
+    // Both must find the same keywords
+    for (const std::string& line: e2e_lines)
+    {
+        bool bad_case_regex = false, bad_case_table = false;
+        if (IdentifyKeywordRegex(line.c_str(), bad_case_regex) != IdentifyKeywordTable(line.c_str(), bad_case_table) ||
+            bad_case_regex != bad_case_table)
+        {
+            std::cout << "Keyword mismatch: '" << line << "'" << std::endl;
+        }
+    }
+}
+
 int main(int argc, char** argv)
 {
     using namespace std;
@@ -1850,8 +2229,9 @@ int main(int argc, char** argv)
     PrepareBench_sol1();
 
 
-    // benchmark
+    // benchmark; arguments left after the benchmark flags are truckfiles for the end-to-end test
     ::benchmark::Initialize(&argc, argv);  
+    PrepareBench_e2e(argc, argv);
     ::benchmark::RunSpecifiedBenchmarks(); 
 #ifdef _MSC_VER
     system("pause");
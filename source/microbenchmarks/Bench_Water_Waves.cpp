@@ -0,0 +1,131 @@
+// Wave surface for a boat: ~2000 buoycab nodes near the sea level, 5 wave trains (the default 'wavefield.cfg').
+// Compares the former per-point `Water::CalcWavesHeight()` + `CalcWavesVelocity()` (libm sin/cos per train,
+// every call) with one `Wavefield::CalcBatch()` over all nodes (per-train constants, SSE2 polynomial sin/cos).
+//
+// Build: g++ -O2 -std=c++11 Bench_Water_Waves.cpp -lbenchmark -lpthread
+
+#include "benchmark/benchmark.h"
+
+#include "../main/physics/water/Wavefield.cpp"
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+static const int   NUM_NODES = 2000;
+static const float SEA_LEVEL = 10.f;
+static const float CENTER = 1500.f;
+
+struct TrainDef { float wavelength, amplitude, maxheight, direction_deg; };
+static const TrainDef TRAINS[] = {
+    { 180.f, 1.f,   4.f, 90.f },
+    {  87.f, 0.5f,  2.f, 45.f },
+    {  11.f, 0.25f, 0.5f, 22.f },
+    {   4.f, 2.f,   0.1f, 0.f },
+    {  4.1f, 2.f,   0.1f, 90.f },
+};
+
+static std::vector<float> MakeNodes()
+{
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<float> horiz(-20.f, 20.f), vert(-2.f, 3.f);
+    std::vector<float> xyz(3 * NUM_NODES);
+    for (int i = 0; i < NUM_NODES; i++)
+    {
+        xyz[3 * i + 0] = 2300.f + horiz(rng);
+        xyz[3 * i + 1] = SEA_LEVEL + vert(rng);
+        xyz[3 * i + 2] = 1900.f + horiz(rng);
+    }
+    return xyz;
+}
+
+// ---- Former implementation ----
+
+struct LegacyTrain { float amplitude, maxheight, wavelength, wavespeed, dir_sin, dir_cos; };
+
+static float LegacyHeight(const std::vector<LegacyTrain>& trains, float max_ampl, float time_sec, float x, float y, float z)
+{
+    if (y > SEA_LEVEL + max_ampl)
+        return SEA_LEVEL;
+    const float waveheight = ((x - CENTER) * (x - CENTER) + (y - SEA_LEVEL) * (y - SEA_LEVEL) + (z - CENTER) * (z - CENTER)) / 3000000.0;
+    float result = SEA_LEVEL;
+    for (const LegacyTrain& t: trains)
+    {
+        const float amp = std::min(t.amplitude * waveheight, t.maxheight);
+        result += amp * sin(6.2831853f * ((time_sec * t.wavespeed + t.dir_sin * x + t.dir_cos * z) / t.wavelength));
+    }
+    return result;
+}
+
+static void LegacyVelocity(const std::vector<LegacyTrain>& trains, float max_ampl, float time_sec, float x, float y, float z, float* out)
+{
+    out[0] = out[1] = out[2] = 0.f;
+    if (y > SEA_LEVEL + max_ampl)
+        return;
+    const float waveheight = ((x - CENTER) * (x - CENTER) + (y - SEA_LEVEL) * (y - SEA_LEVEL) + (z - CENTER) * (z - CENTER)) / 3000000.0;
+    for (const LegacyTrain& t: trains)
+    {
+        const float amp = std::min(t.amplitude * waveheight, t.maxheight);
+        const float speed = 6.2831853f * amp / (t.wavelength / t.wavespeed);
+        const float coeff = 6.2831853f * (time_sec * t.wavespeed + t.dir_sin * x + t.dir_cos * z) / t.wavelength;
+        out[1] += speed * cos(coeff);
+        out[0] += t.dir_sin * speed * sin(coeff);
+        out[2] += t.dir_cos * speed * sin(coeff);
+    }
+}
+
+static void BM_Waves_Legacy(benchmark::State& state)
+{
+    std::vector<LegacyTrain> trains;
+    float max_ampl = 0.f;
+    for (const TrainDef& d: TRAINS)
+    {
+        const float dir = d.direction_deg / 57.f;
+        trains.push_back({ d.amplitude, d.maxheight, d.wavelength, 1.25f * std::sqrt(d.wavelength), std::sin(dir), std::cos(dir) });
+        max_ampl += d.maxheight;
+    }
+    const std::vector<float> xyz = MakeNodes();
+    std::vector<float> height(NUM_NODES), velocity(3 * NUM_NODES);
+    float time_sec = 100.f;
+    for (auto _: state)
+    {
+        for (int i = 0; i < NUM_NODES; i++)
+        {
+            height[i] = LegacyHeight(trains, max_ampl, time_sec, xyz[3 * i], xyz[3 * i + 1], xyz[3 * i + 2]);
+            LegacyVelocity(trains, max_ampl, time_sec, xyz[3 * i], xyz[3 * i + 1], xyz[3 * i + 2], &velocity[3 * i]);
+        }
+        benchmark::DoNotOptimize(height.data());
+        benchmark::DoNotOptimize(velocity.data());
+        time_sec += 0.0005f;
+    }
+    state.SetItemsProcessed(state.iterations() * NUM_NODES);
+}
+BENCHMARK(BM_Waves_Legacy);
+
+// ---- Batched wavefield ----
+
+static void BM_Waves_Batch(benchmark::State& state)
+{
+    RoR::Wavefield wavefield;
+    for (const TrainDef& d: TRAINS)
+    {
+        wavefield.AddWaveTrain(d.wavelength, d.amplitude, d.maxheight, d.direction_deg / 57.f);
+    }
+    wavefield.SetSeaLevel(SEA_LEVEL);
+    wavefield.SetCalmCenter(CENTER, CENTER);
+    const std::vector<float> xyz = MakeNodes();
+    std::vector<float> height(NUM_NODES), velocity(3 * NUM_NODES);
+    double time_sec = 100.0;
+    for (auto _: state)
+    {
+        wavefield.CalcBatch(time_sec, xyz.data(), NUM_NODES, height.data(), velocity.data());
+        benchmark::DoNotOptimize(height.data());
+        benchmark::DoNotOptimize(velocity.data());
+        time_sec += 0.0005;
+    }
+    state.SetItemsProcessed(state.iterations() * NUM_NODES);
+}
+BENCHMARK(BM_Waves_Batch);
+
+BENCHMARK_MAIN();